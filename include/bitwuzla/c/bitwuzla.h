@@ -1229,10 +1229,34 @@ typedef struct Bitwuzla Bitwuzla;
  */
 Bitwuzla *bitwuzla_new(BitwuzlaTermManager *tm, const BitwuzlaOptions *options);
 
+/**
+ * Create a copy of a Bitwuzla instance.
+ *
+ * The current input formula is simplified and the clone is initialized with
+ * the simplified formula, preserving the context levels of its assertions.
+ * The simplified formula is not simplified again in the clone, but is
+ * bit-blasted anew on its first check, i.e., the state of the underlying SAT
+ * solver is not copied. The clone uses the same options and term manager
+ * as the given instance, but is not connected to its termination callback.
+ * It can be used on another thread if the term manager is thread-safe (see
+ * `bitwuzla_term_manager_new_thread_safe()`).
+ *
+ * The returned instance must be deleted via `bitwuzla_delete()`.
+ *
+ * @param bitwuzla The Bitwuzla instance to clone.
+ * @return A pointer to the created Bitwuzla instance.
+ *
+ * @see
+ *   * `bitwuzla_new`
+ *   * `bitwuzla_delete`
+ */
+Bitwuzla *bitwuzla_clone(Bitwuzla *bitwuzla);
+
 /**
  * Delete a Bitwuzla instance.
  *
- * The given instance must have been created via `bitwuzla_new()`.
+ * The given instance must have been created via `bitwuzla_new()` or
+ * `bitwuzla_clone()`.
  *
  * @param bitwuzla The Bitwuzla instance to delete.
  *
@@ -1480,6 +1504,56 @@ BitwuzlaResult bitwuzla_check_sat_assuming(Bitwuzla *bitwuzla,
                                            uint32_t argc,
                                            BitwuzlaTerm args[]);
 
+/**
+ * Check satisfiability of current input formula wrt to each of the given
+ * sets of assumptions.
+ *
+ * This is equivalent to calling `bitwuzla_check_sat_assuming()` for each set
+ * of assumptions, but the input formula is simplified only once. If the term
+ * manager is thread-safe (see `bitwuzla_term_manager_new_thread_safe()`) and
+ * option `::BITWUZLA_OPT_NTHREADS` is greater than 1, the checks are
+ * distributed among the given number of worker threads.
+ *
+ * Model values require that model generation is enabled, unsat assumptions
+ * require that unsat assumptions are enabled. The results of the checks can
+ * not be queried via `bitwuzla_get_value()` and
+ * `bitwuzla_get_unsat_assumptions()`.
+ *
+ * @param bitwuzla          The Bitwuzla instance.
+ * @param size              The number of checks.
+ * @param argcs             The number of assumptions of each check.
+ * @param args              The assumptions of each check, `args[i]` holds
+ *                          `argcs[i]` assumptions.
+ * @param num_terms         The number of terms in `terms`.
+ * @param terms             The terms to query model values for.
+ * @param values            Output parameter, optional. If not NULL, set to
+ *                          an array of `size * num_terms` terms, where the
+ *                          model value of `terms[k]` in check `i` is at
+ *                          index `i * num_terms + k`, NULL if check `i` did
+ *                          not return `::BITWUZLA_SAT`.
+ * @param unsat_assumptions Output parameter, optional. If not NULL, set to an
+ *                          array of flags, one per assumption in the order
+ *                          given in `args`, true if the assumption is an
+ *                          unsat assumption of its check.
+ *
+ * @return An array of `size` results, one per check.
+ *
+ * @note The returned arrays are only valid until the next
+ *       `bitwuzla_check_sat_batch()` call.
+ *
+ * @see
+ *   * `bitwuzla_check_sat_assuming`
+ *   * `BitwuzlaResult`
+ */
+const BitwuzlaResult *bitwuzla_check_sat_batch(Bitwuzla *bitwuzla,
+                                               size_t size,
+                                               const uint32_t argcs[],
+                                               BitwuzlaTerm *args[],
+                                               uint32_t num_terms,
+                                               BitwuzlaTerm terms[],
+                                               const BitwuzlaTerm **values,
+                                               const bool **unsat_assumptions);
+
 /**
  * Get a term representing the model value of a given term.
  *
@@ -1495,6 +1569,62 @@ BitwuzlaResult bitwuzla_check_sat_assuming(Bitwuzla *bitwuzla,
  */
 BitwuzlaTerm bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term);
 
+/**
+ * Get terms representing the model values of the given terms.
+ *
+ * Requires that the last `bitwuzla_check_sat()` query returned
+ * `::BITWUZLA_SAT`.
+ *
+ * This is equivalent to calling `bitwuzla_get_value()` for each term, but
+ * computes the values of all terms in one pass, sharing the work for common
+ * subterms.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param size     The number of terms in `terms`.
+ * @param terms    The terms to query model values for.
+ *
+ * @return An array of `size` terms representing the model values of
+ *         `terms`, in the same order.
+ *
+ * @note The returned array is only valid until the next
+ *       `bitwuzla_get_values()` call.
+ *
+ * @see
+ *   * `bitwuzla_get_value`
+ *   * `bitwuzla_get_bv_values`
+ */
+const BitwuzlaTerm *bitwuzla_get_values(Bitwuzla *bitwuzla,
+                                        size_t size,
+                                        BitwuzlaTerm terms[]);
+
+/**
+ * Get the model values of the given bit-vector terms as 64-bit limbs.
+ *
+ * Requires that the last `bitwuzla_check_sat()` query returned
+ * `::BITWUZLA_SAT`.
+ *
+ * The value of a term of size `n` is stored in `(n + 63) / 64` consecutive
+ * limbs, least significant limb first, where the unused bits of the most
+ * significant limb are zero. The values are stored in the order of `terms`,
+ * without gaps. No terms or strings are created for the values.
+ * Aborts if the value of a term cannot be determined, i.e., if
+ * `bitwuzla_get_value()` would return the term itself.
+ *
+ * @param bitwuzla  The Bitwuzla instance.
+ * @param size      The number of terms in `terms`.
+ * @param terms     The bit-vector terms to query model values for.
+ * @param limbs     The buffer to store the values in.
+ * @param num_limbs The size of the buffer in limbs, must be at least the
+ *                  total number of limbs of the values.
+ *
+ * @see `bitwuzla_get_values`
+ */
+void bitwuzla_get_bv_values(Bitwuzla *bitwuzla,
+                            size_t size,
+                            BitwuzlaTerm terms[],
+                            uint64_t *limbs,
+                            size_t num_limbs);
+
 /**
  * Print the current input formula.
  *
@@ -1584,10 +1714,26 @@ BitwuzlaTermManager *bitwuzla_get_term_mgr(Bitwuzla *bitwuzla);
  */
 BitwuzlaTermManager *bitwuzla_term_manager_new();
 
+/**
+ * Create a new thread-safe BitwuzlaTermManager instance.
+ *
+ * A thread-safe term manager is required for solving on multiple threads
+ * (options `::BITWUZLA_OPT_PORTFOLIO` and `::BITWUZLA_OPT_NTHREADS` in
+ * combination with `bitwuzla_check_sat_batch()`).
+ *
+ * The returned instance must be deleted via `bitwuzla_term_manager_delete()`.
+ *
+ * @see
+ *   * `bitwuzla_term_manager_new`
+ *   * `bitwuzla_term_manager_delete`
+ */
+BitwuzlaTermManager *bitwuzla_term_manager_new_thread_safe();
+
 /**
  * Delete a BitwuzlaTermManager instance.
  *
- * The given instance must have been created via `bitwuzla_term_manager_new()`.
+ * The given instance must have been created via `bitwuzla_term_manager_new()`
+ * or `bitwuzla_term_manager_new_thread_safe()`.
  *
  * @note This will also invalidate all sorts and terms created by this term
  *       manager.
@@ -2311,6 +2457,54 @@ void bitwuzla_substitute_terms(size_t terms_size,
 
 /** @} */
 
+/* -------------------------------------------------------------------------- */
+/* Term snapshots                                                             */
+/* -------------------------------------------------------------------------- */
+
+/** \addtogroup c_term_snapshots
+ *  @{
+ */
+
+/**
+ * Save a set of terms (and all of their subterms) to a binary snapshot file.
+ *
+ * Snapshots store terms in a compact binary format that can be loaded via
+ * `bitwuzla_term_manager_load_snapshot()` considerably faster than parsing
+ * their SMT-LIB representation.
+ *
+ * @param tm The term manager instance.
+ * @param filename The name of the snapshot file.
+ * @param terms_size The number of terms to save.
+ * @param terms The terms to save.
+ *
+ * @see
+ *   * `bitwuzla_term_manager_load_snapshot`
+ */
+void bitwuzla_term_manager_save_snapshot(BitwuzlaTermManager *tm,
+                                         const char *filename,
+                                         size_t terms_size,
+                                         BitwuzlaTerm terms[]);
+
+/**
+ * Load the terms stored in a binary snapshot file.
+ *
+ * Constants, variables and uninterpreted sorts are created fresh (with their
+ * symbols) on every load.
+ *
+ * @param tm The term manager instance.
+ * @param filename The name of the snapshot file.
+ * @param size Output parameter to store the number of loaded terms.
+ * @return An array with the terms stored in the snapshot, in the order they
+ *         were saved.
+ *
+ * @see
+ *   * `bitwuzla_term_manager_save_snapshot`
+ */
+const BitwuzlaTerm *bitwuzla_term_manager_load_snapshot(
+    BitwuzlaTermManager *tm, const char *filename, size_t *size);
+
+/** @} */
+
 #if __cplusplus
 }
 #endif
@@ -1108,6 +1108,13 @@ class TermManager
   friend Bitwuzla;
 
   TermManager();
+  /**
+   * Constructor.
+   * @param thread_safe True to allow creating terms from multiple threads
+   *                    concurrently. Required for portfolio mode
+   *                    (Option::PORTFOLIO).
+   */
+  TermManager(bool thread_safe);
   ~TermManager();
 
   /** Disallow copy construction. */
@@ -1547,6 +1554,67 @@ class TermManager
   void substitute_terms(std::vector<Term> &terms,
                         const std::unordered_map<Term, Term> &map);
 
+  /* ------------------------------------------------------------------------ */
+  /* Term snapshots                                                           */
+  /* ------------------------------------------------------------------------ */
+
+  /**
+   * Save a set of terms (and all of their subterms) to a binary snapshot file.
+   *
+   * Snapshots store terms in a compact binary format that can be loaded via
+   * `TermManager::load_snapshot()` considerably faster than parsing their
+   * SMT-LIB representation.
+   *
+   * @param filename The name of the snapshot file.
+   * @param terms The terms to save.
+   *
+   * @see
+   *   * `TermManager::load_snapshot()`
+   */
+  void save_snapshot(const std::string &filename,
+                     const std::vector<Term> &terms);
+
+  /**
+   * Save a set of terms (and all of their subterms) as binary snapshot to an
+   * output stream.
+   *
+   * @param out The output stream, must be opened in binary mode.
+   * @param terms The terms to save.
+   *
+   * @see
+   *   * `TermManager::load_snapshot()`
+   */
+  void save_snapshot(std::ostream &out, const std::vector<Term> &terms);
+
+  /**
+   * Load the terms stored in a binary snapshot file.
+   *
+   * Constants, variables and uninterpreted sorts are created fresh (with their
+   * symbols) on every load, and are thus distinct from constants, variables
+   * and uninterpreted sorts of previous loads of the same snapshot.
+   *
+   * @param filename The name of the snapshot file.
+   * @return The terms stored in the snapshot, in the order they were saved.
+   *
+   * @see
+   *   * `TermManager::save_snapshot()`
+   */
+  std::vector<Term> load_snapshot(const std::string &filename);
+
+  /**
+   * Load the terms stored in a binary snapshot from an input stream.
+   *
+   * @note Prefer loading snapshots from files, which are memory-mapped
+   *       instead of being read into a buffer.
+   *
+   * @param in The input stream, must be opened in binary mode.
+   * @return The terms stored in the snapshot, in the order they were saved.
+   *
+   * @see
+   *   * `TermManager::save_snapshot()`
+   */
+  std::vector<Term> load_snapshot(std::istream &in);
+
 
  private:
   std::unique_ptr<bzla::NodeManager> d_nm;
@@ -1583,6 +1651,30 @@ class Bitwuzla
   /** Disallow copy assignment. */
   Bitwuzla &operator=(const Bitwuzla &bitwuzla) = delete;
 
+  /**
+   * Create a copy of this solver instance.
+   *
+   * The current input formula is simplified (see `simplify()`) and the clone
+   * is initialized with the simplified formula, preserving the context levels
+   * of its assertions. The simplified formula is not simplified again in the
+   * clone, but is bit-blasted anew on its first `check_sat()` call, i.e., the
+   * state of the underlying SAT solver is not copied. The clone uses the same
+   * options and term manager as this instance, but is not connected to the
+   * terminator of this instance. It can be used independently of this
+   * instance, and on another thread if the term manager is thread-safe (see
+   * `TermManager::TermManager(bool)`).
+   *
+   * @note Unsat cores of the clone are in terms of the simplified formula and
+   *       the equalities of the variable substitutions applied during
+   *       simplification.
+   *
+   * @note The cost of cloning is reported in the statistics of this
+   *       instance (`solving_context::clone::*`).
+   *
+   * @return The clone.
+   */
+  std::unique_ptr<Bitwuzla> clone();
+
   /**
    * Connect or disconnect associated termination configuration instance.
    * @note Only one terminator can be connected at a time. This will disconnect
@@ -1722,6 +1814,44 @@ class Bitwuzla
    */
   Result check_sat(const std::vector<Term> &assumptions = {});
 
+  /**
+   * Check satisfiability of current input formula under each of the given
+   * sets of assumptions.
+   *
+   * This is equivalent to calling `check_sat()` for each set of assumptions,
+   * but the input formula is simplified only once. If the term manager is
+   * thread-safe (see `TermManager::TermManager(bool)`) and option
+   * `Option::NTHREADS` is greater than 1, the checks are distributed among
+   * the given number of worker threads.
+   *
+   * Model values and unsat assumptions of each check can optionally be
+   * retrieved. Model values require that model generation is enabled
+   * (`Option::PRODUCE_MODELS`), unsat assumptions require that unsat
+   * assumptions are enabled (`Option::PRODUCE_UNSAT_ASSUMPTIONS`).
+   *
+   * @note The results of the checks can not be queried via `get_value()`
+   *       and `get_unsat_assumptions()`.
+   *
+   * @param assumptions       The sets of assumptions, one per check.
+   * @param terms             The terms to query model values for.
+   * @param values            If not null, filled with the model values of
+   *                          `terms` for each check, empty for checks that
+   *                          did not return `Result::SAT`.
+   * @param unsat_assumptions If not null, filled with the unsat assumptions
+   *                          of each check, empty for checks that did not
+   *                          return `Result::UNSAT`.
+   * @return The results of the checks.
+   *
+   * @see
+   *   * `check_sat()`
+   *   * `Option::NTHREADS`
+   */
+  std::vector<Result> check_sat_batch(
+      const std::vector<std::vector<Term>> &assumptions,
+      const std::vector<Term> &terms                     = {},
+      std::vector<std::vector<Term>> *values             = nullptr,
+      std::vector<std::vector<Term>> *unsat_assumptions = nullptr);
+
   /**
    * Get a term representing the model value of a given term.
    *
@@ -1734,6 +1864,47 @@ class Bitwuzla
    */
   Term get_value(const Term &term);
 
+  /**
+   * Get terms representing the model values of the given terms.
+   *
+   * Requires that the last `check_sat()` query returned
+   * `Result::SAT`.
+   *
+   * This is equivalent to calling `get_value()` for each term, but computes
+   * the values of all terms in one pass, sharing the work for common
+   * subterms.
+   *
+   * @param terms The terms to query model values for.
+   * @return The model values of `terms`, in the same order.
+   * @see
+   *   * `get_value()`
+   *   * `get_bv_values()`
+   */
+  std::vector<Term> get_values(const std::vector<Term> &terms);
+
+  /**
+   * Get the model values of the given bit-vector terms as 64-bit limbs.
+   *
+   * Requires that the last `check_sat()` query returned
+   * `Result::SAT`.
+   *
+   * The value of a term of size `n` is stored in `(n + 63) / 64` consecutive
+   * limbs, least significant limb first, where the unused bits of the most
+   * significant limb are zero. The values are stored in the order of
+   * `terms`, without gaps. No terms or strings are created for the values.
+   * Throws an exception if the value of a term cannot be determined, i.e.,
+   * if `get_value()` would return the term itself.
+   *
+   * @param terms The bit-vector terms to query model values for.
+   * @param limbs The buffer to store the values in.
+   * @param size  The size of the buffer in limbs, must be at least the total
+   *              number of limbs of the values.
+   * @see `get_values()`
+   */
+  void get_bv_values(const std::vector<Term> &terms,
+                     uint64_t *limbs,
+                     size_t size);
+
   /**
    * Print the current input formula to the given output stream.
    *
@@ -1768,6 +1939,13 @@ class Bitwuzla
   TermManager &term_mgr();
 
  private:
+  /**
+   * Constructor.
+   * @param tm  The associated term manager instance.
+   * @param ctx The associated solving context.
+   */
+  Bitwuzla(TermManager &tm, std::unique_ptr<bzla::SolvingContext> ctx);
+
   /** Helper called when solver state changes. */
   void solver_state_change();
 
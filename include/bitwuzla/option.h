@@ -119,12 +119,46 @@ enum ENUM(Option)
   /*!
    * **Number of parallel threads.**
    *
+   * For the CaDiCaL back end, a value greater than 1 enables a parallel
+   * portfolio of differently configured CaDiCaL instances, one per thread.
+   * The number of instances is limited to the number of hardware threads.
+   * For the CryptoMiniSat back end, this configures the number of threads
+   * used by CryptoMiniSat. For batched satisfiability checks
+   * (`Bitwuzla::check_sat_batch()`), this configures the number of worker
+   * threads the checks are distributed among.
+   *
    * *Values:*
    *  - **min**: 1
-   *  - **max**: UINT64_MAX
+   *  - **max**: 256
    *  - **default**: 1
    */
   EVALUE(NTHREADS),
+  /*!
+   * **Number of parallel solver instances (portfolio mode).**
+   *
+   * A value greater than 1 runs the given number of differently configured
+   * solver instances on separate threads on the preprocessed assertions
+   * of each satisfiability check. The first instance that determines a
+   * result terminates all other instances. The instances cycle through the
+   * configured bit-vector solver engine, the propagation-based local search
+   * engine, the sequential portfolio of local search and bit-blasting and
+   * the abstraction module, where each instance uses a different seed.
+   * The configuration that determined the result is reported in the
+   * statistics.
+   *
+   * The number of instances is limited to the number of hardware threads.
+   * Each instance uses a single-threaded SAT solver, i.e., ``nthreads`` is
+   * ignored in portfolio mode.
+   *
+   * @note Requires a thread-safe term manager, falls back to sequential
+   *       solving otherwise.
+   *
+   * *Values:*
+   *  - **min**: 0
+   *  - **max**: 256
+   *  - **default**: 0
+   */
+  EVALUE(PORTFOLIO),
 
   /* ---------------- Bitwuzla-specific Options ----------------------------- */
 
@@ -168,6 +202,22 @@ enum ENUM(Option)
    *    as the backend SAT solver.
    */
   EVALUE(SAT_SOLVER),
+  /*!
+   * **Share learned clauses in the parallel SAT portfolio.**
+   *
+   * When enabled, the CaDiCaL instances of the parallel SAT portfolio
+   * (see ``nthreads``) exchange short learned clauses while solving.
+   * Shared clauses may only contain variables that are not eliminated by
+   * CaDiCaL, hence sharing restricts variable elimination.
+   *
+   * *Values:*
+   *  - **true**: enable
+   *  - **false**: disable [**default**]
+   *
+   * @warning This is an expert option to configure the parallel SAT
+   *          portfolio of the `bitblast` bit-vector solver engine.
+   */
+  EVALUE(SAT_SHARING),
   /*! **Print bit-vector abstraction as AIG in binary or ascii AIGER format.**
    *
    * Expects a filename (as string) as the configuration value.
@@ -197,6 +247,77 @@ enum ENUM(Option)
    *    [**default:** ""]
    */
   EVALUE(WRITE_CNF),
+  /*!
+   * **Polarity-aware CNF encoding of the bit-vector abstraction.**
+   *
+   * When enabled, AIG gates are encoded to CNF only in the polarities they
+   * are used in (Plaisted-Greenbaum encoding) rather than with full Tseitin
+   * clauses. Gates are incrementally encoded in the missing polarity when
+   * required by later assertions or assumptions.
+   *
+   * *Values:*
+   *  - **true**: enable
+   *  - **false**: disable [**default**]
+   *
+   * @warning This is an expert option to configure the CNF encoding of the
+   *          `bitblast` bit-vector solver engine.
+   */
+  EVALUE(CNF_POLARITY),
+  /*!
+   * **SAT sweeping of the bit-vector abstraction.**
+   *
+   * When enabled, functionally equivalent AIG gates of the bit-blasted
+   * formula are merged before CNF encoding. Candidate equivalences are
+   * determined via random simulation and proved with conflict-limited SAT
+   * calls on a separate SAT solver instance.
+   *
+   * *Values:*
+   *  - **true**: enable
+   *  - **false**: disable [**default**]
+   *
+   * @warning This is an expert option to configure the CNF encoding of the
+   *          `bitblast` bit-vector solver engine.
+   */
+  EVALUE(FRAIG),
+  /*!
+   * **Configure the circuit for bit-blasting bit-vector multiplication.**
+   *
+   * *Values:*
+   *  - **array**:
+   *    Shift-and-add array multiplier with a ripple-carry adder per partial
+   *    product row. [**default**]
+   *  - **wallace**:
+   *    Wallace tree reduction of the partial products.
+   *  - **dadda**:
+   *    Dadda tree reduction of the partial products.
+   *
+   * For **wallace** and **dadda**, multiplications with a constant operand
+   * use the canonical signed digit representation of the constant to
+   * minimize the number of partial product rows.
+   *
+   * @warning This is an expert option to configure the `bitblast`
+   *          bit-vector solver engine.
+   */
+  EVALUE(BV_MUL_ENCODING),
+  /*!
+   * **Cube-and-conquer split depth.**
+   *
+   * When greater than 0, each satisfiability check of the `bitblast`
+   * bit-vector solver engine splits on the given number of input bits with
+   * the highest fan-out and solves the resulting cubes as assumptions on
+   * the instances of the parallel SAT portfolio (see ``nthreads``). With a
+   * single thread, the cubes are solved sequentially on one instance. Only
+   * supported for the CaDiCaL back end.
+   *
+   * *Values:*
+   *  - **min**: 0
+   *  - **max**: 16
+   *  - **default**: 0 (disabled)
+   *
+   * @warning This is an expert option to configure the `bitblast`
+   *          bit-vector solver engine.
+   */
+  EVALUE(BV_CUBE_DEPTH),
 
   /* ---------------- BV: Prop Engine Options (Expert) ---------------------- */
 
@@ -338,6 +459,60 @@ enum ENUM(Option)
    *          solver engine.
    */
   EVALUE(PROP_SEXT),
+  /*!
+   * **Propagation-based local search solver engine: Asynchronous mode.**
+   *
+   * When enabled, the `preprop` bit-vector solver engine runs local search
+   * on a separate thread concurrently with the SAT solver on the bit-blasted
+   * formula instead of sequentially, and the first engine that determines
+   * satisfiability wins. Whenever local search reaches its propagation or
+   * update limit, bits of inputs that are fixed by the SAT solver are fixed
+   * in local search, and local search continues with doubled limits.
+   *
+   * *Values:*
+   *  - **true**: enable
+   *  - **false**: disable [**default**]
+   *
+   * @see #BV_SOLVER
+   * @see #PROP_NPROPS
+   * @see #PROP_NUPDATES
+   * @warning This is an expert option to configure the `preprop` bit-vector
+   *          solver engine.
+   */
+  EVALUE(PROP_ASYNC),
+  /*!
+   * **Propagation-based local search solver engine: Phase hints.**
+   *
+   * When enabled in asynchronous `preprop` mode, the current local search
+   * assignment of the inputs is used as phases of the SAT solver whenever
+   * local search reaches its propagation or update limit.
+   *
+   * *Values:*
+   *  - **true**: enable
+   *  - **false**: disable [**default**]
+   *
+   * @see #PROP_ASYNC
+   * @warning This is an expert option to configure the `preprop` bit-vector
+   *          solver engine.
+   */
+  EVALUE(PROP_PHASE_HINTS),
+  /*!
+   * **Propagation-based local search solver engine: Move candidates.**
+   *
+   * Configure the number of candidate moves selected per local search move.
+   * If greater than 1, all candidates are evaluated at once by bit-parallel
+   * simulation and the candidate that satisfies the most assertions is
+   * applied. Scoring is skipped if the formula contains terms with bit-width
+   * greater than 64.
+   *
+   * *Values:*
+   *  - An unsigned integer value in [1, 64]. [**default**: 1]
+   *
+   * @see #BV_SOLVER
+   * @warning This is an expert option to configure the `prop` bit-vector
+   *          solver engine.
+   */
+  EVALUE(PROP_MOVE_CANDIDATES),
 
   /*!
    * **Abstraction module.**
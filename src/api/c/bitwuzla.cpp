@@ -12,8 +12,10 @@ extern "C" {
 #include <bitwuzla/c/bitwuzla.h>
 }
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <unordered_map>
 
 #include "api/c/bitwuzla_structs.h"
@@ -414,6 +416,18 @@ bitwuzla_new(BitwuzlaTermManager *tm, const BitwuzlaOptions *options)
   return res;
 }
 
+Bitwuzla *
+bitwuzla_clone(Bitwuzla *bitwuzla)
+{
+  Bitwuzla *res = nullptr;
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  res = new Bitwuzla(bitwuzla->d_tm, bitwuzla->d_bitwuzla->clone().release());
+  res->d_bitwuzla_needs_delete = true;
+  BITWUZLA_C_TRY_CATCH_END;
+  return res;
+}
+
 void
 bitwuzla_delete(Bitwuzla *bitwuzla)
 {
@@ -605,6 +619,90 @@ bitwuzla_check_sat_assuming(Bitwuzla *bitwuzla,
   return res;
 }
 
+const BitwuzlaResult *
+bitwuzla_check_sat_batch(Bitwuzla *bitwuzla,
+                         size_t size,
+                         const uint32_t argcs[],
+                         BitwuzlaTerm *args[],
+                         uint32_t num_terms,
+                         BitwuzlaTerm terms[],
+                         const BitwuzlaTerm **values,
+                         const bool **unsat_assumptions)
+{
+  static thread_local std::vector<BitwuzlaResult> res;
+  static thread_local std::vector<BitwuzlaTerm> res_values;
+  static thread_local std::unique_ptr<bool[]> res_unsat_assumptions;
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  if (size > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(argcs);
+    BITWUZLA_CHECK_NOT_NULL(args);
+  }
+  if (num_terms > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(terms);
+  }
+  res.clear();
+  res_values.clear();
+  std::vector<std::vector<bitwuzla::Term>> assumptions(size);
+  size_t num_assumptions = 0;
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (uint32_t j = 0; j < argcs[i]; ++j)
+    {
+      assumptions[i].push_back(BitwuzlaTermManager::import_term(args[i][j]));
+    }
+    num_assumptions += argcs[i];
+  }
+  std::vector<bitwuzla::Term> bterms;
+  for (uint32_t k = 0; k < num_terms; ++k)
+  {
+    bterms.push_back(BitwuzlaTermManager::import_term(terms[k]));
+  }
+  std::vector<std::vector<bitwuzla::Term>> bvalues, bunsat_assumptions;
+  auto results = bitwuzla->d_bitwuzla->check_sat_batch(
+      assumptions,
+      bterms,
+      values ? &bvalues : nullptr,
+      unsat_assumptions ? &bunsat_assumptions : nullptr);
+  auto tm = bitwuzla->d_tm;
+  for (size_t i = 0; i < size; ++i)
+  {
+    res.push_back(static_cast<BitwuzlaResult>(results[i]));
+  }
+  if (values)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (uint32_t k = 0; k < num_terms; ++k)
+      {
+        res_values.push_back(bvalues[i].empty()
+                                 ? nullptr
+                                 : tm->export_term(bvalues[i][k]));
+      }
+    }
+    *values = res_values.empty() ? nullptr : res_values.data();
+  }
+  if (unsat_assumptions)
+  {
+    res_unsat_assumptions.reset(new bool[num_assumptions]());
+    for (size_t i = 0, offset = 0; i < size; offset += argcs[i++])
+    {
+      const auto &unsat = bunsat_assumptions[i];
+      for (uint32_t j = 0; j < argcs[i]; ++j)
+      {
+        res_unsat_assumptions[offset + j] =
+            std::find(unsat.begin(), unsat.end(), assumptions[i][j])
+            != unsat.end();
+      }
+    }
+    *unsat_assumptions = res_unsat_assumptions.get();
+  }
+  BITWUZLA_C_TRY_CATCH_END;
+  return size > 0 ? res.data() : nullptr;
+}
+
 BitwuzlaTerm
 bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term)
 {
@@ -618,6 +716,56 @@ bitwuzla_get_value(Bitwuzla *bitwuzla, BitwuzlaTerm term)
   return res;
 }
 
+const BitwuzlaTerm *
+bitwuzla_get_values(Bitwuzla *bitwuzla, size_t size, BitwuzlaTerm terms[])
+{
+  static thread_local std::vector<BitwuzlaTerm> res;
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  if (size > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(terms);
+  }
+  res.clear();
+  std::vector<bitwuzla::Term> bterms;
+  for (size_t i = 0; i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_AT_IDX(terms, i);
+    bterms.push_back(BitwuzlaTermManager::import_term(terms[i]));
+  }
+  auto values = bitwuzla->d_bitwuzla->get_values(bterms);
+  auto tm     = bitwuzla->d_tm;
+  for (auto &value : values)
+  {
+    res.push_back(tm->export_term(value));
+  }
+  BITWUZLA_C_TRY_CATCH_END;
+  return size > 0 ? res.data() : nullptr;
+}
+
+void
+bitwuzla_get_bv_values(Bitwuzla *bitwuzla,
+                       size_t size,
+                       BitwuzlaTerm terms[],
+                       uint64_t *limbs,
+                       size_t num_limbs)
+{
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(bitwuzla);
+  if (size > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(terms);
+  }
+  std::vector<bitwuzla::Term> bterms;
+  for (size_t i = 0; i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_AT_IDX(terms, i);
+    bterms.push_back(BitwuzlaTermManager::import_term(terms[i]));
+  }
+  bitwuzla->d_bitwuzla->get_bv_values(bterms, limbs, num_limbs);
+  BITWUZLA_C_TRY_CATCH_END;
+}
+
 void
 bitwuzla_print_formula(Bitwuzla *bitwuzla,
                        const char *format,
@@ -701,6 +849,16 @@ bitwuzla_term_manager_new()
   return res;
 }
 
+BitwuzlaTermManager *
+bitwuzla_term_manager_new_thread_safe()
+{
+  BitwuzlaTermManager *res = nullptr;
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  res = new BitwuzlaTermManager(true);
+  BITWUZLA_C_TRY_CATCH_END;
+  return res;
+}
+
 void
 bitwuzla_term_manager_delete(BitwuzlaTermManager *tm)
 {
@@ -1409,6 +1567,49 @@ bitwuzla_substitute_terms(size_t terms_size,
   BITWUZLA_C_TRY_CATCH_END;
 }
 
+void
+bitwuzla_term_manager_save_snapshot(BitwuzlaTermManager *tm,
+                                    const char *filename,
+                                    size_t terms_size,
+                                    BitwuzlaTerm terms[])
+{
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(tm);
+  BITWUZLA_CHECK_NOT_NULL(filename);
+  if (terms_size)
+  {
+    BITWUZLA_CHECK_NOT_NULL(terms);
+  }
+  std::vector<bitwuzla::Term> ts;
+  for (size_t i = 0; i < terms_size; ++i)
+  {
+    BITWUZLA_CHECK_TERM(terms[i]);
+    ts.push_back(BitwuzlaTermManager::import_term(terms[i]));
+  }
+  tm->d_tm.save_snapshot(filename, ts);
+  BITWUZLA_C_TRY_CATCH_END;
+}
+
+const BitwuzlaTerm *
+bitwuzla_term_manager_load_snapshot(BitwuzlaTermManager *tm,
+                                    const char *filename,
+                                    size_t *size)
+{
+  static thread_local std::vector<BitwuzlaTerm> res;
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(tm);
+  BITWUZLA_CHECK_NOT_NULL(filename);
+  BITWUZLA_CHECK_NOT_NULL(size);
+  res.clear();
+  for (const auto &term : tm->d_tm.load_snapshot(filename))
+  {
+    res.push_back(tm->export_term(term));
+  }
+  *size = res.size();
+  BITWUZLA_C_TRY_CATCH_END;
+  return *size > 0 ? res.data() : nullptr;
+}
+
 BitwuzlaTerm
 bitwuzla_term_copy(BitwuzlaTerm term)
 {
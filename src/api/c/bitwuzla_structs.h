@@ -98,6 +98,13 @@ struct bitwuzla_sort_t
 
 struct BitwuzlaTermManager
 {
+  BitwuzlaTermManager() = default;
+  /**
+   * Constructor.
+   * @param thread_safe True to create a thread-safe term manager.
+   */
+  BitwuzlaTermManager(bool thread_safe) : d_tm(thread_safe) {}
+
   static const bitwuzla::Sort &import_sort(BitwuzlaSort sort);
   static const bitwuzla::Term &import_term(BitwuzlaTerm term);
 
@@ -11,6 +11,7 @@
 #include <bitwuzla/cpp/bitwuzla.h>
 
 #include <array>
+#include <iterator>
 
 #include "api/checks.h"
 #include "bv/bitvector.h"
@@ -18,6 +19,7 @@
 #include "node/node.h"
 #include "node/node_kind.h"
 #include "node/node_manager.h"
+#include "node/node_snapshot.h"
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_set.h"
 #include "option/option.h"
@@ -65,13 +67,19 @@ static const std::unordered_map<Option, bzla::option::Option>
         {Option::PRODUCE_UNSAT_CORES,
          bzla::option::Option::PRODUCE_UNSAT_CORES},
         {Option::SAT_SOLVER, bzla::option::Option::SAT_SOLVER},
+        {Option::SAT_SHARING, bzla::option::Option::SAT_SHARING},
         {Option::WRITE_AIGER, bzla::option::Option::WRITE_AIGER},
         {Option::WRITE_CNF, bzla::option::Option::WRITE_CNF},
+        {Option::CNF_POLARITY, bzla::option::Option::CNF_POLARITY},
+        {Option::FRAIG, bzla::option::Option::FRAIG},
+        {Option::BV_MUL_ENCODING, bzla::option::Option::BV_MUL_ENCODING},
+        {Option::BV_CUBE_DEPTH, bzla::option::Option::BV_CUBE_DEPTH},
         {Option::SEED, bzla::option::Option::SEED},
         {Option::VERBOSITY, bzla::option::Option::VERBOSITY},
         {Option::TIME_LIMIT_PER, bzla::option::Option::TIME_LIMIT_PER},
         {Option::MEMORY_LIMIT, bzla::option::Option::MEMORY_LIMIT},
         {Option::NTHREADS, bzla::option::Option::NTHREADS},
+        {Option::PORTFOLIO, bzla::option::Option::PORTFOLIO},
         {Option::REWRITE_LEVEL, bzla::option::Option::REWRITE_LEVEL},
         {Option::PROP_CONST_BITS, bzla::option::Option::PROP_CONST_BITS},
         {Option::PROP_INFER_INEQ_BOUNDS,
@@ -86,6 +94,10 @@ static const std::unordered_map<Option, bzla::option::Option>
         {Option::PROP_PROB_USE_INV_VALUE,
          bzla::option::Option::PROP_PROB_PICK_INV_VALUE},
         {Option::PROP_SEXT, bzla::option::Option::PROP_SEXT},
+        {Option::PROP_ASYNC, bzla::option::Option::PROP_ASYNC},
+        {Option::PROP_PHASE_HINTS, bzla::option::Option::PROP_PHASE_HINTS},
+        {Option::PROP_MOVE_CANDIDATES,
+         bzla::option::Option::PROP_MOVE_CANDIDATES},
         {Option::ABSTRACTION, bzla::option::Option::ABSTRACTION},
         {Option::ABSTRACTION_BV_SIZE,
          bzla::option::Option::ABSTRACTION_BV_SIZE},
@@ -1437,6 +1449,18 @@ Bitwuzla::Bitwuzla(TermManager &tm, const Options &options) : d_tm(tm)
 
 Bitwuzla::~Bitwuzla() {}
 
+std::unique_ptr<Bitwuzla>
+Bitwuzla::clone()
+{
+  BITWUZLA_CHECK_NOT_NULL(d_ctx);
+  std::unique_ptr<Bitwuzla> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  solver_state_change();
+  res.reset(new Bitwuzla(d_tm, d_ctx->clone()));
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
 void
 Bitwuzla::configure_terminator(Terminator *terminator)
 {
@@ -1636,6 +1660,79 @@ Bitwuzla::check_sat(const std::vector<Term> &assumptions)
   return d_last_check_sat;
 }
 
+std::vector<Result>
+Bitwuzla::check_sat_batch(const std::vector<std::vector<Term>> &assumptions,
+                          const std::vector<Term> &terms,
+                          std::vector<std::vector<Term>> *values,
+                          std::vector<std::vector<Term>> *unsat_assumptions)
+{
+  BITWUZLA_CHECK_NOT_NULL(d_ctx);
+  if (values)
+  {
+    BITWUZLA_CHECK_OPT_PRODUCE_MODELS(d_ctx->options());
+  }
+  if (unsat_assumptions)
+  {
+    BITWUZLA_CHECK_OPT_PRODUCE_UNSAT_ASSUMPTIONS(d_ctx->options());
+  }
+  std::vector<std::vector<bzla::Node>> nodes;
+  for (size_t i = 0, size = assumptions.size(); i < size; ++i)
+  {
+    for (size_t j = 0, n = assumptions[i].size(); j < n; ++j)
+    {
+      const Term &term = assumptions[i][j];
+      BITWUZLA_CHECK_TERM_NOT_NULL(term);
+      BITWUZLA_CHECK_TERM_IS_BOOL(term);
+      BITWUZLA_CHECK_TERM_TERM_MGR_BITWUZLA(
+          term,
+          "assumption at position " + std::to_string(j) + " of check "
+              + std::to_string(i));
+    }
+    nodes.push_back(Term::term_vector_to_nodes(assumptions[i]));
+  }
+  for (size_t i = 0, size = terms.size(); i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL(terms[i]);
+    BITWUZLA_CHECK_TERM_TERM_MGR_BITWUZLA(
+        terms[i], "term at position " + std::to_string(i));
+  }
+  std::vector<Result> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  solver_state_change();
+  d_n_sat_calls += assumptions.size();
+  d_assumptions.clear();
+  d_unsat_core.clear();
+  d_uc_is_valid = false;
+  std::vector<std::vector<bzla::Node>> node_values, node_unsat_assumptions;
+  auto results = d_ctx->solve_batch(
+      nodes,
+      Term::term_vector_to_nodes(terms),
+      values ? &node_values : nullptr,
+      unsat_assumptions ? &node_unsat_assumptions : nullptr);
+  for (auto r : results)
+  {
+    res.push_back(s_results.at(r));
+  }
+  if (values)
+  {
+    values->clear();
+    for (const auto &v : node_values)
+    {
+      values->push_back(Term::node_vector_to_terms(v));
+    }
+  }
+  if (unsat_assumptions)
+  {
+    unsat_assumptions->clear();
+    for (const auto &u : node_unsat_assumptions)
+    {
+      unsat_assumptions->push_back(Term::node_vector_to_terms(u));
+    }
+  }
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
 Term
 Bitwuzla::get_value(const Term &term)
 {
@@ -1651,6 +1748,64 @@ Bitwuzla::get_value(const Term &term)
   return res;
 }
 
+std::vector<Term>
+Bitwuzla::get_values(const std::vector<Term> &terms)
+{
+  BITWUZLA_CHECK_NOT_NULL(d_ctx);
+  BITWUZLA_CHECK_OPT_PRODUCE_MODELS(d_ctx->options());
+  BITWUZLA_CHECK_LAST_CALL_SAT("get values");
+  for (size_t i = 0, size = terms.size(); i < size; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL(terms[i]);
+    BITWUZLA_CHECK_TERM_TERM_MGR_BITWUZLA(
+        terms[i], "term at position " + std::to_string(i));
+  }
+  std::vector<Term> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  res = Term::node_vector_to_terms(
+      d_ctx->get_values(Term::term_vector_to_nodes(terms)));
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
+void
+Bitwuzla::get_bv_values(const std::vector<Term> &terms,
+                        uint64_t *limbs,
+                        size_t size)
+{
+  BITWUZLA_CHECK_NOT_NULL(d_ctx);
+  BITWUZLA_CHECK_OPT_PRODUCE_MODELS(d_ctx->options());
+  BITWUZLA_CHECK_LAST_CALL_SAT("get bit-vector values");
+  uint64_t num_limbs = 0;
+  for (size_t i = 0, n = terms.size(); i < n; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL(terms[i]);
+    BITWUZLA_CHECK_TERM_IS_BV(terms[i]);
+    BITWUZLA_CHECK_TERM_TERM_MGR_BITWUZLA(
+        terms[i], "term at position " + std::to_string(i));
+    num_limbs += (terms[i].d_node->type().bv_size() + 63) / 64;
+  }
+  if (num_limbs > 0)
+  {
+    BITWUZLA_CHECK_NOT_NULL(limbs);
+  }
+  BITWUZLA_CHECK(num_limbs <= size)
+      << "buffer of size " << size << " too small, expected at least "
+      << num_limbs << " limbs";
+  BITWUZLA_TRY_CATCH_BEGIN;
+  auto values = d_ctx->get_values(Term::term_vector_to_nodes(terms));
+  for (size_t i = 0, n = values.size(); i < n; ++i)
+  {
+    BITWUZLA_CHECK(values[i].is_value())
+        << "model value of term at position " << i
+        << " cannot be determined";
+    const bzla::BitVector &bv = values[i].value<bzla::BitVector>();
+    bv.to_limbs(limbs);
+    limbs += bv.num_limbs();
+  }
+  BITWUZLA_TRY_CATCH_END;
+}
+
 void
 Bitwuzla::print_formula(std::ostream &out, const std::string &format) const
 {
@@ -1698,6 +1853,11 @@ Bitwuzla::term_mgr()
 
 /* Bitwuzla private --------------------------------------------------------- */
 
+Bitwuzla::Bitwuzla(TermManager &tm, std::unique_ptr<bzla::SolvingContext> ctx)
+    : d_ctx(std::move(ctx)), d_tm(tm)
+{
+}
+
 void
 Bitwuzla::solver_state_change()
 {
@@ -1713,6 +1873,11 @@ Bitwuzla::solver_state_change()
 
 TermManager::TermManager() : d_nm(new bzla::NodeManager()) {}
 
+TermManager::TermManager(bool thread_safe)
+    : d_nm(new bzla::NodeManager(thread_safe))
+{
+}
+
 TermManager::~TermManager() {}
 
 Sort
@@ -2561,6 +2726,59 @@ TermManager::substitute_terms(std::vector<Term> &terms,
   }
 }
 
+void
+TermManager::save_snapshot(const std::string &filename,
+                           const std::vector<Term> &terms)
+{
+  for (size_t i = 0, n = terms.size(); i < n; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL_AT_IDX(terms, i);
+    BITWUZLA_CHECK_TERM_TERM_MGR(terms[i],
+                                 "term at index " + std::to_string(i));
+  }
+  BITWUZLA_TRY_CATCH_BEGIN;
+  bzla::node::save_snapshot(filename, Term::term_vector_to_nodes(terms));
+  BITWUZLA_TRY_CATCH_END;
+}
+
+void
+TermManager::save_snapshot(std::ostream &out, const std::vector<Term> &terms)
+{
+  for (size_t i = 0, n = terms.size(); i < n; ++i)
+  {
+    BITWUZLA_CHECK_TERM_NOT_NULL_AT_IDX(terms, i);
+    BITWUZLA_CHECK_TERM_TERM_MGR(terms[i],
+                                 "term at index " + std::to_string(i));
+  }
+  BITWUZLA_TRY_CATCH_BEGIN;
+  bzla::node::save_snapshot(out, Term::term_vector_to_nodes(terms));
+  BITWUZLA_TRY_CATCH_END;
+}
+
+std::vector<Term>
+TermManager::load_snapshot(const std::string &filename)
+{
+  std::vector<Term> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  res = Term::node_vector_to_terms(bzla::node::load_snapshot(*d_nm, filename));
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
+std::vector<Term>
+TermManager::load_snapshot(std::istream &in)
+{
+  BITWUZLA_CHECK(in.operator bool()) << "invalid input stream";
+  std::string data((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  std::vector<Term> res;
+  BITWUZLA_TRY_CATCH_BEGIN;
+  res = Term::node_vector_to_terms(
+      bzla::node::load_snapshot(*d_nm, data.data(), data.size()));
+  BITWUZLA_TRY_CATCH_END;
+  return res;
+}
+
 /* Term private ------------------------------------------------------------- */
 
 Term::Term(const bzla::Node &node) : d_node(new bzla::Node(node)) {}
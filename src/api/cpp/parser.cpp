@@ -13,6 +13,7 @@
 #include <bitwuzla/cpp/parser.h>
 
 #include "api/checks.h"
+#include "parser/bin/parser.h"
 #include "parser/smt2/parser.h"
 
 namespace bitwuzla::parser {
@@ -33,13 +34,18 @@ Parser::Parser(TermManager &tm,
                const std::string &language,
                std::ostream *out)
 {
-  BITWUZLA_CHECK(language == "smt2" || language == "btor2")
-      << "invalid input language, expected 'smt2' or 'btor2'";
+  BITWUZLA_CHECK(language == "smt2" || language == "btor2"
+                 || language == "bin")
+      << "invalid input language, expected 'smt2', 'btor2' or 'bin'";
   BITWUZLA_CHECK_NOT_NULL(out);
   if (language == "smt2")
   {
     d_parser.reset(new bzla::parser::smt2::Parser(tm, options, out));
   }
+  else if (language == "bin")
+  {
+    d_parser.reset(new bzla::parser::bin::Parser(tm, options, out));
+  }
   else
   {
     d_parser.reset(new bzla::parser::btor2::Parser(tm, options, out));
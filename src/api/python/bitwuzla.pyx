@@ -855,8 +855,13 @@ cdef class TermManager:
     cdef shared_ptr[bitwuzla_api.TermManager] c_tm
     cdef bitwuzla_api.TermManager* c_tm_ptr
 
-    def __init__(self):
-        self.c_tm.reset(new bitwuzla_api.TermManager())
+    def __init__(self, thread_safe: bool = False):
+        """Constructor.
+
+           :param thread_safe: True to create a thread-safe term manager,
+                               required for solving on multiple threads.
+        """
+        self.c_tm.reset(new bitwuzla_api.TermManager(<c_bool> thread_safe))
         self.c_tm_ptr = self.c_tm.get()
 
     def __eq__(self, other: TermManager):
@@ -1307,6 +1312,25 @@ cdef class Bitwuzla:
                                                   options.c_options))
         self.tm = tm
 
+    def clone(self) -> Bitwuzla:
+        """Create a copy of this solver instance.
+
+           The current input formula is simplified and the clone is
+           initialized with the simplified formula, preserving the context
+           levels of its assertions. The simplified formula is not simplified
+           again in the clone, but is bit-blasted anew on its first check,
+           i.e., the state of the underlying SAT solver is not copied. The
+           clone uses the same options and term manager as this instance, but
+           is not connected to its termination callback. It can be used on
+           another thread if the term manager is thread-safe.
+
+           :return: The clone.
+        """
+        b: Bitwuzla = Bitwuzla.__new__(Bitwuzla)
+        b.c_bitwuzla.reset(self.c_bitwuzla.get().clone().release())
+        b.tm = self.tm
+        return b
+
     def configure_terminator(self, callback: callable):
         """Set a termination callback.
 
@@ -1389,6 +1413,57 @@ cdef class Bitwuzla:
         """
         return Result(self.c_bitwuzla.get().check_sat(_term_vec(assumptions)))
 
+    def check_sat_batch(self,
+                        assumptions: list[list[Term]],
+                        terms: list[Term] = None,
+                        unsat_assumptions: bool = False) -> tuple:
+        """Check satisfiability of asserted formulas under each of the
+           given lists of assumptions.
+
+           This is equivalent to calling
+           :func:`~bitwuzla.Bitwuzla.check_sat` for each list of
+           assumptions, but the input formula is simplified only once. If
+           the term manager is thread-safe and option
+           :class:`~bitwuzla.Option.NTHREADS` is greater than 1, the checks
+           are distributed among the given number of worker threads.
+
+           :param assumptions: A list of lists of Boolean terms, one list per
+                               check.
+           :param terms: The terms to query model values for in each
+                         satisfiable check, requires model generation.
+           :param unsat_assumptions: True to query the unsat assumptions of
+                                     each unsatisfiable check, requires
+                                     unsat assumptions generation.
+
+           :return: A tuple of the list of results, the list of model values
+                    of `terms` per check (None if `terms` is None) and the
+                    list of unsat assumptions per check (None if
+                    `unsat_assumptions` is False). The values of checks that
+                    are not satisfiable and the unsat assumptions of checks
+                    that are not unsatisfiable are empty lists.
+
+           .. seealso::
+               :func:`~bitwuzla.Bitwuzla.check_sat`
+        """
+        cdef vector[vector[bitwuzla_api.Term]] c_assumptions
+        cdef vector[vector[bitwuzla_api.Term]] c_values
+        cdef vector[vector[bitwuzla_api.Term]] c_unsat_assumptions
+        for a in assumptions:
+            c_assumptions.push_back(_term_vec(a))
+        c_results = self.c_bitwuzla.get().check_sat_batch(
+                c_assumptions,
+                _term_vec(terms if terms is not None else []),
+                &c_values if terms is not None else NULL,
+                &c_unsat_assumptions if unsat_assumptions else NULL)
+        results = [Result(r) for r in c_results]
+        values = None
+        if terms is not None:
+            values = [_terms(self.tm, v) for v in c_values]
+        unsat = None
+        if unsat_assumptions:
+            unsat = [_terms(self.tm, u) for u in c_unsat_assumptions]
+        return results, values, unsat
+
     def is_unsat_assumption(self, Term term) -> bool:
         """Determine if given assumption is unsat.
 
@@ -1454,6 +1529,65 @@ cdef class Bitwuzla:
         """
         return _term(self.tm, self.c_bitwuzla.get().get_value(_cterm(term)))
 
+    def get_values(self, terms: list[Term]) -> list[Term]:
+        """Get model values of terms, computed in one pass over all terms.
+
+           Requires that the last :func:`~bitwuzla.Bitwuzla.check_sat` call
+           returned `~bitwuzla.Result.SAT`.
+
+           :param terms: The terms to query model values for.
+           :return: List of terms representing the model values of `terms`.
+
+           .. seealso::
+               :func:`~bitwuzla.Bitwuzla.get_value`,
+               :func:`~bitwuzla.Bitwuzla.get_bv_values`
+        """
+        return _terms(self.tm,
+                      self.c_bitwuzla.get().get_values(_term_vec(terms)))
+
+    def get_bv_values(self, terms: list[Term], uint64_t[::1] limbs = None):
+        """Get model values of bit-vector terms as integers or 64-bit limbs.
+
+           Requires that the last :func:`~bitwuzla.Bitwuzla.check_sat` call
+           returned `~bitwuzla.Result.SAT`.
+
+           If `limbs` is given, the values are stored in `limbs` without
+           creating terms or integers. The value of a term of size `n` is
+           stored in `(n + 63) // 64` consecutive limbs, least significant
+           limb first, in the order of `terms`.
+
+           :param terms: The bit-vector terms to query model values for.
+           :param limbs: A writable contiguous buffer of unsigned 64-bit
+                         integers (e.g., ``array.array('Q')``) to store the
+                         values in, optional.
+           :return: List of the (unsigned) integer values of `terms` if
+                    `limbs` is not given, None otherwise.
+
+           .. seealso::
+               :func:`~bitwuzla.Bitwuzla.get_values`
+        """
+        cdef vector[bitwuzla_api.Term] c_terms = _term_vec(terms)
+        cdef vector[uint64_t] c_limbs
+        cdef size_t pos = 0
+        if limbs is not None:
+            self.c_bitwuzla.get().get_bv_values(
+                    c_terms,
+                    &limbs[0] if limbs.shape[0] > 0 else NULL,
+                    limbs.shape[0])
+            return None
+        sizes = [(t.sort().bv_size() + 63) // 64 for t in terms]
+        c_limbs.resize(sum(sizes))
+        self.c_bitwuzla.get().get_bv_values(
+                c_terms, c_limbs.data(), c_limbs.size())
+        res = []
+        for n in sizes:
+            value = 0
+            for i in range(n):
+                value |= int(c_limbs[pos + i]) << (64 * i)
+            res.append(value)
+            pos += n
+        return res
+
     def print_formula(self, fmt: str = 'smt2', uint8_t base = 2) -> str:
         """Get the current input formula as a string.
 
@@ -14,7 +14,7 @@ from libc.stdint cimport uint8_t, uint32_t, uint64_t, int64_t
 from libcpp cimport bool
 from libcpp.map cimport map
 from libcpp.unordered_map cimport unordered_map
-from libcpp.memory cimport shared_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
 from libcpp.optional cimport optional
 from libcpp.string cimport string
 from libcpp.vector cimport vector
@@ -223,6 +223,8 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         pass
 
     cdef cppclass TermManager:
+        TermManager() except +raise_error
+        TermManager(bool thread_safe) except +raise_error
         Sort mk_array_sort(const Sort &index,
                            const Sort &element) except +raise_error
         Sort mk_bool_sort() except +raise_error
@@ -280,6 +282,7 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
 
     cdef cppclass Bitwuzla:
         Bitwuzla(TermManager& tm, const Options &options) except +raise_error
+        unique_ptr[Bitwuzla] clone() except +raise_error
         void configure_terminator(Terminator *terminator) except +raise_error
         void push(uint32_t nlevels) except +raise_error
         void pop(uint32_t nlevels) except +raise_error
@@ -291,7 +294,16 @@ cdef extern from "bitwuzla/cpp/bitwuzla.h" namespace "bitwuzla":
         void simplify() except +raise_error
         Term simplify(const Term& term) except +raise_error
         Result check_sat(const vector[Term] &assumptions) except +raise_error
+        vector[Result] check_sat_batch(
+                const vector[vector[Term]] &assumptions,
+                const vector[Term] &terms,
+                vector[vector[Term]] *values,
+                vector[vector[Term]] *unsat_assumptions) except +raise_error
         Term get_value(const Term &term) except +raise_error
+        vector[Term] get_values(const vector[Term] &terms) except +raise_error
+        void get_bv_values(const vector[Term] &terms,
+                           uint64_t *limbs,
+                           size_t size) except +raise_error
         void print_formula(ostream& outfile, string& fmt) except +raise_error
         void print_unsat_core(ostream& outfile, string& fmt) except +raise_error
         map[string, string] statistics() except +raise_error
@@ -10,8 +10,8 @@
 
 #include "bitblast/aig/aig_cnf.h"
 
+#include <algorithm>
 #include <cstdlib>
-#include <functional>
 #include <unordered_set>
 #include <vector>
 
@@ -23,11 +23,11 @@ AigCnfEncoder::encode(const AigNode& node, bool top_level)
   if (top_level)
   {
     std::unordered_set<int64_t> cache;
-    std::vector<std::reference_wrapper<const AigNode>> visit{node};
-    std::vector<std::reference_wrapper<const AigNode>> children;
+    std::vector<AigNode> visit{node};
+    std::vector<AigNode> children;
     do
     {
-      const AigNode& cur = visit.back();
+      AigNode cur = visit.back();
       visit.pop_back();
 
       auto [it, inserted] = cache.insert(cur.get_id());
@@ -44,21 +44,43 @@ AigCnfEncoder::encode(const AigNode& node, bool top_level)
       else
       {
         children.push_back(cur);
-        _encode(cur);
+        if (d_use_polarity)
+        {
+          _encode_polarity(cur, POSITIVE);
+        }
+        else
+        {
+          _encode(cur);
+        }
       }
     } while (!visit.empty());
     assert(!children.empty());
 
     for (const AigNode& child : children)
     {
-      d_sat_solver.add_clause({child.get_id()});
+      add_clause({literal(child)});
       ++d_statistics.num_clauses;
     }
+    flush();
+  }
+  else
+  {
+    encode(node, BOTH);
+  }
+}
+
+void
+AigCnfEncoder::encode(const AigNode& node, Polarity pol)
+{
+  if (d_use_polarity)
+  {
+    _encode_polarity(node, pol);
   }
   else
   {
     _encode(node);
   }
+  flush();
 }
 
 int32_t
@@ -76,18 +98,93 @@ AigCnfEncoder::value(const AigNode& aig)
   int32_t val = -1;
   if (is_encoded(aig))
   {
-    val = d_sat_solver.value(std::abs(aig.get_id())) ? 1 : -1;
+    val = d_sat_solver.value(std::abs(literal(aig))) ? 1 : -1;
   }
 
   return aig.is_negated() ? -val : val;
 }
 
+int64_t
+AigCnfEncoder::literal(const AigNode& node)
+{
+  uint32_t id = static_cast<uint32_t>(std::abs(node.get_id()));
+  if (id >= d_vars.size())
+  {
+    d_vars.resize(id + 1, 0);
+    d_frozen.resize(id + 1, 0);
+  }
+  uint32_t& var = d_vars[id];
+  if (var == 0)
+  {
+    // Reused ids get a fresh variable since the clauses of the variable of
+    // the deleted node are still in the SAT solver.
+    var       = id < d_min_deleted_id ? id : d_max_var + 1;
+    d_max_var = std::max(d_max_var, var);
+    if (d_freeze)
+    {
+      d_sat_solver.freeze(var);
+      d_frozen[id] = 1;
+    }
+  }
+  return node.is_negated() ? -static_cast<int64_t>(var) : var;
+}
+
+void
+AigCnfEncoder::garbage_collect(uint32_t num_nodes)
+{
+  for (size_t id = num_nodes + 1, size = d_vars.size(); id < size; ++id)
+  {
+    if (d_frozen[id])
+    {
+      d_sat_solver.melt(d_vars[id]);
+    }
+  }
+  if (num_nodes + 1 < d_vars.size())
+  {
+    d_vars.resize(num_nodes + 1);
+    d_frozen.resize(num_nodes + 1);
+  }
+  if (num_nodes < d_aig_encoded.size())
+  {
+    d_aig_encoded.resize(num_nodes);
+  }
+  // All ids up to num_nodes may still use their id as SAT variable, fresh
+  // variables have to be greater.
+  d_min_deleted_id = std::min(d_min_deleted_id, num_nodes + 1);
+  d_max_var        = std::max(d_max_var, num_nodes);
+}
+
 const AigCnfEncoder::Statistics&
 AigCnfEncoder::statistics() const
 {
   return d_statistics;
 }
 
+void
+AigCnfEncoder::add_clause(const std::initializer_list<int64_t>& literals)
+{
+  for (int64_t lit : literals)
+  {
+    assert(lit != 0 && lit >= -INT32_MAX && lit <= INT32_MAX);
+    d_clauses.push_back(static_cast<int32_t>(lit));
+  }
+  d_clauses.push_back(0);
+  if (d_clauses.size() > s_max_buffered_literals)
+  {
+    flush();
+  }
+}
+
+void
+AigCnfEncoder::flush()
+{
+  if (!d_clauses.empty())
+  {
+    d_sat_solver.add_clauses(d_clauses);
+    d_clauses.clear();
+  }
+}
+
 namespace {
 
 /**
@@ -102,12 +199,12 @@ namespace {
  * @return True if given AIG is a if-then-else.
  */
 bool
-is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
+is_ite(const AigNode& aig, std::vector<AigNode>& children)
 {
   assert(aig.is_and());
   assert(children.empty());
 
-  const auto& l = aig[0];
+  AigNode l = aig[0];
   if (!l.is_negated() || !l.is_and())
   {
     return false;
@@ -119,7 +216,7 @@ is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
     return false;
   }
 
-  const auto& r = aig[1];
+  AigNode r = aig[1];
   if (!r.is_negated() || !r.is_and())
   {
     return false;
@@ -134,41 +231,41 @@ is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
   // ite(c,a,b) == (c -> a) /\ (~c -> b)
   // Check all commutative cases of: ~(c /\ ~a) /\ ~(~c /\ ~b)
   //                                   ll   lr       rl    rr
-  const auto& ll = l[0];
-  const auto& lr = l[1];
-  const auto& rl = r[0];
-  const auto& rr = r[1];
+  AigNode ll = l[0];
+  AigNode lr = l[1];
+  AigNode rl = r[0];
+  AigNode rr = r[1];
 
   // ~(~b /\ ~c) /\  ~(c /\ ~a)
   if (-lr.get_id() == rl.get_id())
   {
-    children.push_back(&rl);  // c
-    children.push_back(&rr);  // ~a
-    children.push_back(&ll);  // ~b
+    children.push_back(rl);  // c
+    children.push_back(rr);  // ~a
+    children.push_back(ll);  // ~b
     return true;
   }
   // ~(~c /\ ~b) /\ ~(c /\ ~a)
   if (-ll.get_id() == rl.get_id())
   {
-    children.push_back(&rl);  // c
-    children.push_back(&rr);  // ~a
-    children.push_back(&lr);  // ~b
+    children.push_back(rl);  // c
+    children.push_back(rr);  // ~a
+    children.push_back(lr);  // ~b
     return true;
   }
   // ~(~b /\ ~c) /\  ~(~a /\ c)
   if (-lr.get_id() == rr.get_id())
   {
-    children.push_back(&rr);  // c
-    children.push_back(&rl);  // ~a
-    children.push_back(&ll);  // ~b
+    children.push_back(rr);  // c
+    children.push_back(rl);  // ~a
+    children.push_back(ll);  // ~b
     return true;
   }
   // ~(~c /\ ~b) /\  ~(~a /\ c)
   if (-ll.get_id() == rr.get_id())
   {
-    children.push_back(&rr);  // c
-    children.push_back(&rl);  // ~a
-    children.push_back(&lr);  // ~b
+    children.push_back(rr);  // c
+    children.push_back(rl);  // ~a
+    children.push_back(lr);  // ~b
     return true;
   }
 
@@ -180,39 +277,40 @@ is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
 void
 AigCnfEncoder::_encode(const AigNode& aig)
 {
-  std::vector<const AigNode*> visit;
-  std::unordered_set<const AigNode*> cache;
-  visit.push_back(&aig);
+  std::vector<AigNode> visit;
+  std::vector<AigNode> children;
+  std::unordered_set<int64_t> cache;
+  visit.push_back(aig);
   do
   {
-    auto cur = visit.back();
-    resize(*cur);
+    AigNode cur = visit.back();
+    resize(cur);
 
-    if (is_encoded(*cur))
+    if (is_encoded(cur))
     {
       visit.pop_back();
       continue;
     }
 
-    if (cur->is_true() || cur->is_false() || cur->is_const())
+    if (cur.is_true() || cur.is_false() || cur.is_const())
     {
       visit.pop_back();
-      set_encoded(*cur);
-      if (cur->is_true() || cur->is_false())
+      set_encoded(cur);
+      if (cur.is_true() || cur.is_false())
       {
-        d_sat_solver.add_clause({std::abs(cur->get_id())});
+        add_clause({std::abs(literal(cur))});
         ++d_statistics.num_clauses;
         ++d_statistics.num_literals;
       }
     }
     else
     {
-      assert(cur->is_and());
+      assert(cur.is_and());
 
-      auto [it, inserted] = cache.insert(cur);
+      auto [it, inserted] = cache.insert(std::abs(cur.get_id()));
 
-      std::vector<const AigNode*> children;
-      bool ite = is_ite(*cur, children);
+      children.clear();
+      bool ite = is_ite(cur, children);
 
       if (inserted)
       {
@@ -222,14 +320,14 @@ AigCnfEncoder::_encode(const AigNode& aig)
         }
         else
         {
-          visit.push_back(&(*cur)[0]);
-          visit.push_back(&(*cur)[1]);
+          visit.push_back(cur[0]);
+          visit.push_back(cur[1]);
         }
       }
       else
       {
         visit.pop_back();
-        set_encoded(*cur);
+        set_encoded(cur);
 
         // TODO: and optimization: collect all children and encode one big and
         // TODO: xor optimization: use native xor encoding
@@ -237,15 +335,15 @@ AigCnfEncoder::_encode(const AigNode& aig)
         if (ite)
         {
           // Encode x <-> ite(c,a,b)
-          auto x = std::abs(cur->get_id());
-          auto c = children[0]->get_id();   // cond
-          auto a = -children[1]->get_id();  // then
-          auto b = -children[2]->get_id();  // else
-
-          d_sat_solver.add_clause({-x, -c, a});
-          d_sat_solver.add_clause({-x, c, b});
-          d_sat_solver.add_clause({x, -c, -a});
-          d_sat_solver.add_clause({x, c, -b});
+          auto x = std::abs(literal(cur));
+          auto c = literal(children[0]);   // cond
+          auto a = -literal(children[1]);  // then
+          auto b = -literal(children[2]);  // else
+
+          add_clause({-x, -c, a});
+          add_clause({-x, c, b});
+          add_clause({x, -c, -a});
+          add_clause({x, c, -b});
           d_statistics.num_clauses += 4;
           d_statistics.num_literals += 12;
         }
@@ -255,13 +353,13 @@ AigCnfEncoder::_encode(const AigNode& aig)
           //
           // x <-> a /\ b --> (~x \/ a) /\ (~x \/ b) /\ (x \/ ~a \/ ~b)
 
-          auto x = std::abs(cur->get_id());
-          auto a = (*cur)[0].get_id();
-          auto b = (*cur)[1].get_id();
+          auto x = std::abs(literal(cur));
+          auto a = literal(cur[0]);
+          auto b = literal(cur[1]);
 
-          d_sat_solver.add_clause({-x, a});
-          d_sat_solver.add_clause({-x, b});
-          d_sat_solver.add_clause({x, -a, -b});
+          add_clause({-x, a});
+          add_clause({-x, b});
+          add_clause({x, -a, -b});
           d_statistics.num_clauses += 3;
           d_statistics.num_literals += 7;
         }
@@ -270,6 +368,106 @@ AigCnfEncoder::_encode(const AigNode& aig)
   } while (!visit.empty());
 }
 
+void
+AigCnfEncoder::_encode_polarity(const AigNode& aig, Polarity pol)
+{
+  // Nodes to encode with the polarities in which their literal is used.
+  std::vector<std::pair<AigNode, uint8_t>> visit;
+  std::vector<AigNode> children;
+  visit.emplace_back(aig, pol);
+  do
+  {
+    auto [cur, lit_pol] = visit.back();
+    visit.pop_back();
+    resize(cur);
+
+    // Polarity of the node's variable, which is flipped for negated literals.
+    uint8_t var_pol = lit_pol;
+    if (cur.is_negated())
+    {
+      var_pol = ((lit_pol & POSITIVE) << 1) | ((lit_pol & NEGATIVE) >> 1);
+    }
+
+    bool encoded    = is_encoded(cur);
+    uint8_t missing = set_encoded(cur, var_pol);
+    if (!missing)
+    {
+      continue;
+    }
+
+    if (cur.is_true() || cur.is_false())
+    {
+      if (!encoded)
+      {
+        add_clause({std::abs(literal(cur))});
+        ++d_statistics.num_clauses;
+        ++d_statistics.num_literals;
+      }
+      continue;
+    }
+    if (cur.is_const())
+    {
+      continue;
+    }
+    assert(cur.is_and());
+
+    auto x = std::abs(literal(cur));
+    children.clear();
+    if (is_ite(cur, children))
+    {
+      // Encode x -> ite(c,a,b) and/or ite(c,a,b) -> x
+      auto c = literal(children[0]);   // cond
+      auto a = -literal(children[1]);  // then
+      auto b = -literal(children[2]);  // else
+
+      if (missing & POSITIVE)
+      {
+        add_clause({-x, -c, a});
+        add_clause({-x, c, b});
+        d_statistics.num_clauses += 2;
+        d_statistics.num_literals += 6;
+      }
+      if (missing & NEGATIVE)
+      {
+        add_clause({x, -c, -a});
+        add_clause({x, c, -b});
+        d_statistics.num_clauses += 2;
+        d_statistics.num_literals += 6;
+      }
+      // The condition occurs in both polarities, the branches in the
+      // polarity of x. Note that children[1] and children[2] are ~a and ~b.
+      visit.emplace_back(children[0], BOTH);
+      uint8_t branch_pol =
+          ((missing & POSITIVE) << 1) | ((missing & NEGATIVE) >> 1);
+      visit.emplace_back(children[1], branch_pol);
+      visit.emplace_back(children[2], branch_pol);
+    }
+    else
+    {
+      // Encode x -> a /\ b and/or a /\ b -> x
+      auto a = literal(cur[0]);
+      auto b = literal(cur[1]);
+
+      if (missing & POSITIVE)
+      {
+        add_clause({-x, a});
+        add_clause({-x, b});
+        d_statistics.num_clauses += 2;
+        d_statistics.num_literals += 4;
+      }
+      if (missing & NEGATIVE)
+      {
+        add_clause({x, -a, -b});
+        d_statistics.num_clauses += 1;
+        d_statistics.num_literals += 3;
+      }
+      // The children occur in the polarity of x.
+      visit.emplace_back(cur[0], missing);
+      visit.emplace_back(cur[1], missing);
+    }
+  } while (!visit.empty());
+}
+
 void
 AigCnfEncoder::resize(const AigNode& aig)
 {
@@ -278,7 +476,7 @@ AigCnfEncoder::resize(const AigNode& aig)
   {
     return;
   }
-  d_aig_encoded.resize(pos + 1, false);
+  d_aig_encoded.resize(pos + 1, 0);
 }
 
 bool
@@ -287,7 +485,7 @@ AigCnfEncoder::is_encoded(const AigNode& aig) const
   size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
   if (pos < d_aig_encoded.size())
   {
-    return d_aig_encoded[pos];
+    return d_aig_encoded[pos] != 0;
   }
   return false;
 }
@@ -297,7 +495,25 @@ AigCnfEncoder::set_encoded(const AigNode& aig)
 {
   size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
   assert(pos < d_aig_encoded.size());
-  d_aig_encoded[pos] = true;
+  d_aig_encoded[pos] = BOTH;
   ++d_statistics.num_vars;
 }
+
+uint8_t
+AigCnfEncoder::set_encoded(const AigNode& aig, uint8_t pol)
+{
+  size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
+  assert(pos < d_aig_encoded.size());
+  uint8_t& encoded = d_aig_encoded[pos];
+  uint8_t missing  = pol & ~encoded;
+  if (missing)
+  {
+    if (!encoded)
+    {
+      ++d_statistics.num_vars;
+    }
+    encoded |= missing;
+  }
+  return missing;
+}
 }  // namespace bzla::bitblast
@@ -10,6 +10,9 @@
 
 #ifndef BZLA__BITBLAST_AIG_CNF_H
 #define BZLA__BITBLAST_AIG_CNF_H
+
+#include <vector>
+
 #include "bitblast/aig/aig_manager.h"
 
 namespace bzla::bitblast {
@@ -31,8 +34,30 @@ class SatInterface
    * @param literals List of literals to be added (without terminating 0).
    */
   virtual void add_clause(const std::initializer_list<int64_t>& literals) = 0;
+  /**
+   * Add a set of clauses.
+   *
+   * @param clauses The literals of the clauses, each clause is terminated
+   *                by 0. The buffer is reused by the caller, i.e., it is only
+   *                valid for the duration of the call.
+   */
+  virtual void add_clauses(const std::vector<int32_t>& clauses)
+  {
+    for (int32_t lit : clauses)
+    {
+      add(lit);
+    }
+  }
 
   virtual bool value(int64_t lit) = 0;
+
+  /**
+   * Freeze variable of given literal, i.e., prevent the SAT solver from
+   * eliminating it.
+   */
+  virtual void freeze(int64_t lit) { (void) lit; }
+  /** Melt variable of given literal that was previously frozen. */
+  virtual void melt(int64_t lit) { (void) lit; }
 };
 
 class AigCnfEncoder
@@ -45,7 +70,26 @@ class AigCnfEncoder
     uint64_t num_literals = 0;  // Number of added literals
   };
 
-  AigCnfEncoder(SatInterface& sat_solver) : d_sat_solver(sat_solver){};
+  /** The polarity in which an encoded AIG node is used. */
+  enum Polarity : uint8_t
+  {
+    POSITIVE = 1,
+    NEGATIVE = 2,
+    BOTH     = POSITIVE | NEGATIVE,
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param sat_solver The SAT solver to add the clauses to.
+   * @param use_polarity True to enable polarity-aware (Plaisted-Greenbaum)
+   *        encoding. In this mode, gates are only encoded in the polarities
+   *        they are used in, and are incrementally encoded in the missing
+   *        polarity if a later encode() call requires it. As a consequence,
+   *        value() is only reliable for AIG constants (inputs).
+   */
+  AigCnfEncoder(SatInterface& sat_solver, bool use_polarity = false)
+      : d_sat_solver(sat_solver), d_use_polarity(use_polarity){};
 
   /**
    * Recursively encodes AIG node to CNF.
@@ -56,25 +100,106 @@ class AigCnfEncoder
    * */
   void encode(const AigNode& node, bool top_level = false);
 
+  /**
+   * Recursively encodes AIG node to CNF such that it can be used in the
+   * given polarity, e.g., POSITIVE for nodes that are only assumed to be
+   * true. Without polarity-aware encoding, this is equivalent to
+   * encode(node).
+   *
+   * @param node The AIG node to encode.
+   * @param pol The polarity in which `node` is used.
+   */
+  void encode(const AigNode& node, Polarity pol);
+
   int32_t value(const AigNode& node);
 
+  /**
+   * Get the SAT literal of given AIG node.
+   *
+   * SAT variables correspond to AIG node ids, except for nodes that reuse
+   * the id of a garbage collected node, which get a fresh SAT variable.
+   *
+   * @param node The AIG node.
+   * @return The SAT literal, negated if `node` is negated.
+   */
+  int64_t literal(const AigNode& node);
+
+  /** Checks whether `aig` was already encoded (in any polarity). */
+  bool is_encoded(const AigNode& aig) const;
+
+  /**
+   * Configure whether the SAT variables of subsequently encoded nodes are
+   * frozen until the nodes are garbage collected.
+   */
+  void set_freeze(bool freeze) { d_freeze = freeze; }
+
+  /**
+   * Remove the encodings of all nodes with an id greater than `num_nodes`,
+   * which were deleted via AigManager::garbage_collect(). Their SAT
+   * variables are melted and not reused.
+   *
+   * @param num_nodes The number of nodes kept by the AIG manager.
+   */
+  void garbage_collect(uint32_t num_nodes);
+
   /** @return CNF statistics. */
   const Statistics& statistics() const;
 
  private:
+  /** Maximum number of buffered literals before flushing to the solver. */
+  static constexpr size_t s_max_buffered_literals = 1 << 16;
+
+  /** Add clause to the clause buffer. */
+  void add_clause(const std::initializer_list<int64_t>& literals);
+  /** Add buffered clauses to the SAT solver. */
+  void flush();
   /** Encode AIG to CNF. */
   void _encode(const AigNode& node);
+  /**
+   * Encode AIG to CNF in polarity-aware mode.
+   * @param node The AIG node to encode.
+   * @param pol The polarity in which `node` is used.
+   */
+  void _encode_polarity(const AigNode& node, Polarity pol);
   /** Ensure that `d_aig_encoded` is big enough to store `aig`. */
   void resize(const AigNode& aig);
-  /** Checks whether `aig` was already encoded. */
-  bool is_encoded(const AigNode& aig) const;
-  /** Mark `aig` as encoded. */
+  /** Mark `aig` as encoded in both polarities. */
   void set_encoded(const AigNode& aig);
+  /**
+   * Mark `aig` as encoded in given polarity.
+   * @return The polarities of `pol` that were not encoded yet.
+   */
+  uint8_t set_encoded(const AigNode& aig, uint8_t pol);
 
-  /** Maps AIG id to flag that indicates whether the AIG was already encoded. */
-  std::vector<bool> d_aig_encoded;
+  /**
+   * Maps AIG id to the polarities the AIG was already encoded in, 0 if the
+   * AIG was not encoded yet.
+   */
+  std::vector<uint8_t> d_aig_encoded;
   /** SAT solver. */
   SatInterface& d_sat_solver;
+  /**
+   * Buffer of 0-terminated clauses that were not added to the SAT solver
+   * yet, clauses are added in batches to avoid a call per literal.
+   * SAT variables are bounded by the number of AIG nodes, which fits into
+   * 32 bits, hence literals are stored in the format of the SAT solver.
+   */
+  std::vector<int32_t> d_clauses;
+  /** True if polarity-aware encoding is enabled. */
+  bool d_use_polarity;
+  /** Maps AIG id to SAT variable, 0 if not assigned yet. */
+  std::vector<uint32_t> d_vars;
+  /** Maps AIG id to 1 if its SAT variable is frozen. */
+  std::vector<uint8_t> d_frozen;
+  /** True if SAT variables of newly encoded nodes are frozen. */
+  bool d_freeze = false;
+  /**
+   * The smallest AIG id that was garbage collected, nodes with smaller ids
+   * use their id as SAT variable.
+   */
+  uint32_t d_min_deleted_id = UINT32_MAX;
+  /** The largest SAT variable assigned so far. */
+  uint32_t d_max_var = 0;
   /** CNF statistics. */
   Statistics d_statistics;
 };
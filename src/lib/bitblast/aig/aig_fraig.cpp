@@ -0,0 +1,423 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_fraig.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace bzla::bitblast {
+
+namespace {
+
+/** Key for class refinement: the old class and the normalized signature. */
+struct ClassKey
+{
+  uint32_t d_class;
+  uint64_t d_sig;
+
+  bool operator==(const ClassKey& other) const
+  {
+    return d_class == other.d_class && d_sig == other.d_sig;
+  }
+};
+
+struct ClassKeyHash
+{
+  size_t operator()(const ClassKey& key) const
+  {
+    return key.d_sig * 547789289u + key.d_class * 786695309u;
+  }
+};
+
+constexpr uint32_t s_not_in_cone = std::numeric_limits<uint32_t>::max();
+
+/** @return The (unsigned) id of given AIG node. */
+uint32_t
+var(const AigNode& aig)
+{
+  return static_cast<uint32_t>(std::abs(aig.get_id()));
+}
+
+bool
+is_null(const AigNode& aig)
+{
+  return aig.get_id() == 0;
+}
+
+}  // namespace
+
+/* --- AigFraig public ------------------------------------------------------ */
+
+AigFraig::AigFraig(AigManager& amgr,
+                   FraigSatInterface& sat_solver,
+                   uint64_t conflict_limit,
+                   uint32_t seed)
+    : d_amgr(amgr),
+      d_sat_solver(sat_solver),
+      d_cnf_encoder(sat_solver),
+      d_conflict_limit(conflict_limit),
+      d_simulator(amgr, s_num_words, seed)
+{
+}
+
+AigFraig::~AigFraig() {}
+
+std::vector<AigNode>
+AigFraig::sweep(const std::vector<AigNode>& roots)
+{
+  std::vector<AigNode> new_roots;
+  for (const AigNode& root : roots)
+  {
+    if (!is_swept(root))
+    {
+      new_roots.push_back(root);
+    }
+  }
+  if (!new_roots.empty())
+  {
+    collect_cone(new_roots);
+    fraig();
+    rebuild();
+  }
+
+  std::vector<AigNode> res;
+  for (const AigNode& root : roots)
+  {
+    assert(is_swept(root));
+    const AigNode& swept = d_swept[var(root)];
+    res.push_back(root.is_negated() ? d_amgr.mk_not(swept) : swept);
+  }
+  return res;
+}
+
+void
+AigFraig::garbage_collect(uint32_t num_nodes)
+{
+  d_cnf_encoder.garbage_collect(num_nodes);
+  d_simulator.garbage_collect(num_nodes);
+
+  for (const AigNode& aig : d_cone)
+  {
+    d_index[var(aig)] = s_not_in_cone;
+  }
+  d_cone.clear();
+  if (num_nodes + 1 < d_index.size())
+  {
+    d_index.resize(num_nodes + 1);
+  }
+  if (num_nodes + 1 < d_swept.size())
+  {
+    d_swept.resize(num_nodes + 1);
+  }
+
+  d_roots.erase(std::remove_if(d_roots.begin(),
+                               d_roots.end(),
+                               [num_nodes](const AigNode& aig) {
+                                 return var(aig) > num_nodes;
+                               }),
+                d_roots.end());
+  // Remaining nodes may have been swept to deleted nodes, these are swept
+  // again if required.
+  for (AigNode& swept : d_swept)
+  {
+    if (!is_null(swept) && var(swept) > num_nodes)
+    {
+      swept = AigNode();
+    }
+  }
+}
+
+const AigFraig::Statistics&
+AigFraig::statistics() const
+{
+  return d_statistics;
+}
+
+/* --- AigFraig private ----------------------------------------------------- */
+
+void
+AigFraig::fraig()
+{
+  size_t size = d_cone.size();
+  d_class.assign(size, 0);
+  d_class_rep.assign(1, 0);
+  d_merged.assign(size, AigNode());
+
+  // Initial candidate classes via simulation. Nodes created since the last
+  // sweep are simulated with random input patterns, nodes of previous sweeps
+  // keep their patterns, which include the counterexamples of previous
+  // sweeps.
+  d_simulator.simulate();
+  for (uint32_t w = 0; w < s_num_words; ++w)
+  {
+    refine_classes(w);
+  }
+
+  // Nodes for which the conflict limit was reached are not checked again.
+  std::vector<bool> skip(size, false);
+  for (uint32_t round = 0; round < s_max_rounds; ++round)
+  {
+    ++d_statistics.num_rounds;
+    // Counterexamples are collected into the first bits of a simulation word
+    // other than word 0, the remaining bits are random.
+    uint32_t word = 1 + round % (s_num_words - 1);
+    for (const AigNode& aig : d_cone)
+    {
+      if (aig.is_const())
+      {
+        d_simulator.randomize_input(aig, word);
+      }
+    }
+    uint32_t num_cex = 0;
+    for (size_t i = 0; i < size && num_cex < 64; ++i)
+    {
+      const AigNode& node = d_cone[i];
+      if (!node.is_and() || !is_null(d_swept[var(node)])
+          || !is_null(d_merged[i]) || skip[i])
+      {
+        continue;
+      }
+      uint32_t rep_idx = d_class_rep[d_class[i]];
+      if (rep_idx == i)
+      {
+        continue;
+      }
+      AigNode rep = d_cone[rep_idx];
+      if ((d_simulator.value(node, 0) ^ d_simulator.value(rep, 0)) & 1)
+      {
+        rep = d_amgr.mk_not(rep);
+      }
+
+      auto res = prove(node, rep);
+      if (res == FraigSatInterface::Result::UNSAT)
+      {
+        d_merged[i] = rep;
+        ++d_statistics.num_merged;
+        // Add the equivalence to simplify subsequent checks.
+        int64_t lit_node = d_cnf_encoder.literal(node);
+        int64_t lit_rep  = d_cnf_encoder.literal(rep);
+        d_sat_solver.add_clause({-lit_node, lit_rep});
+        d_sat_solver.add_clause({lit_node, -lit_rep});
+      }
+      else if (res == FraigSatInterface::Result::SAT)
+      {
+        add_cex(node, rep, word, num_cex++);
+      }
+      else
+      {
+        skip[i] = true;
+      }
+    }
+    d_simulator.resimulate();
+    if (num_cex == 0)
+    {
+      break;
+    }
+    refine_classes(word);
+  }
+}
+
+void
+AigFraig::collect_cone(const std::vector<AigNode>& roots)
+{
+  for (const AigNode& aig : d_cone)
+  {
+    d_index[var(aig)] = s_not_in_cone;
+  }
+  d_cone.clear();
+
+  // The roots of previous sweeps are included such that new nodes can be
+  // merged into nodes of previous sweeps.
+  d_roots.insert(d_roots.end(), roots.begin(), roots.end());
+  std::vector<AigNode> visit{d_amgr.mk_true()};
+  visit.insert(visit.end(), d_roots.begin(), d_roots.end());
+  do
+  {
+    AigNode cur = visit.back();
+    visit.pop_back();
+    if (cur.is_negated())
+    {
+      cur = d_amgr.mk_not(cur);
+    }
+
+    uint32_t id = var(cur);
+    if (id >= d_index.size())
+    {
+      d_index.resize(id + 1, s_not_in_cone);
+    }
+    if (d_index[id] != s_not_in_cone)
+    {
+      continue;
+    }
+    d_index[id] = 0;
+    d_cone.push_back(cur);
+    if (cur.is_and())
+    {
+      visit.push_back(cur[0]);
+      visit.push_back(cur[1]);
+    }
+  } while (!visit.empty());
+
+  // Children have smaller ids than their parents, sorting by id yields a
+  // topological order.
+  std::sort(d_cone.begin(), d_cone.end(), [](const auto& a, const auto& b) {
+    return a.get_id() < b.get_id();
+  });
+  for (size_t i = 0, size = d_cone.size(); i < size; ++i)
+  {
+    d_index[var(d_cone[i])] = i;
+  }
+  if (d_swept.size() < d_index.size())
+  {
+    d_swept.resize(d_index.size());
+  }
+}
+
+void
+AigFraig::refine_classes(uint32_t word)
+{
+  std::unordered_map<ClassKey, uint32_t, ClassKeyHash> classes;
+  d_class_rep.clear();
+  for (size_t i = 0, size = d_cone.size(); i < size; ++i)
+  {
+    // Normalize the signature such that the first pattern is 0, nodes that
+    // are equivalent modulo negation end up in the same class.
+    uint64_t sig = d_simulator.value(d_cone[i], word);
+    if (d_simulator.value(d_cone[i], 0) & 1)
+    {
+      sig = ~sig;
+    }
+    auto [it, inserted] =
+        classes.emplace(ClassKey{d_class[i], sig}, d_class_rep.size());
+    if (inserted)
+    {
+      d_class_rep.push_back(i);
+    }
+    d_class[i] = it->second;
+  }
+}
+
+FraigSatInterface::Result
+AigFraig::prove(const AigNode& a, const AigNode& b)
+{
+  d_cnf_encoder.encode(a);
+  d_cnf_encoder.encode(b);
+
+  int64_t ida = d_cnf_encoder.literal(a);
+  int64_t idb = d_cnf_encoder.literal(b);
+  // Check both a & ~b and ~a & b for satisfiability.
+  std::pair<int64_t, int64_t> checks[] = {{ida, -idb}, {-ida, idb}};
+  for (const auto& [lita, litb] : checks)
+  {
+    ++d_statistics.num_sat_checks;
+    d_sat_solver.assume(lita);
+    d_sat_solver.assume(litb);
+    auto res = d_sat_solver.solve(d_conflict_limit);
+    if (res == FraigSatInterface::Result::SAT)
+    {
+      ++d_statistics.num_cex;
+      return res;
+    }
+    if (res == FraigSatInterface::Result::UNKNOWN)
+    {
+      ++d_statistics.num_unknown;
+      return res;
+    }
+  }
+  return FraigSatInterface::Result::UNSAT;
+}
+
+void
+AigFraig::add_cex(const AigNode& a,
+                  const AigNode& b,
+                  uint32_t word,
+                  uint32_t bit)
+{
+  assert(bit < 64);
+  uint64_t mask = UINT64_C(1) << bit;
+  std::unordered_set<uint32_t> cache;
+  std::vector<AigNode> visit{a, b};
+  do
+  {
+    AigNode cur = visit.back();
+    visit.pop_back();
+    auto [it, inserted] = cache.insert(var(cur));
+    if (!inserted)
+    {
+      continue;
+    }
+    if (cur.is_and())
+    {
+      visit.push_back(cur[0]);
+      visit.push_back(cur[1]);
+    }
+    else if (cur.is_const())
+    {
+      if (cur.is_negated())
+      {
+        cur = d_amgr.mk_not(cur);
+      }
+      uint64_t val = d_simulator.value(cur, word);
+      if (d_sat_solver.value(std::abs(d_cnf_encoder.literal(cur))))
+      {
+        val |= mask;
+      }
+      else
+      {
+        val &= ~mask;
+      }
+      d_simulator.set_input(cur, word, val);
+    }
+  } while (!visit.empty());
+}
+
+void
+AigFraig::rebuild()
+{
+  auto swept = [this](const AigNode& aig) {
+    const AigNode& res = d_swept[var(aig)];
+    assert(!is_null(res));
+    return aig.is_negated() ? d_amgr.mk_not(res) : res;
+  };
+
+  for (size_t i = 0, size = d_cone.size(); i < size; ++i)
+  {
+    const AigNode& aig = d_cone[i];
+    uint32_t id        = var(aig);
+    if (!is_null(d_swept[id]))
+    {
+      continue;
+    }
+    if (!is_null(d_merged[i]))
+    {
+      d_swept[id] = swept(d_merged[i]);
+    }
+    else if (aig.is_and())
+    {
+      d_swept[id] = d_amgr.mk_and(swept(aig[0]), swept(aig[1]));
+    }
+    else
+    {
+      d_swept[id] = aig;
+    }
+  }
+}
+
+bool
+AigFraig::is_swept(const AigNode& aig) const
+{
+  return var(aig) < d_swept.size() && !is_null(d_swept[var(aig)]);
+}
+
+}  // namespace bzla::bitblast
@@ -0,0 +1,176 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BITBLAST_AIG_FRAIG_H
+#define BZLA__BITBLAST_AIG_FRAIG_H
+
+#include <vector>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig/aig_manager.h"
+#include "bitblast/aig/aig_simulator.h"
+
+namespace bzla::bitblast {
+
+/** SAT interface used by AigFraig to prove node equivalences. */
+class FraigSatInterface : public SatInterface
+{
+ public:
+  enum class Result
+  {
+    SAT,
+    UNSAT,
+    UNKNOWN,
+  };
+
+  /** Assume literal for the next solve() call. */
+  virtual void assume(int64_t lit) = 0;
+  /**
+   * Solve under the current assumptions.
+   * @param conflict_limit The maximum number of conflicts, the call returns
+   *                       UNKNOWN if the limit is reached.
+   */
+  virtual Result solve(uint64_t conflict_limit) = 0;
+};
+
+/**
+ * Functionally reduced AIG construction via SAT sweeping.
+ *
+ * Candidate equivalences between AIG nodes (modulo negation) are determined
+ * via bit-parallel random simulation (see AigSimulator) and proved with budgeted SAT calls on a
+ * separate CNF encoding of the AIG. Counterexamples of failed proofs are
+ * used as additional simulation patterns to refine the candidate classes.
+ * Proved equivalences are applied by rebuilding the AIG such that each class
+ * is represented by its node with the smallest id.
+ *
+ * Nodes are only checked once, subsequent calls to sweep() may merge new
+ * nodes into nodes of earlier calls, which allows incremental use.
+ *
+ * [1] FRAIGs: A Unifying Representation for Logic Synthesis and Verification.
+ *     Alan Mishchenko, Satrajit Chatterjee, Roland Jiang, Robert Brayton.
+ */
+class AigFraig
+{
+ public:
+  struct Statistics
+  {
+    uint64_t num_merged     = 0;  // Number of merged AND gates
+    uint64_t num_sat_checks = 0;  // Number of SAT calls
+    uint64_t num_cex        = 0;  // Number of counterexamples
+    uint64_t num_unknown    = 0;  // Number of SAT calls out of budget
+    uint64_t num_rounds     = 0;  // Number of refinement rounds
+  };
+
+  /**
+   * Constructor.
+   * @param amgr           The AIG manager the nodes to sweep belong to.
+   * @param sat_solver     The SAT solver used to prove equivalences.
+   * @param conflict_limit The conflict limit per SAT call.
+   * @param seed           The seed for the random simulation patterns.
+   */
+  AigFraig(AigManager& amgr,
+           FraigSatInterface& sat_solver,
+           uint64_t conflict_limit = 1000,
+           uint32_t seed           = 42);
+  ~AigFraig();
+
+  /**
+   * Sweep the cones of the given AIG nodes.
+   * @param roots The AIG nodes to sweep.
+   * @return The swept AIG nodes, in the same order as `roots`. Each swept
+   *         node is equivalent to its corresponding root.
+   */
+  std::vector<AigNode> sweep(const std::vector<AigNode>& roots);
+
+  /**
+   * Remove all references to nodes with an id greater than `num_nodes`,
+   * which were deleted via AigManager::garbage_collect().
+   * @param num_nodes The number of nodes kept by the AIG manager.
+   */
+  void garbage_collect(uint32_t num_nodes);
+
+  /** @return FRAIG statistics. */
+  const Statistics& statistics() const;
+
+ private:
+  /**
+   * Number of simulation words per node. Word 0 determines the polarity of
+   * the nodes in a candidate class, the remaining words are reused for
+   * counterexamples.
+   */
+  static constexpr uint32_t s_num_words = 4;
+  /** Maximum number of counterexample refinement rounds per sweep. */
+  static constexpr uint32_t s_max_rounds = 16;
+
+  /** Collect the cone of `roots` and all previous roots, sorted by id. */
+  void collect_cone(const std::vector<AigNode>& roots);
+  /**
+   * Determine candidate classes of the nodes in the cone via simulation and
+   * merge the nodes that are proved to be equivalent.
+   */
+  void fraig();
+  /** Refine the candidate classes by given simulation word. */
+  void refine_classes(uint32_t word);
+  /**
+   * Check whether `a` and `b` are equivalent.
+   * @return UNSAT if `a` and `b` are equivalent, SAT if they are not and
+   *         UNKNOWN if the conflict limit was reached.
+   */
+  FraigSatInterface::Result prove(const AigNode& a, const AigNode& b);
+  /**
+   * Store the counterexample of the last SAT call as bit `bit` of simulation
+   * word `word` of the inputs in the cones of `a` and `b`.
+   */
+  void add_cex(const AigNode& a,
+               const AigNode& b,
+               uint32_t word,
+               uint32_t bit);
+  /** Rebuild the cone with the merged nodes replaced. */
+  void rebuild();
+
+  /** @return True if given node was already swept. */
+  bool is_swept(const AigNode& aig) const;
+
+  /** The AIG manager. */
+  AigManager& d_amgr;
+  /** SAT solver. */
+  FraigSatInterface& d_sat_solver;
+  /** The CNF encoder for `d_sat_solver`. */
+  AigCnfEncoder d_cnf_encoder;
+  /** The conflict limit per SAT call. */
+  uint64_t d_conflict_limit;
+  /** The simulator for all nodes of `d_amgr`. */
+  AigSimulator d_simulator;
+
+  /**
+   * Maps node id to its swept node, null if the node was not swept yet.
+   * Persists across calls to sweep().
+   */
+  std::vector<AigNode> d_swept;
+
+  /** The roots of all sweeps. */
+  std::vector<AigNode> d_roots;
+  /** The nodes in the cone of the current sweep, sorted by id. */
+  std::vector<AigNode> d_cone;
+  /** Maps node id to index in d_cone. */
+  std::vector<uint32_t> d_index;
+  /** The candidate class of each node in d_cone. */
+  std::vector<uint32_t> d_class;
+  /** The representative (index in d_cone) of each class. */
+  std::vector<uint32_t> d_class_rep;
+  /** The node each node in d_cone was merged into, null if not merged. */
+  std::vector<AigNode> d_merged;
+
+  Statistics d_statistics;
+};
+
+}  // namespace bzla::bitblast
+
+#endif
@@ -16,106 +16,101 @@ namespace bzla::bitblast {
 
 // AigNodeUniqueTable
 
-AigNodeUniqueTable::AigNodeUniqueTable() { d_buckets.resize(16, nullptr); }
+AigNodeUniqueTable::AigNodeUniqueTable() { d_slots.resize(16, 0); }
 
-std::pair<bool, AigNodeData*>
-AigNodeUniqueTable::insert(AigNodeData* d)
+uint32_t&
+AigNodeUniqueTable::find(const std::vector<AigNodeData>& data,
+                         uint32_t left,
+                         uint32_t right)
 {
-  size_t h         = hash(d->d_left, d->d_right);
-  AigNodeData* cur = d_buckets[h];
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
-
-  // Check collision chain.
-  while (cur)
+  size_t mask = d_slots.size() - 1;
+  size_t h    = hash(left, right);
+  while (d_slots[h])
   {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
+    const AigNodeData& d = data[d_slots[h] - 1];
+    if (d.d_left == left && d.d_right == right)
     {
-      return std::make_pair(false, cur);
+      break;
     }
-    cur = cur->next;
+    h = (h + 1) & mask;
   }
+  return d_slots[h];
+}
 
-  if (d_num_elements == d_buckets.capacity())
+void
+AigNodeUniqueTable::insert(const std::vector<AigNodeData>& data,
+                           uint32_t& slot,
+                           uint32_t id)
+{
+  assert(slot == 0);
+  assert(id > 0);
+  slot = id;
+  ++d_num_elements;
+  // Keep load factor below 1/2 to keep probe sequences short.
+  if (2 * d_num_elements > d_slots.size())
   {
-    resize();
-    h = hash(d->d_left, d->d_right);
+    resize(data);
   }
-  assert(d->next == nullptr);
-  d->next      = d_buckets[h];
-  d_buckets[h] = d;
-
-  ++d_num_elements;
-  return std::make_pair(true, d);
 }
 
 void
-AigNodeUniqueTable::erase(const AigNodeData* d)
+AigNodeUniqueTable::erase(const std::vector<AigNodeData>& data, uint32_t id)
 {
-  size_t h          = hash(d->d_left, d->d_right);
-  AigNodeData* cur  = d_buckets[h];
-  AigNodeData* prev = nullptr;
-  assert(cur != nullptr);
-
-  // Should not happen
-  if (cur == nullptr)
+  size_t mask          = d_slots.size() - 1;
+  const AigNodeData& d = data[id - 1];
+  size_t h             = hash(d.d_left, d.d_right);
+  while (d_slots[h] != id)
   {
-    return;
+    assert(d_slots[h]);
+    h = (h + 1) & mask;
   }
+  d_slots[h] = 0;
+  --d_num_elements;
 
-  // Find data in collision chain.
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
-  while (cur)
+  // Backward shift deletion: move subsequent entries of the probe sequence
+  // into the freed slot if it lies between their home slot and their
+  // current slot.
+  size_t free = h;
+  for (size_t i = (h + 1) & mask; d_slots[i]; i = (i + 1) & mask)
   {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
+    const AigNodeData& di = data[d_slots[i] - 1];
+    size_t home           = hash(di.d_left, di.d_right);
+    if (((i - home) & mask) >= ((i - free) & mask))
     {
-      break;
+      d_slots[free] = d_slots[i];
+      d_slots[i]    = 0;
+      free          = i;
     }
-    prev = cur;
-    cur  = cur->next;
-  }
-  assert(cur);
-
-  // Update collision chain.
-  if (prev == nullptr)
-  {
-    d_buckets[h] = cur->next;
-  }
-  else
-  {
-    prev->next = cur->next;
   }
-  --d_num_elements;
 }
 
 size_t
-AigNodeUniqueTable::hash(const AigNode& left, const AigNode& right)
+AigNodeUniqueTable::hash(uint32_t left, uint32_t right) const
 {
-  size_t lhs = static_cast<size_t>(std::abs(left.get_id()));
-  size_t rhs = static_cast<size_t>(std::abs(right.get_id()));
-  size_t h   = 547789289u * lhs + 786695309u * rhs;
-  return h & (d_buckets.capacity() - 1);
+  size_t h = 547789289u * static_cast<size_t>(left)
+             + 786695309u * static_cast<size_t>(right);
+  return h & (d_slots.size() - 1);
 }
 
 void
-AigNodeUniqueTable::resize()
+AigNodeUniqueTable::resize(const std::vector<AigNodeData>& data)
 {
-  auto buckets = d_buckets;
-
-  d_buckets.clear();
-  d_buckets.resize(d_buckets.capacity() * 2, nullptr);
+  std::vector<uint32_t> slots(d_slots.size() * 2, 0);
+  d_slots.swap(slots);
 
   // Rehash elements.
-  for (auto cur : buckets)
+  size_t mask = d_slots.size() - 1;
+  for (uint32_t id : slots)
   {
-    while (cur)
+    if (id)
     {
-      size_t h     = hash(cur->d_left, cur->d_right);
-      auto next    = cur->next;
-      cur->next    = d_buckets[h];
-      d_buckets[h] = cur;
-      cur          = next;
+      const AigNodeData& d = data[id - 1];
+      size_t h             = hash(d.d_left, d.d_right);
+      while (d_slots[h])
+      {
+        h = (h + 1) & mask;
+      }
+      d_slots[h] = id;
     }
   }
 }
@@ -123,10 +118,11 @@ AigNodeUniqueTable::resize()
 // BitNodeInterface<AigNode>
 
 AigManager::AigManager()
-    : d_true(new_data(), false), d_false(d_true.d_data, true)
 {
-  assert(d_true.get_id() == AigNode::s_true_id);
-  assert(d_false.get_id() == -AigNode::s_true_id);
+  [[maybe_unused]] uint32_t id = new_data();
+  assert(id == AigNode::s_true_id);
+  assert(mk_true().get_id() == AigNode::s_true_id);
+  assert(mk_false().get_id() == -AigNode::s_true_id);
 }
 
 AigManager::~AigManager() {}
@@ -138,37 +134,50 @@ AigManager::statistics() const
 }
 
 void
-AigManager::init_id(AigNodeData* d)
+AigManager::garbage_collect(uint32_t num_nodes)
 {
-  assert(d_aig_id_counter < INT64_MAX);
-  assert(d != nullptr);
-  assert(d->d_id == 0);
-  d_node_data.emplace_back(d);
-  assert(d_node_data.size() == static_cast<size_t>(d_aig_id_counter));
-  d->d_id = d_aig_id_counter++;
-  if (!d->d_left.is_null())
+  assert(num_nodes >= AigNode::s_true_id);
+  // Delete nodes in reverse order, parents before their children.
+  for (uint32_t id = d_node_data.size(); id > num_nodes; --id)
   {
-    ++d->d_left.d_data->d_parents;
-    ++d->d_right.d_data->d_parents;
+    const AigNodeData& d = data(id);
+    assert(d.d_parents == 0);
+    if (d.d_left)
+    {
+      d_unique_table.erase(d_node_data, id);
+      --d_node_data[(d.d_left >> 1) - 1].d_parents;
+      --d_node_data[(d.d_right >> 1) - 1].d_parents;
+      --d_statistics.num_ands;
+    }
+    else
+    {
+      --d_statistics.num_consts;
+    }
+    ++d_statistics.num_deleted;
+  }
+  if (num_nodes < d_node_data.size())
+  {
+    d_node_data.resize(num_nodes);
   }
 }
 
-AigNodeData*
-AigManager::find_or_create_and(const AigNode& left, const AigNode& right)
+uint32_t
+AigManager::find_or_create_and(int64_t left, int64_t right)
 {
-  assert(std::abs(left.get_id()) < std::abs(right.get_id()));
-  AigNodeData* d          = new AigNodeData(this, left, right);
-  auto [inserted, lookup] = d_unique_table.insert(d);
-  if (!inserted)
+  assert(std::abs(left) < std::abs(right));
+  uint32_t left_lit  = AigNode::id_to_lit(left);
+  uint32_t right_lit = AigNode::id_to_lit(right);
+  uint32_t& slot     = d_unique_table.find(d_node_data, left_lit, right_lit);
+  if (slot)
   {
     ++d_statistics.num_shared;
-    delete d;
-    return lookup;
+    return slot;
   }
 
-  init_id(d);
+  uint32_t id = new_data(left_lit, right_lit);
+  d_unique_table.insert(d_node_data, slot, id);
   ++d_statistics.num_ands;
-  return d;
+  return id;
 }
 
 AigNode
@@ -208,7 +217,7 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   result:    0
     if (left == false_id || right == false_id || left == -right)
     {
-      return d_false;
+      return mk_false();
     }
 
     const auto [a, b] = get_children(left);
@@ -226,11 +235,11 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     //   result:    0
     if (!left_is_neg && left_is_and && (a == -right || b == -right))
     {
-      return d_false;
+      return mk_false();
     }
     if (!right_is_neg && right_is_and && (c == -left || d == -left))
     {
-      return d_false;
+      return mk_false();
     }
 
     // Contradiction rule (symmetric)
@@ -240,7 +249,7 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
     if (!left_is_neg && !right_is_neg && left_is_and && right_is_and
         && (a == -c || a == -d || b == -c || b == -d))
     {
-      return d_false;
+      return mk_false();
     }
 
     // Subsumption rule (asymmetric)
@@ -400,94 +409,38 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
   }
 
   // create AND with left, right
-  AigNodeData* d = find_or_create_and(get_node(left), get_node(right));
-  return AigNode(d);
+  return get_node(find_or_create_and(left, right));
 }
 
 AigNode
-AigManager::get_node(int64_t id)
+AigManager::get_node(int64_t id) const
 {
   assert(static_cast<size_t>(std::abs(id)) <= d_node_data.size());
-  return AigNode(d_node_data[std::abs(id) - 1].get(), id < 0);
+  return AigNode(this, AigNode::id_to_lit(id));
 }
 
 std::pair<int64_t, int64_t>
 AigManager::get_children(int64_t id) const
 {
-  assert(static_cast<size_t>(std::abs(id)) <= d_node_data.size());
-  const auto& d = d_node_data[std::abs(id) - 1];
-  return {d->d_left.get_id(), d->d_right.get_id()};
-}
-
-AigNodeData*
-AigManager::new_data()
-{
-  AigNodeData* d = new AigNodeData(this);
-  init_id(d);
-  return d;
+  const AigNodeData& d = data(static_cast<uint32_t>(std::abs(id)));
+  if (d.d_left == 0)
+  {
+    return {0, 0};
+  }
+  return {AigNode(this, d.d_left).get_id(), AigNode(this, d.d_right).get_id()};
 }
 
-void
-AigManager::garbage_collect(AigNodeData* d)
+uint32_t
+AigManager::new_data(uint32_t left, uint32_t right)
 {
-  assert(d->d_refs == 0);
-
-  if (d_gc_mode)
+  assert(d_node_data.size() < (UINT32_MAX >> 1));
+  d_node_data.push_back({left, right, 0});
+  if (left)
   {
-    assert(false);
-    return;
+    ++d_node_data[(left >> 1) - 1].d_parents;
+    ++d_node_data[(right >> 1) - 1].d_parents;
   }
-
-  d_gc_mode = true;
-
-  AigNodeData *cur, *data;
-  std::vector<AigNodeData*> visit{d};
-
-  do
-  {
-    cur = visit.back();
-    visit.pop_back();
-    assert(cur->d_refs == 0);
-
-    // Decrement reference counts for children of AND nodes
-    if (!cur->d_left.is_null())
-    {
-      assert(!cur->d_right.is_null());
-
-      // Erase node data from unique table before we modify children.
-      d_unique_table.erase(cur);
-
-      data = cur->d_left.d_data;
-      --data->d_refs;
-      --data->d_parents;
-      cur->d_left.d_data = nullptr;
-      if (data->d_refs == 0)
-      {
-        visit.push_back(data);
-      }
-
-      data = cur->d_right.d_data;
-      --data->d_refs;
-      --data->d_parents;
-      cur->d_right.d_data = nullptr;
-      if (data->d_refs == 0)
-      {
-        visit.push_back(data);
-      }
-      --d_statistics.num_ands;
-    }
-    else
-    {
-      --d_statistics.num_consts;
-    }
-
-    // Delete node data
-    assert(cur->d_id > 0);
-    assert(d_node_data[static_cast<size_t>(cur->d_id) - 1]->d_id == cur->d_id);
-    d_node_data[static_cast<size_t>(cur->d_id) - 1].reset(nullptr);
-  } while (!visit.empty());
-
-  d_gc_mode = false;
+  return static_cast<uint32_t>(d_node_data.size());
 }
 
 }  // namespace bzla::bitblast
@@ -14,83 +14,118 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <memory>
 #include <vector>
 
 #include "bitblast/aig/aig_node.h"
 
 namespace bzla::bitblast {
 
-// AigNodeUniqueTable
+/**
+ * AND gate cache used for hash consing.
+ *
+ * Open-addressing hash table with linear probing that stores node ids only,
+ * the children of an entry are looked up in the node data of the manager.
+ */
 class AigNodeUniqueTable
 {
  public:
   AigNodeUniqueTable();
 
-  // AigNodeData* lookup(const AigNode& left, const AigNode& right);
-  std::pair<bool, AigNodeData*> insert(AigNodeData* d);
-  void erase(const AigNodeData* d);
+  /**
+   * Find AND gate with given children.
+   * @param data  The node data of the manager, indexed by id - 1.
+   * @param left  The literal of the left child.
+   * @param right The literal of the right child.
+   * @return The slot of the AND gate if it exists, and the empty slot where
+   *         it is to be inserted via insert() otherwise.
+   */
+  uint32_t& find(const std::vector<AigNodeData>& data,
+                 uint32_t left,
+                 uint32_t right);
+  /**
+   * Insert AND gate with given id into the slot returned by find().
+   * @param data The node data of the manager, indexed by id - 1.
+   * @param slot The slot.
+   * @param id   The id of the AND gate.
+   */
+  void insert(const std::vector<AigNodeData>& data,
+              uint32_t& slot,
+              uint32_t id);
+  /**
+   * Remove AND gate with given id.
+   * @param data The node data of the manager, indexed by id - 1.
+   * @param id   The id of the AND gate.
+   */
+  void erase(const std::vector<AigNodeData>& data, uint32_t id);
 
  private:
-  size_t hash(const AigNode& left, const AigNode& right);
-  void resize();
+  size_t hash(uint32_t left, uint32_t right) const;
+  void resize(const std::vector<AigNodeData>& data);
 
   size_t d_num_elements = 0;
-  std::vector<AigNodeData*> d_buckets;
+  /** The slots, 0 marks an empty slot. */
+  std::vector<uint32_t> d_slots;
 };
 
 class AigManager
 {
-  friend class AigNodeData;
+  friend class AigNode;
+  friend class AigSimulator;
 
  public:
   struct Statistics
   {
-    uint64_t num_ands   = 0;  // Current number of AND gates
-    uint64_t num_consts = 0;  // Current number of AIG constants
-    uint64_t num_shared = 0;  // Number of successful AND gate lookups
+    uint64_t num_ands    = 0;  // Number of AND gates
+    uint64_t num_consts  = 0;  // Number of AIG constants
+    uint64_t num_shared  = 0;  // Number of successful AND gate lookups
+    uint64_t num_deleted = 0;  // Number of garbage collected nodes
   };
 
   AigManager();
   ~AigManager();
 
-  AigNode mk_false() { return d_false; }
-  AigNode mk_true() { return d_true; }
+  AigNode mk_false() { return get_node(-AigNode::s_true_id); }
+  AigNode mk_true() { return get_node(AigNode::s_true_id); }
   AigNode mk_const()
   {
     ++d_statistics.num_consts;
-    return AigNode(new_data());
+    return AigNode(this, new_data() << 1);
   }
 
-  AigNode mk_not(const AigNode& a)
-  {
-    return AigNode(a.d_data, !a.is_negated());
-  }
+  AigNode mk_not(const AigNode& a) { return AigNode(this, a.d_lit ^ 1); }
 
   AigNode mk_and(const AigNode& a, const AigNode& b)
   {
     return rewrite_and(a, b);
   }
 
+  /** @return The number of nodes, which is also the largest node id. */
+  uint32_t num_nodes() const { return d_node_data.size(); }
+
+  /**
+   * Delete all nodes with an id greater than `num_nodes`.
+   *
+   * Since children have smaller ids than their parents, the remaining nodes
+   * are not affected. The ids of deleted nodes are reused for new nodes.
+   *
+   * @note The caller must ensure that deleted nodes are not referenced
+   *       anymore.
+   * @param num_nodes The number of nodes to keep.
+   */
+  void garbage_collect(uint32_t num_nodes);
+
   /** @return AIG statistics. */
   const Statistics& statistics() const;
 
  private:
-  /** Counter for AIG ids. */
-  int64_t d_aig_id_counter = AigNode::s_true_id;
-
-  /** Returns the next free AIG id. */
-  void init_id(AigNodeData* d);
-
   /**
-   * Find already constructed and gate with given children.
+   * Find already constructed and gate with given children or create it.
    *
    * @param left Left child of AND gate.
    * @param right Right child of AND gate.
-   * @return Pointer to existing node data or nullptr if AND gate was not yet
-   * constructed.
+   * @return The id of the AND gate.
    */
-  AigNodeData* find_or_create_and(const AigNode& left, const AigNode& right);
+  uint32_t find_or_create_and(int64_t left, int64_t right);
 
   /**
    * Implements two-level AIG rewriting from [1].
@@ -101,37 +136,64 @@ class AigManager
   AigNode rewrite_and(const AigNode& left, const AigNode& right);
 
   /** Get AigNode by id. */
-  AigNode get_node(int64_t id);
+  AigNode get_node(int64_t id) const;
 
   /** Get children ids from AND gate. */
   std::pair<int64_t, int64_t> get_children(int64_t id) const;
 
-  /**
-   * Construct a new node data.
-   */
-  AigNodeData* new_data();
+  /** Get node data of node with given (unsigned) id. */
+  const AigNodeData& data(uint32_t id) const
+  {
+    assert(id > 0 && id <= d_node_data.size());
+    return d_node_data[id - 1];
+  }
 
   /**
-   * Delete given node data.
+   * Construct a new node data.
+   * @return The id of the new node.
    */
-  void garbage_collect(AigNodeData* d);
+  uint32_t new_data(uint32_t left = 0, uint32_t right = 0);
 
-  /** Maps node id to node data and stores all created node data. */
-  std::vector<std::unique_ptr<AigNodeData>> d_node_data;
+  /** Maps node id - 1 to node data and stores all created node data. */
+  std::vector<AigNodeData> d_node_data;
   /** AND gate cache used for hash consing. */
   AigNodeUniqueTable d_unique_table;
 
-  /** AIG node representing true. */
-  AigNode d_true;
-  /** AIG node representing false. */
-  AigNode d_false;
-
-  /** Indicates whether AIG manager is in garbage collection mode. */
-  bool d_gc_mode = false;
-
   Statistics d_statistics;
 };
 
+inline bool
+AigNode::is_and() const
+{
+  return d_mgr->data(var()).d_left != 0;
+}
+
+inline bool
+AigNode::is_const() const
+{
+  return !is_and() && !is_true() && !is_false();
+}
+
+inline AigNode
+AigNode::operator[](int index) const
+{
+  assert(is_and());
+  const AigNodeData& d = d_mgr->data(var());
+  if (index == 0)
+  {
+    return AigNode(d_mgr, d.d_left);
+  }
+  assert(index == 1);
+  return AigNode(d_mgr, d.d_right);
+}
+
+inline uint32_t
+AigNode::parents() const
+{
+  assert(!is_null());
+  return d_mgr->data(var()).d_parents;
+}
+
 }  // namespace bzla::bitblast
 
 #endif
@@ -18,24 +18,26 @@
 namespace bzla::bitblast {
 
 class AigManager;
-class AigNodeData;
+class AigSimulator;
 
 /**
- * Wrapper around AigNodeData with automatic reference counting on
- * construction/destruction.
+ * Handle to an AIG node stored in the AigManager.
+ *
+ * AIG nodes are identified by AIGER-style literals, i.e., the node id shifted
+ * by one with the negation flag in the least significant bit. Handles are
+ * trivially copyable, nodes live as long as their manager or until they are
+ * deleted via AigManager::garbage_collect().
+ *
+ * @note The inline member functions that access node data are defined in
+ *       aig_manager.h.
  */
 class AigNode
 {
   friend AigManager;
-  friend AigNodeData;
+  friend AigSimulator;
 
  public:
   AigNode() = default;
-  ~AigNode();
-  AigNode(const AigNode& other);
-  AigNode& operator=(const AigNode& other);
-  AigNode(AigNode&& other);
-  AigNode& operator=(AigNode&& other);
 
   bool is_true() const;
 
@@ -45,9 +47,9 @@ class AigNode
 
   bool is_const() const;
 
-  bool is_negated() const { return d_negated; }
+  bool is_negated() const { return d_lit & 1; }
 
-  const AigNode& operator[](int index) const;
+  AigNode operator[](int index) const;
 
   int64_t get_id() const;
 
@@ -56,115 +58,60 @@ class AigNode
  private:
   static const int64_t s_true_id = 1;
 
+  /** @return The literal of given signed node id. */
+  static uint32_t id_to_lit(int64_t id)
+  {
+    assert(id != 0);
+    return id < 0 ? (static_cast<uint32_t>(-id) << 1) | 1
+                  : static_cast<uint32_t>(id) << 1;
+  }
+
   // Should only be constructed via AigManager
-  AigNode(AigNodeData* data, bool negated = false);
+  AigNode(const AigManager* mgr, uint32_t lit) : d_mgr(mgr), d_lit(lit) {}
 
-  bool is_null() const { return d_data == nullptr; }
+  bool is_null() const { return d_mgr == nullptr; }
 
-  uint64_t get_refs() const;
+  /** @return The (unsigned) id of the node. */
+  uint32_t var() const { return d_lit >> 1; }
 
-  AigNodeData* d_data = nullptr;
-  // TODO: optimization hide flag in d_data pointer
-  bool d_negated = false;
+  /** The manager owning the node data. */
+  const AigManager* d_mgr = nullptr;
+  /** The literal, node id with the negation flag in the LSB. */
+  uint32_t d_lit = 0;
 };
 
-inline bool
-operator==(const AigNode& a, const AigNode& b)
-{
-  return a.get_id() == b.get_id();
-}
-
-inline bool
-operator<(const AigNode& a, const AigNode& b)
-{
-  return a.get_id() < b.get_id();
-}
-
 /**
  * AigNodeData storing all node data.
+ *
+ * Children are stored as literals, input and constant nodes have no children
+ * (literal 0).
  */
-class AigNodeData
+struct AigNodeData
 {
-  friend class AigNode;
-  friend AigManager;
-  friend class AigNodeUniqueTable;
-
- public:
-  AigNodeData() = delete;
-  ~AigNodeData() { assert(d_refs == 0); }
-
-  void inc_refs() { ++d_refs; }
-  void dec_refs()
-  {
-    assert(d_refs > 0);
-    --d_refs;
-    if (d_refs == 0)
-    {
-      gc();
-    }
-  }
-
- private:
-  AigNodeData(AigManager* mgr) : d_mgr(mgr) {}
-  AigNodeData(AigManager* mgr, const AigNode& left, const AigNode& right)
-      : d_mgr(mgr), d_left(left), d_right(right)
-  {
-  }
-
-  void gc();
-
-  /** Pointer to AIG Manager to allow automatic deletion. */
-  AigManager* d_mgr = nullptr;
-
-  /** AIG node id. */
-  int64_t d_id = 0;
-  /** Reference count. */
-  uint32_t d_refs = 0;
-  /** Number of parents. */
-  uint32_t d_parents = 0;
   /** Left child of AND gate. */
-  AigNode d_left;
+  uint32_t d_left = 0;
   /** Right child of AND gate. */
-  AigNode d_right;
-
-  /** Next pointer for collision chain. */
-  AigNodeData* next = nullptr;
+  uint32_t d_right = 0;
+  /** Number of parents. */
+  uint32_t d_parents = 0;
 };
 
 inline bool
-AigNode::is_true() const
-{
-  return d_data->d_id == AigNode::s_true_id && !is_negated();
-}
-
-inline bool
-AigNode::is_false() const
+operator==(const AigNode& a, const AigNode& b)
 {
-  return d_data->d_id == AigNode::s_true_id && is_negated();
+  return a.get_id() == b.get_id();
 }
 
 inline bool
-AigNode::is_and() const
+operator!=(const AigNode& a, const AigNode& b)
 {
-  return !d_data->d_left.is_null();
+  return !(a == b);
 }
 
 inline bool
-AigNode::is_const() const
-{
-  return !is_and() && !is_true() && !is_false();
-}
-
-inline const AigNode&
-AigNode::operator[](int index) const
+operator<(const AigNode& a, const AigNode& b)
 {
-  assert(is_and());
-  if (index == 0)
-  {
-    return d_data->d_left;
-  }
-  assert(index == 1);
-  return d_data->d_right;
+  return a.get_id() < b.get_id();
 }
 
 inline int64_t
@@ -175,21 +122,20 @@ AigNode::get_id() const
   {
     return 0;
   }
-  return is_negated() ? -d_data->d_id : d_data->d_id;
+  return is_negated() ? -static_cast<int64_t>(var())
+                      : static_cast<int64_t>(var());
 }
 
-inline uint32_t
-AigNode::parents() const
+inline bool
+AigNode::is_true() const
 {
-  assert(!is_null());
-  return d_data->d_parents;
+  return var() == AigNode::s_true_id && !is_negated();
 }
 
-inline uint64_t
-AigNode::get_refs() const
+inline bool
+AigNode::is_false() const
 {
-  assert(!is_null());
-  return d_data->d_refs;
+  return var() == AigNode::s_true_id && is_negated();
 }
 
 }  // namespace bzla::bitblast
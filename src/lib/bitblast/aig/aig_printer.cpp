@@ -44,6 +44,11 @@ uint32_t
 to_aiger_id(int64_t id)
 {
   assert(id <= std::numeric_limits<int32_t>::max());
+  // AIG true/false are mapped to the AIGER constants.
+  if (std::abs(id) == 1)
+  {
+    return id < 0 ? aiger_false : aiger_true;
+  }
   uint32_t lit = aiger_var2lit(std::abs(id));
   if (id < 0)
   {
@@ -59,49 +64,58 @@ AigPrinter::write_aiger(const std::string& filename)
 {
   aiger* aig = aiger_init();
 
+  // Collect the cone of influence of the outputs indexed by node id. Since
+  // children always have smaller ids than their parents, iterating over the
+  // cone by id yields a topological order.
+  std::vector<AigNode> cone;
   std::vector<AigNode> visit{d_outputs.begin(), d_outputs.end()};
-  std::unordered_map<int64_t, bool> cache;
-
   while (!visit.empty())
   {
-    auto cur = visit.back();
-    auto id  = std::abs(cur.get_id());
-
-    auto [it, inserted] = cache.emplace(id, false);
-    if (inserted)
+    AigNode cur = visit.back();
+    visit.pop_back();
+    size_t id = static_cast<size_t>(std::abs(cur.get_id()));
+    if (id >= cone.size())
     {
+      cone.resize(id + 1);
+    }
+    if (cone[id].get_id() == 0)
+    {
+      cone[id] = cur;
       if (cur.is_and())
       {
         visit.push_back(cur[0]);
         visit.push_back(cur[1]);
       }
+    }
+  }
+
+  for (const AigNode& cur : cone)
+  {
+    auto id = std::abs(cur.get_id());
+    if (id == 0 || cur.is_true() || cur.is_false())
+    {
       continue;
     }
-    else if (!it->second)
+    auto cur_lit = to_aiger_id(id);
+    if (cur.is_const())
     {
-      it->second   = true;
-      auto cur_lit = to_aiger_id(id);
-      if (cur.is_const())
+      auto its = d_symbols.find(cur);
+      if (its == d_symbols.end())
       {
-        auto its = d_symbols.find(cur);
-        if (its == d_symbols.end())
-        {
-          aiger_add_input(aig, cur_lit, nullptr);
-        }
-        else
-        {
-          aiger_add_input(aig, cur_lit, its->second.c_str());
-        }
+        aiger_add_input(aig, cur_lit, nullptr);
       }
       else
       {
-        assert(cur.is_and());
-        auto rhs0 = to_aiger_id(cur[0].get_id());
-        auto rhs1 = to_aiger_id(cur[1].get_id());
-        aiger_add_and(aig, cur_lit, rhs0, rhs1);
+        aiger_add_input(aig, cur_lit, its->second.c_str());
       }
     }
-    visit.pop_back();
+    else
+    {
+      assert(cur.is_and());
+      auto rhs0 = to_aiger_id(cur[0].get_id());
+      auto rhs1 = to_aiger_id(cur[1].get_id());
+      aiger_add_and(aig, cur_lit, rhs0, rhs1);
+    }
   }
 
   for (const auto& output : d_outputs)
@@ -0,0 +1,194 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_simulator.h"
+
+#include <algorithm>
+
+namespace bzla::bitblast {
+
+/* --- AigSimulator public -------------------------------------------------- */
+
+AigSimulator::AigSimulator(const AigManager& amgr,
+                           uint32_t num_words,
+                           uint32_t seed)
+    : d_amgr(amgr), d_num_words(num_words), d_rng(seed)
+{
+  assert(num_words > 0);
+}
+
+AigSimulator::~AigSimulator() {}
+
+void
+AigSimulator::simulate()
+{
+  uint32_t num_nodes = d_amgr.d_node_data.size();
+  // Deleted nodes must be removed via garbage_collect().
+  assert(d_num_simulated <= num_nodes);
+  if (d_num_simulated == num_nodes)
+  {
+    return;
+  }
+  d_values.resize((static_cast<size_t>(num_nodes) + 1) * d_num_words);
+  d_dirty.resize(num_nodes + 1);
+
+  for (uint32_t id = d_num_simulated + 1; id <= num_nodes; ++id)
+  {
+    uint64_t* values = &d_values[static_cast<size_t>(id) * d_num_words];
+    if (d_amgr.data(id).d_left != 0)
+    {
+      simulate_and(id);
+      ++d_statistics.num_simulated;
+    }
+    else if (id == AigNode::s_true_id)
+    {
+      std::fill_n(values, d_num_words, ~UINT64_C(0));
+    }
+    else
+    {
+      for (uint32_t w = 0; w < d_num_words; ++w)
+      {
+        values[w] = d_rng.pick<uint64_t>();
+      }
+    }
+  }
+  d_num_simulated = num_nodes;
+}
+
+void
+AigSimulator::resimulate()
+{
+  if (d_changed.empty())
+  {
+    return;
+  }
+  assert(d_num_simulated <= d_amgr.d_node_data.size());
+
+  // Node ids are topologically ordered, hence only nodes with an id greater
+  // than the smallest changed input can be in the fan-out cones. Nodes are
+  // only recomputed if one of their children changed.
+  uint32_t min_id = *std::min_element(d_changed.begin(), d_changed.end());
+  for (uint32_t id : d_changed)
+  {
+    d_dirty[id] = true;
+  }
+  for (uint32_t id = min_id + 1; id <= d_num_simulated; ++id)
+  {
+    const AigNodeData& data = d_amgr.data(id);
+    if (data.d_left == 0)
+    {
+      continue;
+    }
+    if (d_dirty[data.d_left >> 1] || d_dirty[data.d_right >> 1])
+    {
+      ++d_statistics.num_resimulated;
+      if (simulate_and(id))
+      {
+        d_dirty[id] = true;
+      }
+    }
+  }
+  std::fill(d_dirty.begin() + min_id, d_dirty.end(), false);
+  d_changed.clear();
+}
+
+void
+AigSimulator::set_input(const AigNode& input, uint32_t word, uint64_t value)
+{
+  assert(input.is_const());
+  assert(word < d_num_words);
+  uint64_t& val = d_values[offset(input) + word];
+  if (val != value)
+  {
+    val = value;
+    mark_changed(input);
+  }
+}
+
+void
+AigSimulator::randomize_input(const AigNode& input)
+{
+  assert(input.is_const());
+  uint64_t* values = &d_values[offset(input)];
+  for (uint32_t w = 0; w < d_num_words; ++w)
+  {
+    values[w] = d_rng.pick<uint64_t>();
+  }
+  mark_changed(input);
+}
+
+void
+AigSimulator::randomize_input(const AigNode& input, uint32_t word)
+{
+  assert(input.is_const());
+  assert(word < d_num_words);
+  d_values[offset(input) + word] = d_rng.pick<uint64_t>();
+  mark_changed(input);
+}
+
+void
+AigSimulator::garbage_collect(uint32_t num_nodes)
+{
+  if (num_nodes >= d_num_simulated)
+  {
+    return;
+  }
+  d_num_simulated = num_nodes;
+  d_values.resize((static_cast<size_t>(num_nodes) + 1) * d_num_words);
+  d_dirty.resize(num_nodes + 1);
+  d_changed.erase(std::remove_if(d_changed.begin(),
+                                 d_changed.end(),
+                                 [num_nodes](uint32_t id) {
+                                   return id > num_nodes;
+                                 }),
+                  d_changed.end());
+}
+
+std::vector<uint64_t>
+AigSimulator::signature(const AigNode& aig) const
+{
+  std::vector<uint64_t> res(d_num_words);
+  for (uint32_t w = 0; w < d_num_words; ++w)
+  {
+    res[w] = value(aig, w);
+  }
+  return res;
+}
+
+/* --- AigSimulator private ------------------------------------------------- */
+
+bool
+AigSimulator::simulate_and(uint32_t id)
+{
+  const AigNodeData& data = d_amgr.data(id);
+  const uint64_t* left  = &d_values[static_cast<size_t>(data.d_left >> 1)
+                                   * d_num_words];
+  const uint64_t* right = &d_values[static_cast<size_t>(data.d_right >> 1)
+                                    * d_num_words];
+  uint64_t* values      = &d_values[static_cast<size_t>(id) * d_num_words];
+  uint64_t neg_left     = (data.d_left & 1) ? ~UINT64_C(0) : 0;
+  uint64_t neg_right    = (data.d_right & 1) ? ~UINT64_C(0) : 0;
+  uint64_t changed      = 0;
+  for (uint32_t w = 0; w < d_num_words; ++w)
+  {
+    uint64_t val = (left[w] ^ neg_left) & (right[w] ^ neg_right);
+    changed |= val ^ values[w];
+    values[w] = val;
+  }
+  return changed != 0;
+}
+
+void
+AigSimulator::mark_changed(const AigNode& input)
+{
+  d_changed.push_back(input.var());
+}
+
+}  // namespace bzla::bitblast
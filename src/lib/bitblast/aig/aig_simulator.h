@@ -0,0 +1,164 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BITBLAST_AIG_SIMULATOR_H
+#define BZLA__BITBLAST_AIG_SIMULATOR_H
+
+#include <vector>
+
+#include "bitblast/aig/aig_manager.h"
+#include "rng/rng.h"
+
+namespace bzla::bitblast {
+
+/**
+ * Bit-parallel simulator for all nodes of an AIG manager.
+ *
+ * Each node is simulated over 64 * num_words() patterns, stored as
+ * `num_words()` 64-bit words per node (its signature). Since node ids are
+ * topologically ordered, the AIG is simulated in a single pass over the node
+ * array of the manager.
+ *
+ * Inputs are initialized with random patterns, which can be overwritten via
+ * set_input(). Changed inputs are propagated to their fan-out cones via
+ * resimulate().
+ */
+class AigSimulator
+{
+ public:
+  struct Statistics
+  {
+    uint64_t num_simulated   = 0;  // Number of simulated AND gates
+    uint64_t num_resimulated = 0;  // Number of resimulated AND gates
+  };
+
+  /**
+   * Constructor.
+   * @param amgr      The AIG manager.
+   * @param num_words The number of 64-bit simulation words per node.
+   * @param seed      The seed for the random input patterns.
+   */
+  AigSimulator(const AigManager& amgr,
+               uint32_t num_words = 1,
+               uint32_t seed      = 0);
+  ~AigSimulator();
+
+  /**
+   * Simulate all nodes of the manager that were created since the last
+   * call. Newly created inputs are initialized with random patterns.
+   */
+  void simulate();
+
+  /**
+   * Resimulate the fan-out cones of the inputs changed via set_input() or
+   * randomize_input() since the last call.
+   */
+  void resimulate();
+
+  /**
+   * Set simulation word of input.
+   * @note The change is propagated on the next call to resimulate().
+   * @param input The input node, must be simulated.
+   * @param word  The index of the word.
+   * @param value The new value of the word.
+   */
+  void set_input(const AigNode& input, uint32_t word, uint64_t value);
+
+  /**
+   * Assign new random patterns to given input.
+   * @note The change is propagated on the next call to resimulate().
+   * @param input The input node, must be simulated.
+   */
+  void randomize_input(const AigNode& input);
+  /**
+   * Assign new random pattern to given simulation word of input.
+   * @note The change is propagated on the next call to resimulate().
+   * @param input The input node, must be simulated.
+   * @param word  The index of the word.
+   */
+  void randomize_input(const AigNode& input, uint32_t word);
+
+  /**
+   * Remove the simulation words of all nodes with an id greater than
+   * `num_nodes`, which were deleted via AigManager::garbage_collect().
+   * Nodes that reuse the ids of deleted nodes are simulated on the next
+   * call to simulate().
+   * @param num_nodes The number of nodes kept by the AIG manager.
+   */
+  void garbage_collect(uint32_t num_nodes);
+
+  /**
+   * Get simulation word of simulated node.
+   * @param aig  The node.
+   * @param word The index of the word.
+   * @return The simulation word, negated if `aig` is negated.
+   */
+  uint64_t value(const AigNode& aig, uint32_t word) const
+  {
+    assert(word < d_num_words);
+    uint64_t res = d_values[offset(aig) + word];
+    return aig.is_negated() ? ~res : res;
+  }
+
+  /**
+   * Get signature of simulated node.
+   * @param aig The node.
+   * @return The simulation words of the node, negated if `aig` is negated.
+   */
+  std::vector<uint64_t> signature(const AigNode& aig) const;
+
+  /** @return The number of simulation words per node. */
+  uint32_t num_words() const { return d_num_words; }
+
+  /** @return Simulator statistics. */
+  const Statistics& statistics() const { return d_statistics; }
+
+ private:
+  /** @return The offset of the simulation words of given node. */
+  size_t offset(const AigNode& aig) const
+  {
+    assert(aig.var() > 0 && aig.var() <= d_num_simulated);
+    return static_cast<size_t>(aig.var()) * d_num_words;
+  }
+
+  /**
+   * Compute the simulation words of AND gate with given id from the words of
+   * its children.
+   * @return True if any word changed.
+   */
+  bool simulate_and(uint32_t id);
+
+  /** Mark input as changed. */
+  void mark_changed(const AigNode& input);
+
+  /** The AIG manager. */
+  const AigManager& d_amgr;
+  /** The number of simulation words per node. */
+  uint32_t d_num_words;
+  /** The random number generator for input patterns. */
+  RNG d_rng;
+  /** Simulation words, indexed by node id * d_num_words. */
+  std::vector<uint64_t> d_values;
+  /**
+   * The number of simulated nodes, nodes with an id greater than
+   * d_num_simulated are not simulated yet.
+   */
+  uint32_t d_num_simulated = 0;
+  /** Ids of the inputs changed since the last call to resimulate(). */
+  std::vector<uint32_t> d_changed;
+  /** Maps node id to 1 if the node changed in the current resimulation. */
+  std::vector<uint8_t> d_dirty;
+
+  Statistics d_statistics;
+};
+
+}  // namespace bzla::bitblast
+
+#endif
@@ -11,6 +11,8 @@
 #ifndef BZLA__BITBLAST_AIG_BITBLASTER_H
 #define BZLA__BITBLAST_AIG_BITBLASTER_H
 
+#include <cstdlib>
+
 #include "bitblast/aig/aig_manager.h"
 #include "bitblast/aig/aig_node.h"
 #include "bitblast/bitblaster.h"
@@ -51,6 +53,9 @@ class BitInterface<AigNode>
 
   const auto& statistics() const { return d_amgr.statistics(); }
 
+  AigManager& manager() { return d_amgr; }
+  const AigManager& manager() const { return d_amgr; }
+
  private:
   AigManager d_amgr;
 };
@@ -58,14 +63,49 @@ class BitInterface<AigNode>
 class AigBitblaster : public BitblasterInterface<AigNode>
 {
  public:
+  /** @return The AIG manager. */
+  AigManager& aig_manager() { return d_bit_mgr.manager(); }
+
+  /** @return Number of AIG nodes. */
+  uint32_t num_aig_nodes() const { return d_bit_mgr.manager().num_nodes(); }
+
   /** @return Number of created AND gates. */
   uint64_t num_aig_ands() const { return d_bit_mgr.statistics().num_ands; }
 
   /** @return Number of AIG constants. */
   uint64_t num_aig_consts() const { return d_bit_mgr.statistics().num_consts; }
 
+  /** @return Number of garbage collected AIG nodes. */
+  uint64_t num_aig_deleted() const
+  {
+    return d_bit_mgr.statistics().num_deleted;
+  }
+
   /** @return Number of shared AND gates. */
   uint64_t num_aig_shared() const { return d_bit_mgr.statistics().num_shared; }
+
+  /**
+   * Delete all AIG nodes with an id greater than `num_nodes` and remove them
+   * from the bit-blaster caches.
+   * @see AigManager::garbage_collect()
+   */
+  void garbage_collect(uint32_t num_nodes)
+  {
+    remove_cached([num_nodes](const AigNode& bit) {
+      return static_cast<uint32_t>(std::abs(bit.get_id())) > num_nodes;
+    });
+    aig_manager().garbage_collect(num_nodes);
+  }
+
+ protected:
+  /**
+   * @return Number of AND gates constructed, including gates found via
+   *         structural hashing.
+   */
+  uint64_t num_gates() const override
+  {
+    return d_bit_mgr.statistics().num_ands + d_bit_mgr.statistics().num_shared;
+  }
 };
 
 }  // namespace bzla::bitblast
@@ -13,7 +13,9 @@
 
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 #include <cstddef>
+#include <map>
 #include <vector>
 
 #include "bv/bitvector.h"
@@ -46,12 +48,44 @@ class BitInterface
   T mk_ite(const T& c, const T& a, const T& b);
 };
 
+/** The circuit used for encoding bit-vector multiplication. */
+enum class MulEncoding
+{
+  /** Shift-and-add array multiplier with a ripple-carry adder per row. */
+  ARRAY,
+  /**
+   * Wallace tree reduction of the partial products. If one of the operands
+   * is a value, its canonical signed digit representation is used to
+   * minimize the number of partial product rows.
+   */
+  WALLACE,
+  /**
+   * Dadda tree reduction of the partial products. If one of the operands
+   * is a value, its canonical signed digit representation is used to
+   * minimize the number of partial product rows.
+   */
+  DADDA,
+};
+
 template <class T>
 class BitblasterInterface
 {
  public:
   using Bits = std::vector<T>;
 
+  struct Statistics
+  {
+    uint64_t num_div_circuits = 0;  // Number of encoded divider circuits
+    uint64_t num_div_reused   = 0;  // Number of reused divider circuits
+    uint64_t num_div_saved    = 0;  // Number of gates saved by reuse
+  };
+
+  /** Configure the circuit used for bv_mul(). */
+  void set_mul_encoding(MulEncoding enc) { d_mul_encoding = enc; }
+
+  /** @return Bit-blaster statistics. */
+  const Statistics& statistics() const { return d_statistics; }
+
   virtual Bits bv_value(const BitVector& bv_value)
   {
     Bits res;
@@ -343,23 +377,23 @@ class BitblasterInterface
   virtual Bits bv_mul(const Bits& a, const Bits& b)
   {
     // Normalize operands s.t. operands with fixed bits come first
-    if (a > b)
+    const Bits& x = a > b ? b : a;
+    const Bits& y = a > b ? a : b;
+    if (d_mul_encoding == MulEncoding::ARRAY)
     {
-      return mul_helper(b, a);
+      return mul_helper(x, y);
     }
-    return mul_helper(a, b);
+    return mul_tree_helper(x, y);
   }
 
   virtual Bits bv_udiv(const Bits& a, const Bits& b)
   {
-    auto [res, rem] = udiv_urem_helper(a, b);
-    return res;
+    return udiv_urem(a, b).first;
   }
 
   virtual Bits bv_urem(const Bits& a, const Bits& b)
   {
-    auto [res, rem] = udiv_urem_helper(a, b);
-    return rem;
+    return udiv_urem(a, b).second;
   }
 
   /**
@@ -418,7 +452,76 @@ class BitblasterInterface
 
   BitInterface<T> d_bit_mgr;
 
+  /**
+   * @return The number of gates created so far, used to determine the size
+   *         of shared circuits for statistics.
+   */
+  virtual uint64_t num_gates() const { return 0; }
+
+  /**
+   * Remove all cached circuits that contain a bit for which `deleted`
+   * returns true.
+   */
+  template <class P>
+  void remove_cached(P deleted)
+  {
+    auto contains = [&deleted](const Bits& bits) {
+      return std::any_of(bits.begin(), bits.end(), deleted);
+    };
+    for (auto it = d_div_cache.begin(); it != d_div_cache.end();)
+    {
+      const auto& [quot, rem] = it->second.d_result;
+      if (contains(it->first.first) || contains(it->first.second)
+          || contains(quot) || contains(rem))
+      {
+        it = d_div_cache.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  /** The circuit used for bv_mul(). */
+  MulEncoding d_mul_encoding = MulEncoding::ARRAY;
+
+  Statistics d_statistics;
+
  private:
+  /** Cached divider circuit. */
+  struct DivCircuit
+  {
+    /** The quotient and remainder bits. */
+    std::pair<Bits, Bits> d_result;
+    /** The number of gates of the circuit. */
+    uint64_t d_num_gates;
+  };
+
+  /**
+   * Get divider circuit for operands `a` and `b`. Circuits are cached by
+   * their operand bits such that udiv and urem over the same operands (and
+   * hence also sdiv, srem and smod, which are eliminated to udiv and urem
+   * over the same operands) share a single circuit.
+   */
+  const std::pair<Bits, Bits>& udiv_urem(const Bits& a, const Bits& b)
+  {
+    auto [it, inserted] = d_div_cache.try_emplace(std::make_pair(a, b));
+    if (inserted)
+    {
+      uint64_t num_gates     = this->num_gates();
+      it->second.d_result    = udiv_urem_helper(a, b);
+      it->second.d_num_gates = this->num_gates() - num_gates;
+      ++d_statistics.num_div_circuits;
+    }
+    else
+    {
+      ++d_statistics.num_div_reused;
+      d_statistics.num_div_saved += it->second.d_num_gates;
+    }
+    return it->second.d_result;
+  }
+
   Bits add_helper(const Bits& a, const Bits& b)
   {
     Bits res;
@@ -474,6 +577,246 @@ class BitblasterInterface
     return res;
   }
 
+  /**
+   * Encode multiplier that sums up the partial products with a Wallace or
+   * Dadda tree of full and half adders, followed by a ripple-carry adder for
+   * the two remaining rows.
+   */
+  Bits mul_tree_helper(const Bits& a, const Bits& b)
+  {
+    size_t size = a.size();
+    T false_bit = d_bit_mgr.mk_false();
+
+    // Partial products per column, column i has weight 2^i.
+    std::vector<Bits> columns(size);
+    if (is_value(a) || is_value(b))
+    {
+      csd_partial_products(is_value(a) ? b : a, is_value(a) ? a : b, columns);
+    }
+    else
+    {
+      for (size_t i = 0; i < size; ++i)
+      {
+        const T& b_bit = b[size - 1 - i];
+        if (b_bit == false_bit)
+        {
+          continue;
+        }
+        for (size_t j = 0; i + j < size; ++j)
+        {
+          T p = d_bit_mgr.mk_and(a[size - 1 - j], b_bit);
+          if (p != false_bit)
+          {
+            columns[i + j].push_back(p);
+          }
+        }
+      }
+    }
+
+    if (d_mul_encoding == MulEncoding::WALLACE)
+    {
+      wallace_reduce(columns);
+    }
+    else
+    {
+      assert(d_mul_encoding == MulEncoding::DADDA);
+      dadda_reduce(columns);
+    }
+
+    Bits row0, row1;
+    for (size_t i = 0; i < size; ++i)
+    {
+      const Bits& col = columns[size - 1 - i];
+      assert(col.size() <= 2);
+      row0.push_back(col.size() > 0 ? col[0] : false_bit);
+      row1.push_back(col.size() > 1 ? col[1] : false_bit);
+    }
+    return add_helper(row0, row1);
+  }
+
+  /** @return True if all bits of `a` are constant. */
+  bool is_value(const Bits& a)
+  {
+    T false_bit = d_bit_mgr.mk_false();
+    T true_bit  = d_bit_mgr.mk_true();
+    for (const T& bit : a)
+    {
+      if (bit != false_bit && bit != true_bit)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Compute the partial products of `a * c` for value `c` from the canonical
+   * signed digit (CSD) representation of `c`.
+   *
+   * In CSD representation, every digit is in {-1, 0, 1} and no two adjacent
+   * digits are non-zero, which minimizes the number of non-zero digits. A
+   * digit 1 at position i adds a << i, and a digit -1 adds ~(a << i) + 1,
+   * whose constant part is collected into a single constant row.
+   */
+  void csd_partial_products(const Bits& a,
+                            const Bits& c,
+                            std::vector<Bits>& columns)
+  {
+    size_t size = a.size();
+    T true_bit  = d_bit_mgr.mk_true();
+    BitVector offset = BitVector::mk_zero(size);
+
+    uint32_t carry = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+      uint32_t bit  = (c[size - 1 - i] == true_bit) + carry;
+      bool next_bit = i + 1 < size && c[size - 2 - i] == true_bit;
+      int32_t digit = 0;
+      if (bit == 1)
+      {
+        // Digit -1 if the remaining value is 3 mod 4, else 1.
+        digit = next_bit ? -1 : 1;
+        carry = next_bit ? 1 : 0;
+      }
+      else
+      {
+        carry = bit >> 1;
+      }
+
+      if (digit == 1)
+      {
+        for (size_t j = 0; i + j < size; ++j)
+        {
+          columns[i + j].push_back(a[size - 1 - j]);
+        }
+      }
+      else if (digit == -1)
+      {
+        // -(a << i) = ~(a << i) + 1, where bits below i are 1.
+        // Hence, the constant part is 2^i - 1 + 1 = 2^i.
+        for (size_t j = 0; i + j < size; ++j)
+        {
+          columns[i + j].push_back(d_bit_mgr.mk_not(a[size - 1 - j]));
+        }
+        offset.ibvadd(BitVector::mk_one(size).ibvshl(i));
+      }
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      if (offset.bit(i))
+      {
+        columns[i].push_back(true_bit);
+      }
+    }
+  }
+
+  /**
+   * Reduce the height of all columns to at most two via Wallace tree
+   * reduction, which greedily reduces all bits of a column with full and
+   * half adders in each stage.
+   */
+  void wallace_reduce(std::vector<Bits>& columns)
+  {
+    size_t size = columns.size();
+    while (max_height(columns) > 2)
+    {
+      std::vector<Bits> next(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        const Bits& col = columns[i];
+        size_t j        = 0;
+        for (size_t n = col.size(); j < n;)
+        {
+          T sum, cout;
+          if (n - j >= 3)
+          {
+            std::tie(sum, cout) = full_adder(col[j], col[j + 1], col[j + 2]);
+            j += 3;
+          }
+          else if (n - j == 2)
+          {
+            std::tie(sum, cout) = half_adder(col[j], col[j + 1]);
+            j += 2;
+          }
+          else
+          {
+            next[i].push_back(col[j++]);
+            break;
+          }
+          next[i].push_back(sum);
+          if (i + 1 < size)
+          {
+            next[i + 1].push_back(cout);
+          }
+        }
+      }
+      columns = std::move(next);
+    }
+  }
+
+  /**
+   * Reduce the height of all columns to at most two via Dadda tree
+   * reduction, which only reduces columns to the maximum height of the
+   * current stage, with heights 2, 3, 4, 6, 9, ... (d_j+1 = 3/2 * d_j).
+   */
+  void dadda_reduce(std::vector<Bits>& columns)
+  {
+    size_t size = columns.size();
+    std::vector<size_t> heights{2};
+    for (size_t max = max_height(columns); heights.back() < max;)
+    {
+      heights.push_back(heights.back() * 3 / 2);
+    }
+    heights.pop_back();
+
+    for (auto it = heights.rbegin(); it != heights.rend(); ++it)
+    {
+      size_t height = *it;
+      std::vector<Bits> next(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        // Carries from column i - 1 of this stage are already in next[i].
+        const Bits& col = columns[i];
+        size_t j        = 0;
+        while (next[i].size() + col.size() - j > height)
+        {
+          T sum, cout;
+          if (next[i].size() + col.size() - j - height >= 2
+              && col.size() - j >= 3)
+          {
+            std::tie(sum, cout) = full_adder(col[j], col[j + 1], col[j + 2]);
+            j += 3;
+          }
+          else
+          {
+            assert(col.size() - j >= 2);
+            std::tie(sum, cout) = half_adder(col[j], col[j + 1]);
+            j += 2;
+          }
+          next[i].push_back(sum);
+          if (i + 1 < size)
+          {
+            next[i + 1].push_back(cout);
+          }
+        }
+        next[i].insert(next[i].end(), col.begin() + j, col.end());
+      }
+      columns = std::move(next);
+    }
+  }
+
+  /** @return The maximum number of bits in any of the given columns. */
+  static size_t max_height(const std::vector<Bits>& columns)
+  {
+    size_t res = 0;
+    for (const Bits& col : columns)
+    {
+      res = std::max(res, col.size());
+    }
+    return res;
+  }
+
   T ult_helper(const Bits& a, const Bits& b)
   {
     size_t lsb = a.size() - 1;
@@ -657,6 +1000,9 @@ class BitblasterInterface
     Bits r(rem.rbegin(), rem.rend() - 1);
     return std::make_pair(quot, r);
   }
+
+  /** Cache for divider circuits, maps operand bits to the circuit. */
+  std::map<std::pair<Bits, Bits>, DivCircuit> d_div_cache;
 };
 
 }  // namespace bzla::bitblast
@@ -10,6 +10,7 @@
 
 #include "bv/bitvector.h"
 
+#include <algorithm>
 #include <bitset>
 #include <cassert>
 #include <iostream>
@@ -77,6 +78,486 @@ clz_limb(uint64_t nbits_per_limb, mp_limb_t limb)
 }
 #endif
 
+/* --- Fixed-size limb arithmetic ------------------------------------------- */
+
+/**
+ * The number of 64-bit limbs of bit-vectors stored as limbs. All operations
+ * below operate on all limbs, unused limbs are zero.
+ */
+constexpr uint64_t s_nlimbs = BitVector::s_limbs_size / 64;
+
+/** Count leading zeros of a non-zero uint64_t value. */
+uint64_t
+clz64(uint64_t val)
+{
+  assert(val);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_clzll(val));
+#else
+  uint64_t res = 0;
+  for (uint64_t mask = (uint64_t) 1 << 63; !(val & mask); mask >>= 1) ++res;
+  return res;
+#endif
+}
+
+/** Count trailing zeros of a non-zero uint64_t value. */
+uint64_t
+ctz64(uint64_t val)
+{
+  assert(val);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_ctzll(val));
+#else
+  uint64_t res = 0;
+  for (; !(val & 1); val >>= 1) ++res;
+  return res;
+#endif
+}
+
+/** Count the number of set bits of a uint64_t value. */
+uint64_t
+popcount64(uint64_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_popcountll(val));
+#else
+  uint64_t res = 0;
+  for (; val; val &= val - 1) ++res;
+  return res;
+#endif
+}
+
+/**
+ * Compute the full 128-bit product of two uint64_t values.
+ * @param a  The first operand.
+ * @param b  The second operand.
+ * @param hi The result pointer for the upper 64 bits of the product.
+ * @return The lower 64 bits of the product.
+ */
+uint64_t
+mul64(uint64_t a, uint64_t b, uint64_t* hi)
+{
+#ifdef __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 uint128_t;
+  uint128_t p = static_cast<uint128_t>(a) * b;
+  *hi         = static_cast<uint64_t>(p >> 64);
+  return static_cast<uint64_t>(p);
+#else
+  uint64_t a0 = a & UINT32_MAX, a1 = a >> 32;
+  uint64_t b0 = b & UINT32_MAX, b1 = b >> 32;
+  uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  uint64_t mid = (p00 >> 32) + (p01 & UINT32_MAX) + (p10 & UINT32_MAX);
+  *hi          = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return (mid << 32) | (p00 & UINT32_MAX);
+#endif
+}
+
+/**
+ * Normalize limbs for a given bit-width.
+ * The equivalent of mpz_fdiv_r_2exp for limbs.
+ * @param size The bit-width.
+ * @param res  The limbs to normalize.
+ */
+void
+limbs_fdiv_r_2exp(uint64_t size, uint64_t* res)
+{
+  assert(size <= BitVector::s_limbs_size);
+  uint64_t n = size / 64;
+  if (size % 64)
+  {
+    res[n] &= UINT64_MAX >> (64 - size % 64);
+    n += 1;
+  }
+  for (uint64_t i = n; i < s_nlimbs; ++i)
+  {
+    res[i] = 0;
+  }
+}
+
+/** Set limbs to the value of given limbs. */
+void
+limbs_set(uint64_t* res, const uint64_t* a)
+{
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    res[i] = a[i];
+  }
+}
+
+/** Set limbs to given uint64_t value. */
+void
+limbs_set_ui(uint64_t* res, uint64_t val)
+{
+  res[0] = val;
+  for (uint64_t i = 1; i < s_nlimbs; ++i)
+  {
+    res[i] = 0;
+  }
+}
+
+/** Compare limbs `a` and `b`, return value as for mpz_cmp. */
+int32_t
+limbs_cmp(const uint64_t* a, const uint64_t* b)
+{
+  for (uint64_t i = s_nlimbs; i-- > 0;)
+  {
+    if (a[i] != b[i])
+    {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+/** Compare limbs `a` and uint64_t value `b`, return value as for mpz_cmp. */
+int32_t
+limbs_cmp_ui(const uint64_t* a, uint64_t b)
+{
+  for (uint64_t i = s_nlimbs; i-- > 1;)
+  {
+    if (a[i])
+    {
+      return 1;
+    }
+  }
+  return a[0] == b ? 0 : (a[0] < b ? -1 : 1);
+}
+
+/** Return true if the value of limbs `a` fits into a uint64_t. */
+bool
+limbs_fits_in_size_64(const uint64_t* a)
+{
+  return limbs_cmp_ui(a, a[0]) == 0;
+}
+
+/** Compute res = a + b, not normalized. */
+void
+limbs_add(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t carry = 0;
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t ai = a[i], bi = b[i];
+    uint64_t r  = ai + bi;
+    uint64_t c  = r < ai;
+    r += carry;
+    carry  = c | (r < carry);
+    res[i] = r;
+  }
+}
+
+/** Compute res = a + b, not normalized. */
+void
+limbs_add_ui(uint64_t* res, const uint64_t* a, uint64_t b)
+{
+  uint64_t carry = b;
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t r = a[i] + carry;
+    carry      = r < carry;
+    res[i]     = r;
+  }
+}
+
+/** Compute res = a - b, not normalized. */
+void
+limbs_sub(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t borrow = 0;
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t ai = a[i], bi = b[i];
+    uint64_t r  = ai - bi;
+    uint64_t c  = ai < bi;
+    c |= r < borrow;
+    res[i] = r - borrow;
+    borrow = c;
+  }
+}
+
+/** Compute res = a - b, not normalized. */
+void
+limbs_sub_ui(uint64_t* res, const uint64_t* a, uint64_t b)
+{
+  uint64_t borrow = b;
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t ai = a[i];
+    res[i]      = ai - borrow;
+    borrow      = ai < borrow;
+  }
+}
+
+/** Compute res = ~a, not normalized. */
+void
+limbs_com(uint64_t* res, const uint64_t* a)
+{
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    res[i] = ~a[i];
+  }
+}
+
+/** Compute res = a & b. */
+void
+limbs_and(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    res[i] = a[i] & b[i];
+  }
+}
+
+/** Compute res = a | b. */
+void
+limbs_ior(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    res[i] = a[i] | b[i];
+  }
+}
+
+/** Compute res = a ^ b. */
+void
+limbs_xor(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    res[i] = a[i] ^ b[i];
+  }
+}
+
+/** Compute res = a << shift, not normalized. */
+void
+limbs_mul_2exp(uint64_t* res, const uint64_t* a, uint64_t shift)
+{
+  uint64_t nshift = shift / 64;
+  uint64_t bshift = shift % 64;
+  for (uint64_t i = s_nlimbs; i-- > 0;)
+  {
+    uint64_t r = 0;
+    if (i >= nshift)
+    {
+      r = a[i - nshift] << bshift;
+      if (bshift && i > nshift)
+      {
+        r |= a[i - nshift - 1] >> (64 - bshift);
+      }
+    }
+    res[i] = r;
+  }
+}
+
+/** Compute res = a >> shift. */
+void
+limbs_fdiv_q_2exp(uint64_t* res, const uint64_t* a, uint64_t shift)
+{
+  uint64_t nshift = shift / 64;
+  uint64_t bshift = shift % 64;
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t r = 0;
+    if (i + nshift < s_nlimbs)
+    {
+      r = a[i + nshift] >> bshift;
+      if (bshift && i + nshift + 1 < s_nlimbs)
+      {
+        r |= a[i + nshift + 1] << (64 - bshift);
+      }
+    }
+    res[i] = r;
+  }
+}
+
+/** Compute res = a * b, truncated to s_nlimbs limbs, not normalized. */
+void
+limbs_mul(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t tmp[s_nlimbs] = {};
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    if (a[i] == 0) continue;
+    uint64_t carry = 0;
+    for (uint64_t j = 0; i + j < s_nlimbs; ++j)
+    {
+      uint64_t hi;
+      uint64_t lo = mul64(a[i], b[j], &hi);
+      lo += carry;
+      hi += lo < carry;
+      lo += tmp[i + j];
+      hi += lo < tmp[i + j];
+      tmp[i + j] = lo;
+      carry      = hi;
+    }
+  }
+  std::copy(tmp, tmp + s_nlimbs, res);
+}
+
+/** Compute the full product res = a * b with 2 * s_nlimbs limbs. */
+void
+limbs_mul_full(uint64_t* res, const uint64_t* a, const uint64_t* b)
+{
+  std::fill(res, res + 2 * s_nlimbs, 0);
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    uint64_t carry = 0;
+    for (uint64_t j = 0; j < s_nlimbs; ++j)
+    {
+      uint64_t hi;
+      uint64_t lo = mul64(a[i], b[j], &hi);
+      lo += carry;
+      hi += lo < carry;
+      lo += res[i + j];
+      hi += lo < res[i + j];
+      res[i + j] = lo;
+      carry      = hi;
+    }
+    res[i + s_nlimbs] = carry;
+  }
+}
+
+/**
+ * Compute quotient and remainder of the unsigned division of `a` by `b`.
+ *
+ * Implements Knuth's Algorithm D (TAOCP Vol. 2, 4.3.1) on 32-bit digits, see
+ * also Hacker's Delight, 9-2 (divmnu).
+ *
+ * @param quot The result pointer for the quotient, may be nullptr.
+ * @param rem  The result pointer for the remainder, may be nullptr.
+ * @param a    The dividend.
+ * @param b    The divisor, must not be zero.
+ */
+void
+limbs_udivrem(uint64_t* quot,
+              uint64_t* rem,
+              const uint64_t* a,
+              const uint64_t* b)
+{
+  constexpr uint64_t ndigits = 2 * s_nlimbs;
+  constexpr uint64_t base    = (uint64_t) 1 << 32;
+
+  uint32_t u[ndigits], v[ndigits], q[ndigits] = {}, r[ndigits] = {};
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    u[2 * i]     = static_cast<uint32_t>(a[i]);
+    u[2 * i + 1] = static_cast<uint32_t>(a[i] >> 32);
+    v[2 * i]     = static_cast<uint32_t>(b[i]);
+    v[2 * i + 1] = static_cast<uint32_t>(b[i] >> 32);
+  }
+  uint64_t m = ndigits, n = ndigits;
+  while (m > 0 && u[m - 1] == 0) --m;
+  while (n > 0 && v[n - 1] == 0) --n;
+  assert(n > 0);
+
+  if (m < n)
+  {
+    std::copy(u, u + ndigits, r);
+  }
+  else if (n == 1)
+  {
+    uint64_t k = 0;
+    for (uint64_t j = m; j-- > 0;)
+    {
+      uint64_t cur = (k << 32) + u[j];
+      q[j]         = static_cast<uint32_t>(cur / v[0]);
+      k            = cur - q[j] * v[0];
+    }
+    r[0] = static_cast<uint32_t>(k);
+  }
+  else
+  {
+    // Normalize such that the most significant digit of the divisor is >=
+    // base / 2.
+    uint32_t un[ndigits + 1], vn[ndigits];
+    uint64_t s = clz64(v[n - 1]) - 32;
+    for (uint64_t i = n - 1; i > 0; --i)
+    {
+      vn[i] = static_cast<uint32_t>((static_cast<uint64_t>(v[i]) << s)
+                                    | (static_cast<uint64_t>(v[i - 1])
+                                       >> (32 - s)));
+    }
+    vn[0] = static_cast<uint32_t>(static_cast<uint64_t>(v[0]) << s);
+    un[m] = static_cast<uint32_t>(static_cast<uint64_t>(u[m - 1]) >> (32 - s));
+    for (uint64_t i = m - 1; i > 0; --i)
+    {
+      un[i] = static_cast<uint32_t>((static_cast<uint64_t>(u[i]) << s)
+                                    | (static_cast<uint64_t>(u[i - 1])
+                                       >> (32 - s)));
+    }
+    un[0] = static_cast<uint32_t>(static_cast<uint64_t>(u[0]) << s);
+
+    for (uint64_t j = m - n + 1; j-- > 0;)
+    {
+      // Estimate quotient digit.
+      uint64_t num  = (static_cast<uint64_t>(un[j + n]) << 32) + un[j + n - 1];
+      uint64_t qhat = num / vn[n - 1];
+      uint64_t rhat = num - qhat * vn[n - 1];
+      while (qhat >= base
+             || qhat * vn[n - 2] > ((rhat << 32) + un[j + n - 2]))
+      {
+        qhat -= 1;
+        rhat += vn[n - 1];
+        if (rhat >= base) break;
+      }
+      // Multiply and subtract.
+      uint64_t borrow = 0;
+      for (uint64_t i = 0; i < n; ++i)
+      {
+        uint64_t p = qhat * vn[i] + borrow;
+        uint64_t t = static_cast<uint64_t>(un[i + j]) - (p & UINT32_MAX);
+        un[i + j]  = static_cast<uint32_t>(t);
+        borrow     = (p >> 32) + (t >> 63);
+      }
+      uint64_t t = static_cast<uint64_t>(un[j + n]) - borrow;
+      un[j + n]  = static_cast<uint32_t>(t);
+      q[j]       = static_cast<uint32_t>(qhat);
+      // Add back if we subtracted too much.
+      if (t >> 63)
+      {
+        q[j] -= 1;
+        uint64_t carry = 0;
+        for (uint64_t i = 0; i < n; ++i)
+        {
+          uint64_t sum = static_cast<uint64_t>(un[i + j]) + vn[i] + carry;
+          un[i + j]    = static_cast<uint32_t>(sum);
+          carry        = sum >> 32;
+        }
+        un[j + n] = static_cast<uint32_t>(un[j + n] + carry);
+      }
+    }
+    // Unnormalize remainder.
+    for (uint64_t i = 0; i < n; ++i)
+    {
+      r[i] = static_cast<uint32_t>((static_cast<uint64_t>(un[i]) >> s)
+                                   | (static_cast<uint64_t>(un[i + 1])
+                                      << (32 - s)));
+    }
+  }
+
+  for (uint64_t i = 0; i < s_nlimbs; ++i)
+  {
+    if (quot)
+    {
+      quot[i] = (static_cast<uint64_t>(q[2 * i + 1]) << 32) | q[2 * i];
+    }
+    if (rem)
+    {
+      rem[i] = (static_cast<uint64_t>(r[2 * i + 1]) << 32) | r[2 * i];
+    }
+  }
+}
+
+/** Set limbs to given non-negative GMP value. */
+void
+limbs_set_mpz(uint64_t* res, const mpz_t val)
+{
+  assert(mpz_sgn(val) >= 0);
+  assert(mpz_sizeinbase(val, 2) <= BitVector::s_limbs_size);
+  limbs_set_ui(res, 0);
+  mpz_export(res, nullptr, -1, sizeof(uint64_t), 0, 0, val);
+}
+
 }  // namespace
 
 bool
@@ -97,6 +578,14 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
     {
       res = mpz_cmp(tmp, min.d_val_gmp) <= 0;
     }
+    else if (min.is_limbs())
+    {
+      mpz_t val;
+      mpz_init(val);
+      min.get_mpz(val);
+      res = mpz_cmp(tmp, val) <= 0;
+      mpz_clear(val);
+    }
     else
     {
       res = mpz_cmp_ui(tmp, min.d_val_uint64) <= 0;
@@ -104,15 +593,7 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
   }
   else
   {
-    BitVector max = BitVector::mk_ones(size);
-    if (max.is_gmp())
-    {
-      res = mpz_cmp(tmp, max.d_val_gmp) <= 0;
-    }
-    else
-    {
-      res = mpz_cmp_ui(tmp, max.d_val_uint64) <= 0;
-    }
+    res = size >= mpz_sizeinbase(tmp, 2);
   }
   mpz_clear(tmp);
   return res;
@@ -167,12 +648,18 @@ BitVector
 BitVector::mk_ones(uint64_t size)
 {
   BitVector res(size);
-  if (size > s_native_size)
+  if (res.is_gmp())
   {
     mpz_set_ui(res.d_val_gmp, 1);
     mpz_mul_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
     mpz_sub_ui(res.d_val_gmp, res.d_val_gmp, 1);
   }
+  else if (res.is_limbs())
+  {
+    limbs_set_ui(res.d_val_limbs, 0);
+    limbs_com(res.d_val_limbs, res.d_val_limbs);
+    limbs_fdiv_r_2exp(size, res.d_val_limbs);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, UINT64_MAX);
@@ -216,6 +703,10 @@ BitVector::BitVector(uint64_t size) : d_size(size), d_val_uint64(0)
   {
     mpz_init(d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    limbs_set_ui(d_val_limbs, 0);
+  }
 }
 
 BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
@@ -225,6 +716,14 @@ BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
     mpz_urandomb(d_val_gmp, *rng.get_gmp_state(), size);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    for (uint64_t i = 0; i < s_nlimbs; ++i)
+    {
+      d_val_limbs[i] = rng.pick<uint64_t>();
+    }
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -303,6 +802,14 @@ BitVector::BitVector(uint64_t size, const std::string& value, uint32_t base)
      * absolute value of 'value') in GMP when created from mpz_init_set_str. */
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    mpz_t tmp;
+    mpz_init_set_str(tmp, value.c_str(), base);
+    mpz_fdiv_r_2exp_ull(tmp, tmp, size);
+    limbs_set_mpz(d_val_limbs, tmp);
+    mpz_clear(tmp);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -326,8 +833,15 @@ BitVector::BitVector(uint64_t size, const mpz_t value, bool truncate)
   }
   mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
 
-  // Can we use the native type?
-  if (!is_gmp())
+  // Can we use the native type or limbs?
+  if (is_limbs())
+  {
+    uint64_t limbs[s_nlimbs];
+    limbs_set_mpz(limbs, d_val_gmp);
+    mpz_clear(d_val_gmp);
+    limbs_set(d_val_limbs, limbs);
+  }
+  else if (!is_gmp())
   {
     uint64_t val = mpz_get_ui(d_val_gmp);
     mpz_clear(d_val_gmp);
@@ -348,6 +862,10 @@ BitVector::from_ui(uint64_t size, uint64_t value, bool truncate)
     mpz_init_set_ull(res.d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    limbs_set_ui(res.d_val_limbs, value);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, value);
@@ -368,6 +886,19 @@ BitVector::from_si(uint64_t size, int64_t value, bool truncate)
     mpz_init_set_sll(res.d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    limbs_set_ui(res.d_val_limbs, static_cast<uint64_t>(value));
+    if (value < 0)
+    {
+      // sign-extend
+      for (uint64_t i = 1; i < s_nlimbs; ++i)
+      {
+        res.d_val_limbs[i] = UINT64_MAX;
+      }
+    }
+    limbs_fdiv_r_2exp(size, res.d_val_limbs);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, static_cast<uint64_t>(value));
@@ -392,6 +923,10 @@ BitVector::BitVector(const BitVector& other)
     {
       mpz_init_set(d_val_gmp, other.d_val_gmp);
     }
+    else if (is_limbs())
+    {
+      limbs_set(d_val_limbs, other.d_val_limbs);
+    }
     else
     {
       d_val_uint64 = other.d_val_uint64;
@@ -411,7 +946,14 @@ BitVector::BitVector(BitVector&& other)
     else
     {
       mpz_clear(d_val_gmp);
-      d_val_uint64 = std::exchange(other.d_val_uint64, 0);
+      if (other.is_limbs())
+      {
+        limbs_set(d_val_limbs, other.d_val_limbs);
+      }
+      else
+      {
+        d_val_uint64 = std::exchange(other.d_val_uint64, 0);
+      }
     }
   }
   else
@@ -421,6 +963,10 @@ BitVector::BitVector(BitVector&& other)
       mpz_init_set(d_val_gmp, other.d_val_gmp);
       mpz_clear(other.d_val_gmp);
     }
+    else if (other.is_limbs())
+    {
+      limbs_set(d_val_limbs, other.d_val_limbs);
+    }
     else
     {
       d_val_uint64 = std::exchange(other.d_val_uint64, 0);
@@ -458,6 +1004,10 @@ BitVector::operator=(const BitVector& other)
       {
         mpz_init_set(d_val_gmp, other.d_val_gmp);
       }
+      else if (other.is_limbs())
+      {
+        limbs_set(d_val_limbs, other.d_val_limbs);
+      }
       else
       {
         d_val_uint64 = other.d_val_uint64;
@@ -468,7 +1018,14 @@ BitVector::operator=(const BitVector& other)
       if (!other.is_gmp())
       {
         mpz_clear(d_val_gmp);
-        d_val_uint64 = other.d_val_uint64;
+        if (other.is_limbs())
+        {
+          limbs_set(d_val_limbs, other.d_val_limbs);
+        }
+        else
+        {
+          d_val_uint64 = other.d_val_uint64;
+        }
       }
       else
       {
@@ -488,18 +1045,28 @@ BitVector::hash() const
 
   res = d_size * s_hash_primes[j++];
 
-  if (is_gmp())
+  if (is_gmp() || is_limbs())
   {
     // least significant limb is at index 0
-    mp_limb_t limb;
-    for (i = 0, j = 0, n = mpz_size(d_val_gmp); i < n; ++i)
+    uint64_t limb;
+    if (is_gmp())
+    {
+      n = mpz_size(d_val_gmp);
+    }
+    else
+    {
+      // disregard zero limbs, as GMP does
+      for (n = s_nlimbs; n > 0 && d_val_limbs[n - 1] == 0; --n)
+        ;
+    }
+    for (i = 0, j = 0; i < n; ++i)
     {
       p0 = s_hash_primes[j++];
       if (j == s_n_primes) j = 0;
       p1 = s_hash_primes[j++];
       if (j == s_n_primes) j = 0;
-      limb = mpz_getlimbn(d_val_gmp, i);
-      if (mp_bits_per_limb == 64)
+      limb = is_gmp() ? mpz_getlimbn(d_val_gmp, i) : d_val_limbs[i];
+      if (!is_gmp() || mp_bits_per_limb == 64)
       {
         uint64_t lo = limb;
         uint64_t hi = (limb >> 32);
@@ -548,6 +1115,10 @@ BitVector::iset(uint64_t value)
     mpz_set_ull(d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    limbs_set_ui(d_val_limbs, value);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(d_size, value);
@@ -564,6 +1135,10 @@ BitVector::iset(const BitVector& bv)
   {
     mpz_set(d_val_gmp, bv.d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    limbs_set(d_val_limbs, bv.d_val_limbs);
+  }
   else
   {
     d_val_uint64 = bv.d_val_uint64;
@@ -604,6 +1179,30 @@ BitVector::iset(RNG& rng,
       mpz_add(d_val_gmp, d_val_gmp, from.d_val_gmp);
     }
   }
+  else if (is_limbs())
+  {
+    // Pick value in [0, to - from] via rejection sampling and add from.
+    uint64_t range[s_nlimbs], val[s_nlimbs];
+    limbs_sub(range, to.d_val_limbs, from.d_val_limbs);
+    limbs_fdiv_r_2exp(d_size, range);
+    uint64_t n = s_nlimbs;
+    while (n > 0 && range[n - 1] == 0) --n;
+    limbs_set_ui(val, 0);
+    if (n > 0)
+    {
+      uint64_t nbits = n * 64 - clz64(range[n - 1]);
+      do
+      {
+        for (uint64_t i = 0; i < n; ++i)
+        {
+          val[i] = rng.pick<uint64_t>();
+        }
+        limbs_fdiv_r_2exp(nbits, val);
+      } while (limbs_cmp(val, range) > 0);
+    }
+    limbs_add(d_val_limbs, val, from.d_val_limbs);
+    limbs_fdiv_r_2exp(d_size, d_val_limbs);
+  }
   else
   {
     if (is_signed)
@@ -659,6 +1258,30 @@ BitVector::str(uint32_t base) const
     return res.str();
   }
 
+  if (is_limbs())
+  {
+    if (base == 2)
+    {
+      std::string res(d_size, '0');
+      for (uint64_t i = 0; i < d_size; ++i)
+      {
+        if ((d_val_limbs[i / 64] >> (i % 64)) & 1)
+        {
+          res[d_size - 1 - i] = '1';
+        }
+      }
+      return res;
+    }
+    mpz_t val;
+    mpz_init(val);
+    get_mpz(val);
+    char* tmp = mpz_get_str(0, base, val);
+    std::string res(tmp);
+    free(tmp);
+    mpz_clear(val);
+    return res;
+  }
+
   if (base == 10)
   {
     return std::to_string(d_val_uint64);
@@ -683,10 +1306,37 @@ BitVector::to_uint64(bool truncate) const
     assert(truncate || fits_in_size(64, d_val_gmp));
     return mpz_get_ull(d_val_gmp);
   }
+  if (is_limbs())
+  {
+    assert(truncate || limbs_fits_in_size_64(d_val_limbs));
+    return d_val_limbs[0];
+  }
   assert(truncate || fits_in_size(64, d_val_uint64));
   return d_val_uint64;
 }
 
+void
+BitVector::to_limbs(uint64_t* limbs) const
+{
+  assert(!is_null());
+  uint64_t n = num_limbs();
+  if (is_gmp())
+  {
+    size_t count = 0;
+    mpz_export(limbs, &count, -1, sizeof(uint64_t), 0, 0, d_val_gmp);
+    assert(count <= n);
+    std::fill(limbs + count, limbs + n, 0);
+  }
+  else if (is_limbs())
+  {
+    std::copy(d_val_limbs, d_val_limbs + n, limbs);
+  }
+  else
+  {
+    limbs[0] = d_val_uint64;
+  }
+}
+
 int32_t
 BitVector::compare(const BitVector& bv) const
 {
@@ -703,6 +1353,11 @@ BitVector::compare(const BitVector& bv) const
     return mpz_cmp(d_val_gmp, bv.d_val_gmp);
   }
 
+  if (is_limbs())
+  {
+    return limbs_cmp(d_val_limbs, bv.d_val_limbs);
+  }
+
   if (d_val_uint64 == bv.d_val_uint64)
   {
     return 0;
@@ -748,6 +1403,10 @@ BitVector::bit(uint64_t idx) const
   {
     return mpz_tstbit(d_val_gmp, idx);
   }
+  if (is_limbs())
+  {
+    return (d_val_limbs[idx / 64] >> (idx % 64)) & 1;
+  }
   return (d_val_uint64 >> idx) & 1;
 }
 
@@ -767,6 +1426,17 @@ BitVector::set_bit(uint64_t idx, bool value)
       mpz_clrbit(d_val_gmp, idx);
     }
   }
+  else if (is_limbs())
+  {
+    if (value)
+    {
+      d_val_limbs[idx / 64] |= ((uint64_t) 1 << (idx % 64));
+    }
+    else
+    {
+      d_val_limbs[idx / 64] &= ~((uint64_t) 1 << (idx % 64));
+    }
+  }
   else
   {
     if (value)
@@ -832,6 +1502,10 @@ BitVector::is_zero() const
   {
     return mpz_cmp_ui(d_val_gmp, 0) == 0;
   }
+  if (is_limbs())
+  {
+    return limbs_cmp_ui(d_val_limbs, 0) == 0;
+  }
   return d_val_uint64 == 0;
 }
 
@@ -862,6 +1536,14 @@ BitVector::is_ones() const
         - d_size % static_cast<uint64_t>(mp_bits_per_limb);
     return (static_cast<uint64_t>(limb)) == (max >> m);
   }
+  if (is_limbs())
+  {
+    uint64_t ones[s_nlimbs];
+    limbs_set_ui(ones, 0);
+    limbs_com(ones, ones);
+    limbs_fdiv_r_2exp(d_size, ones);
+    return limbs_cmp(d_val_limbs, ones) == 0;
+  }
   return d_val_uint64 == uint64_fdiv_r_2exp(d_size, UINT64_MAX);
 }
 
@@ -873,6 +1555,10 @@ BitVector::is_one() const
   {
     return mpz_cmp_ui(d_val_gmp, 1) == 0;
   }
+  if (is_limbs())
+  {
+    return limbs_cmp_ui(d_val_limbs, 1) == 0;
+  }
   return d_val_uint64 == 1;
 }
 
@@ -884,6 +1570,13 @@ BitVector::is_min_signed() const
   {
     if (mpz_scan1(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    uint64_t min[s_nlimbs];
+    limbs_set_ui(min, 0);
+    min[(d_size - 1) / 64] = (uint64_t) 1 << ((d_size - 1) % 64);
+    if (limbs_cmp(d_val_limbs, min) != 0) return false;
+  }
   else
   {
     if (d_val_uint64
@@ -903,6 +1596,14 @@ BitVector::is_max_signed() const
   {
     if (mpz_scan0(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    uint64_t max[s_nlimbs];
+    limbs_set_ui(max, 0);
+    limbs_com(max, max);
+    limbs_fdiv_r_2exp(d_size - 1, max);
+    if (limbs_cmp(d_val_limbs, max) != 0) return false;
+  }
   else
   {
     if (d_size == 1) return d_val_uint64 == 0;
@@ -933,6 +1634,17 @@ BitVector::is_uadd_overflow(const BitVector& bv) const
 {
   assert(!is_null());
   assert(d_size == bv.d_size);
+  if (is_limbs())
+  {
+    uint64_t add[s_nlimbs];
+    limbs_add(add, d_val_limbs, bv.d_val_limbs);
+    if (d_size == s_limbs_size)
+    {
+      return limbs_cmp(add, d_val_limbs) < 0;
+    }
+    limbs_fdiv_q_2exp(add, add, d_size);
+    return limbs_cmp_ui(add, 0) != 0;
+  }
   mpz_t add;
   if (is_gmp())
   {
@@ -993,6 +1705,17 @@ BitVector::is_umul_overflow(const BitVector& bv) const
 {
   assert(!is_null());
   assert(d_size == bv.d_size);
+  if (is_limbs())
+  {
+    uint64_t mul[2 * s_nlimbs];
+    limbs_mul_full(mul, d_val_limbs, bv.d_val_limbs);
+    for (uint64_t i = d_size / 64; i < 2 * s_nlimbs; ++i)
+    {
+      uint64_t limb = i == d_size / 64 ? mul[i] >> (d_size % 64) : mul[i];
+      if (limb) return true;
+    }
+    return false;
+  }
   if (d_size > 1)
   {
     mpz_t mul;
@@ -1051,6 +1774,18 @@ BitVector::count_trailing_zeros() const
     res = mpz_scan1(d_val_gmp, 0);
     if (res > d_size) res = d_size;
   }
+  else if (is_limbs())
+  {
+    res = d_size;
+    for (uint64_t i = 0; i < s_nlimbs; ++i)
+    {
+      if (d_val_limbs[i])
+      {
+        res = i * 64 + ctz64(d_val_limbs[i]);
+        break;
+      }
+    }
+  }
   else
   {
     for (uint64_t i = 0; i < d_size; ++i)
@@ -1072,6 +1807,18 @@ BitVector::count_trailing_ones() const
     res = mpz_scan0(d_val_gmp, 0);
     if (res > d_size) res = d_size;
   }
+  else if (is_limbs())
+  {
+    res = d_size;
+    for (uint64_t i = 0; i < s_nlimbs; ++i)
+    {
+      if (~d_val_limbs[i])
+      {
+        res = std::min(d_size, i * 64 + ctz64(~d_val_limbs[i]));
+        break;
+      }
+    }
+  }
   else
   {
     for (uint64_t i = 0; i < d_size; ++i)
@@ -1459,6 +2206,11 @@ BitVector::ibvneg(const BitVector& bv)
     mpz_add_ui(d_val_gmp, d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    limbs_add_ui(d_val_limbs, d_val_limbs, 1);
+    limbs_fdiv_r_2exp(d_size, d_val_limbs);
+  }
   else
   {
     d_val_uint64 += 1;
@@ -1483,6 +2235,15 @@ BitVector::ibvnot(const BitVector& bv)
     mpz_com(d_val_gmp, bv.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_com(d_val_limbs, bv.d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1511,6 +2272,15 @@ BitVector::ibvinc(const BitVector& bv)
     mpz_add_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1539,6 +2309,15 @@ BitVector::ibvdec(const BitVector& bv)
     mpz_sub_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1584,6 +2363,10 @@ BitVector::ibvredor(const BitVector& bv)
       }
     }
   }
+  else if (bv.is_limbs())
+  {
+    val = limbs_cmp_ui(bv.d_val_limbs, 0) != 0 ? 1 : 0;
+  }
   else if (bv.d_val_uint64 != 0)
   {
     val = 1;
@@ -1603,6 +2386,15 @@ BitVector::ibvredxor(const BitVector& bv)
   {
     val = mpz_popcount(bv.d_val_gmp) % 2 > 0 ? 1 : 0;
   }
+  else if (bv.is_limbs())
+  {
+    uint64_t cnt = 0;
+    for (uint64_t i = 0; i < s_nlimbs; ++i)
+    {
+      cnt += popcount64(bv.d_val_limbs[i]);
+    }
+    val = cnt % 2;
+  }
   else if (bv.d_val_uint64 != 0)
   {
     for (uint64_t i = 0; i < bv.d_size; ++i)
@@ -1647,6 +2439,15 @@ BitVector::ibvadd(const BitVector& bv0, const BitVector& bv1)
     mpz_add(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1678,6 +2479,15 @@ BitVector::ibvsub(const BitVector& bv0, const BitVector& bv1)
     mpz_sub(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1709,6 +2519,14 @@ BitVector::ibvand(const BitVector& bv0, const BitVector& bv1)
     mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_and(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1759,6 +2577,16 @@ BitVector::ibvnand(const BitVector& bv0, const BitVector& bv1)
     mpz_com(d_val_gmp, d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_and(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_com(d_val_limbs, d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1791,6 +2619,16 @@ BitVector::ibvnor(const BitVector& bv0, const BitVector& bv1)
     mpz_com(d_val_gmp, d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_ior(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_com(d_val_limbs, d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1822,6 +2660,14 @@ BitVector::ibvor(const BitVector& bv0, const BitVector& bv1)
     mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_ior(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1854,6 +2700,16 @@ BitVector::ibvxnor(const BitVector& bv0, const BitVector& bv1)
     mpz_com(d_val_gmp, d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_xor(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_com(d_val_limbs, d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1885,6 +2741,14 @@ BitVector::ibvxor(const BitVector& bv0, const BitVector& bv1)
     mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_xor(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -1912,6 +2776,13 @@ BitVector::ibveq(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) == 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 == bv1.d_val_uint64)
   {
     val = 1;
@@ -1936,6 +2807,13 @@ BitVector::ibvne(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) != 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 != bv1.d_val_uint64)
   {
     val = 1;
@@ -1960,6 +2838,13 @@ BitVector::ibvult(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) < 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 < bv1.d_val_uint64)
   {
     val = 1;
@@ -1984,6 +2869,13 @@ BitVector::ibvule(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) <= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 <= bv1.d_val_uint64)
   {
     val = 1;
@@ -2008,6 +2900,13 @@ BitVector::ibvugt(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) > 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 > bv1.d_val_uint64)
   {
     val = 1;
@@ -2032,6 +2931,13 @@ BitVector::ibvuge(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) >= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 >= bv1.d_val_uint64)
   {
     val = 1;
@@ -2173,6 +3079,22 @@ BitVector::ibvshl(const BitVector& bv, uint64_t shift)
       mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
     }
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      limbs_set_ui(d_val_limbs, 0);
+    }
+    else
+    {
+      limbs_mul_2exp(d_val_limbs, bv.d_val_limbs, shift);
+      limbs_fdiv_r_2exp(size, d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2216,6 +3138,14 @@ BitVector::ibvshl(const BitVector& bv, const BitVector& shift)
       }
       mpz_set_ui(d_val_gmp, 0);
     }
+    else if (bv.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      limbs_set_ui(d_val_limbs, 0);
+    }
     else
     {
       if (is_gmp())
@@ -2251,6 +3181,21 @@ BitVector::ibvshr(const BitVector& bv, uint64_t shift)
       mpz_fdiv_q_2exp_ull(d_val_gmp, bv.d_val_gmp, shift);
     }
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      limbs_set_ui(d_val_limbs, 0);
+    }
+    else
+    {
+      limbs_fdiv_q_2exp(d_val_limbs, bv.d_val_limbs, shift);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2292,7 +3237,15 @@ BitVector::ibvshr(const BitVector& bv, const BitVector& shift)
       {
         mpz_init(d_val_gmp);
       }
-      mpz_set_ui(d_val_gmp, 0);
+      mpz_set_ui(d_val_gmp, 0);
+    }
+    else if (bv.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      limbs_set_ui(d_val_limbs, 0);
     }
     else
     {
@@ -2368,6 +3321,15 @@ BitVector::ibvmul(const BitVector& bv0, const BitVector& bv1)
     mpz_mul(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_mul(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_fdiv_r_2exp(size, d_val_limbs);
+  }
   else
   {
     if (is_gmp())
@@ -2408,6 +3370,23 @@ BitVector::ibvudiv(const BitVector& bv0, const BitVector& bv1)
       mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (bv1.is_zero())
+    {
+      limbs_set_ui(d_val_limbs, 0);
+      limbs_com(d_val_limbs, d_val_limbs);
+      limbs_fdiv_r_2exp(size, d_val_limbs);
+    }
+    else
+    {
+      limbs_udivrem(d_val_limbs, nullptr, bv0.d_val_limbs, bv1.d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2452,6 +3431,21 @@ BitVector::ibvurem(const BitVector& bv0, const BitVector& bv1)
       mpz_set(d_val_gmp, bv0.d_val_gmp);
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (!bv1.is_zero())
+    {
+      limbs_udivrem(nullptr, d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    }
+    else
+    {
+      limbs_set(d_val_limbs, bv0.d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2755,31 +3749,41 @@ BitVector::ibvconcat(const BitVector& bv0, const BitVector& bv1)
     b1 = &bv1;
   }
 
-  if (size > s_native_size)
+  if (size > s_limbs_size)
   {
     if (!is_gmp())
     {
       mpz_init(d_val_gmp);
     }
-    if (b0->is_gmp())
-    {
-      mpz_set(d_val_gmp, b0->d_val_gmp);
-    }
-    else
-    {
-      mpz_set_ui(d_val_gmp, b0->d_val_uint64);
-    }
+    b0->get_mpz(d_val_gmp);
     mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b1->d_size);
     if (b1->is_gmp())
     {
       mpz_add(d_val_gmp, d_val_gmp, b1->d_val_gmp);
     }
+    else if (b1->is_limbs())
+    {
+      mpz_t tmp;
+      mpz_init(tmp);
+      b1->get_mpz(tmp);
+      mpz_add(d_val_gmp, d_val_gmp, tmp);
+      mpz_clear(tmp);
+    }
     else
     {
       mpz_add_ui(d_val_gmp, d_val_gmp, b1->d_val_uint64);
     }
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (size > s_native_size)
+  {
+    uint64_t limbs0[s_nlimbs], limbs1[s_nlimbs];
+    b0->get_limbs(limbs0);
+    b1->get_limbs(limbs1);
+    limbs_mul_2exp(limbs0, limbs0, b1->d_size);
+    limbs_ior(limbs0, limbs0, limbs1);
+    set_limbs(size, limbs0);
+  }
   else
   {
     if (is_gmp())
@@ -2801,58 +3805,42 @@ BitVector::ibvextract(const BitVector& bv, uint64_t idx_hi, uint64_t idx_lo)
   assert(idx_hi < bv.size());
   uint64_t size = idx_hi - idx_lo + 1;
 
-  if (is_gmp())
+  if (size > s_limbs_size)
   {
-    if (bv.is_gmp())
-    {
-      mpz_set(d_val_gmp, bv.d_val_gmp);
-    }
-    else
+    assert(bv.is_gmp());
+    if (!is_gmp())
     {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
+      mpz_init(d_val_gmp);
     }
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, idx_hi + 1);
+    mpz_fdiv_r_2exp_ull(d_val_gmp, bv.d_val_gmp, idx_hi + 1);
     mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, idx_lo);
-    if (size <= s_native_size)
-    {
-      uint64_t val = mpz_get_ui(d_val_gmp);
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
-    }
+  }
+  else if (bv.is_gmp())
+  {
+    uint64_t limbs[s_nlimbs];
+    mpz_t tmp;
+    mpz_init(tmp);
+    mpz_fdiv_r_2exp_ull(tmp, bv.d_val_gmp, idx_hi + 1);
+    mpz_fdiv_q_2exp_ull(tmp, tmp, idx_lo);
+    limbs_set_mpz(limbs, tmp);
+    mpz_clear(tmp);
+    set_limbs(size, limbs);
+  }
+  else if (bv.is_limbs())
+  {
+    uint64_t limbs[s_nlimbs];
+    limbs_fdiv_q_2exp(limbs, bv.d_val_limbs, idx_lo);
+    limbs_fdiv_r_2exp(size, limbs);
+    set_limbs(size, limbs);
   }
   else
   {
-    if (size > s_native_size)
-    {
-      mpz_init(d_val_gmp);
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-      }
-      mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, idx_hi + 1);
-      mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, idx_lo);
-    }
-    else
+    if (is_gmp())
     {
-      if (bv.is_gmp())
-      {
-        mpz_t tmp;
-        mpz_init_set(tmp, bv.d_val_gmp);
-        mpz_fdiv_r_2exp_ull(tmp, tmp, idx_hi + 1);
-        mpz_fdiv_q_2exp_ull(tmp, tmp, idx_lo);
-        d_val_uint64 = mpz_get_ui(tmp);
-        mpz_clear(tmp);
-      }
-      else
-      {
-        d_val_uint64 = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64);
-        d_val_uint64 >>= idx_lo;
-      }
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64);
+    d_val_uint64 >>= idx_lo;
   }
   d_size = size;
   return *this;
@@ -2867,53 +3855,46 @@ BitVector::ibvzext(const BitVector& bv, uint64_t n)
 
   uint64_t size = bv.d_size + n;
 
-  if (is_gmp())
+  if (size > s_limbs_size)
   {
     if (bv.is_gmp())
     {
+      if (!is_gmp())
+      {
+        mpz_init(d_val_gmp);
+      }
       mpz_set(d_val_gmp, bv.d_val_gmp);
     }
     else
-    {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-    }
-    if (size <= s_native_size)
-    {
-      uint64_t val = mpz_get_ui(d_val_gmp);
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
-    }
-  }
-  else
-  {
-    if (size > s_native_size)
     {
       /* copy to guard for bv == *this */
-      const BitVector* b;
-      BitVector bb;
-      if (&bv == this)
-      {
-        bb = bv;
-        b  = &bb;
-      }
-      else
-      {
-        b = &bv;
-      }
-      mpz_init(d_val_gmp);
-      if (b->is_gmp())
+      mpz_t tmp;
+      mpz_init(tmp);
+      bv.get_mpz(tmp);
+      if (is_gmp())
       {
-        mpz_set(d_val_gmp, b->d_val_gmp);
+        mpz_swap(d_val_gmp, tmp);
       }
       else
       {
-        mpz_set_ui(d_val_gmp, b->d_val_uint64);
+        mpz_init_set(d_val_gmp, tmp);
       }
+      mpz_clear(tmp);
     }
-    else
+  }
+  else if (size > s_native_size)
+  {
+    uint64_t limbs[s_nlimbs];
+    bv.get_limbs(limbs);
+    set_limbs(size, limbs);
+  }
+  else
+  {
+    if (is_gmp())
     {
-      d_val_uint64 = bv.d_val_uint64;
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = bv.d_val_uint64;
   }
   d_size = size;
   return *this;
@@ -2942,8 +3923,12 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
     {
       uint64_t b_size = b->d_size;
       uint64_t size   = b_size + n;
-      if (is_gmp())
+      if (size > s_limbs_size)
       {
+        if (!is_gmp())
+        {
+          mpz_init(d_val_gmp);
+        }
         mpz_set_ui(d_val_gmp, 1);
         mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, n);
         mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
@@ -2952,42 +3937,40 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
         {
           mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
         }
+        else if (b->is_limbs())
+        {
+          mpz_t tmp;
+          mpz_init(tmp);
+          b->get_mpz(tmp);
+          mpz_add(d_val_gmp, d_val_gmp, tmp);
+          mpz_clear(tmp);
+        }
         else
         {
           mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
         }
         mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
-        if (size <= s_native_size)
-        {
-          uint64_t val = mpz_get_ui(d_val_gmp);
-          mpz_clear(d_val_gmp);
-          d_val_uint64 = val;
-        }
+      }
+      else if (size > s_native_size)
+      {
+        uint64_t limbs[s_nlimbs], ones[s_nlimbs];
+        b->get_limbs(limbs);
+        limbs_set_ui(ones, 0);
+        limbs_com(ones, ones);
+        limbs_mul_2exp(ones, ones, b_size);
+        limbs_ior(limbs, limbs, ones);
+        limbs_fdiv_r_2exp(size, limbs);
+        set_limbs(size, limbs);
       }
       else
       {
-        if (size > s_native_size)
-        {
-          mpz_init_set_ui(d_val_gmp, 1);
-          mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, n);
-          mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
-          mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b_size);
-          if (b->is_gmp())
-          {
-            mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
-          }
-          else
-          {
-            mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
-          }
-          mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
-        }
-        else
+        if (is_gmp())
         {
-          d_val_uint64 = UINT64_MAX << b_size;
-          d_val_uint64 =
-              uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
+          mpz_clear(d_val_gmp);
         }
+        d_val_uint64 = UINT64_MAX << b_size;
+        d_val_uint64 =
+            uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
       }
       d_size = size;
     }
@@ -2998,31 +3981,7 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
   }
   else if (&bv != this)
   {
-    if (is_gmp())
-    {
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_clear(d_val_gmp);
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    else
-    {
-      if (bv.is_gmp())
-      {
-        mpz_init(d_val_gmp);
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    d_size = bv.d_size;
+    *this = bv;
   }
   return *this;
 }
@@ -3048,35 +4007,36 @@ BitVector::ibvrepeat(const BitVector& bv, uint64_t n)
     b = &bv;
   }
 
-  if (size > s_native_size)
+  if (size > s_limbs_size)
   {
     if (!is_gmp())
     {
       mpz_init(d_val_gmp);
     }
-    if (b->is_gmp())
-    {
-      mpz_set(d_val_gmp, b->d_val_gmp);
-    }
-    else
-    {
-      mpz_set_ui(d_val_gmp, b->d_val_uint64);
-    }
-
+    mpz_t val;
+    mpz_init(val);
+    b->get_mpz(val);
+    mpz_set(d_val_gmp, val);
     for (uint64_t i = 1; i < n; ++i)
     {
       mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b->d_size);
-      if (b->is_gmp())
-      {
-        mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
-      }
-      else
-      {
-        mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
-      }
+      mpz_add(d_val_gmp, d_val_gmp, val);
     }
+    mpz_clear(val);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (size > s_native_size)
+  {
+    uint64_t limbs[s_nlimbs], val[s_nlimbs];
+    b->get_limbs(val);
+    limbs_set(limbs, val);
+    for (uint64_t i = 1; i < n; ++i)
+    {
+      limbs_mul_2exp(limbs, limbs, b->d_size);
+      limbs_ior(limbs, limbs, val);
+    }
+    set_limbs(size, limbs);
+  }
   else
   {
     if (is_gmp())
@@ -3115,7 +4075,7 @@ BitVector::ibvroli(const BitVector& bv, uint64_t n)
     b = &bv;
   }
 
-  if (size > s_native_size)
+  if (size > s_limbs_size)
   {
     if (!is_gmp())
     {
@@ -3138,6 +4098,19 @@ BitVector::ibvroli(const BitVector& bv, uint64_t n)
       ibvadd(b->bvshr(size - rot));
     }
   }
+  else if (size > s_native_size)
+  {
+    uint64_t limbs[s_nlimbs];
+    limbs_mul_2exp(limbs, b->d_val_limbs, rot);
+    if (rot)
+    {
+      uint64_t tmp[s_nlimbs];
+      limbs_fdiv_q_2exp(tmp, b->d_val_limbs, size - rot);
+      limbs_ior(limbs, limbs, tmp);
+    }
+    limbs_fdiv_r_2exp(size, limbs);
+    set_limbs(size, limbs);
+  }
   else
   {
     if (is_gmp())
@@ -3197,7 +4170,7 @@ BitVector::ibvrori(const BitVector& bv, uint64_t n)
     b = &bv;
   }
 
-  if (size > s_native_size)
+  if (size > s_limbs_size)
   {
     if (!is_gmp())
     {
@@ -3220,6 +4193,19 @@ BitVector::ibvrori(const BitVector& bv, uint64_t n)
       ibvadd(b->bvshl(size - rot));
     }
   }
+  else if (size > s_native_size)
+  {
+    uint64_t limbs[s_nlimbs];
+    limbs_fdiv_q_2exp(limbs, b->d_val_limbs, rot);
+    if (rot)
+    {
+      uint64_t tmp[s_nlimbs];
+      limbs_mul_2exp(tmp, b->d_val_limbs, size - rot);
+      limbs_ior(limbs, limbs, tmp);
+    }
+    limbs_fdiv_r_2exp(size, limbs);
+    set_limbs(size, limbs);
+  }
   else
   {
     if (is_gmp())
@@ -3279,6 +4265,14 @@ BitVector::ibvite(const BitVector& c, const BitVector& t, const BitVector& e)
       }
       mpz_set(d_val_gmp, t.d_val_gmp);
     }
+    else if (t.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      limbs_set(d_val_limbs, t.d_val_limbs);
+    }
     else
     {
       if (is_gmp())
@@ -3298,6 +4292,14 @@ BitVector::ibvite(const BitVector& c, const BitVector& t, const BitVector& e)
       }
       mpz_set(d_val_gmp, e.d_val_gmp);
     }
+    else if (e.is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      limbs_set(d_val_limbs, e.d_val_limbs);
+    }
     else
     {
       if (is_gmp())
@@ -3369,6 +4371,23 @@ BitVector::ibvmodinv(const BitVector& bv)
       mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
       mpz_clear(two);
     }
+    else if (pb->is_limbs())
+    {
+      /* Newton iteration x_{i+1} = x_i * (2 - bv * x_i), doubles the number
+       * of correct bits in each step, x_0 = bv is correct for 3 bits since
+       * bv * bv = 1 mod 8 for odd bv. */
+      BitVector x(*pb);
+      BitVector two = BitVector::from_ui(size, 2);
+      for (uint64_t nbits = 3; nbits < size; nbits *= 2)
+      {
+        x.ibvmul(two.bvsub(pb->bvmul(x)));
+      }
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      limbs_set(d_val_limbs, x.d_val_limbs);
+    }
     else
     {
       if (is_gmp())
@@ -3388,7 +4407,7 @@ BitVector::ibvmodinv(const BitVector& bv)
       /* b is this bit-vector extended to esize */
       if (esize > s_native_size)
       {
-        mpz_set_ui(b.d_val_gmp, pb->d_val_uint64);
+        b.d_val_limbs[0] = pb->d_val_uint64;
       }
       else
       {
@@ -3412,29 +4431,7 @@ BitVector::ibvmodinv(const BitVector& bv)
     }
   }
   d_size = size;
-#ifndef NDEBUG
-  mpz_t ty;
-  mpz_init(ty);
-  if (is_gmp())
-  {
-    mpz_mul(ty, pb->d_val_gmp, d_val_gmp);
-  }
-  else
-  {
-    if (pb->is_gmp())
-    {
-      mpz_mul_ui(ty, pb->d_val_gmp, d_val_uint64);
-    }
-    else
-    {
-      mpz_set_ui(ty, pb->d_val_uint64);
-      mpz_mul_ui(ty, ty, d_val_uint64);
-    }
-  }
-  mpz_fdiv_r_2exp_ull(ty, ty, size);
-  assert(!mpz_cmp_ui(ty, 1));
-  mpz_clear(ty);
-#endif
+  assert(pb->bvmul(*this).is_one());
   return *this;
 }
 
@@ -3845,6 +4842,16 @@ BitVector::ibvpow(const BitVector& base, const mpz_t exp)
     assert(base.is_gmp());
     mpz_powm(d_val_gmp, base.d_val_gmp, exp, mod);
   }
+  else if (is_limbs())
+  {
+    assert(base.is_limbs());
+    mpz_t res;
+    mpz_init(res);
+    base.get_mpz(res);
+    mpz_powm(res, res, exp, mod);
+    limbs_set_mpz(d_val_limbs, res);
+    mpz_clear(res);
+  }
   else
   {
     assert(!base.is_gmp());
@@ -3914,6 +4921,15 @@ BitVector::bvudivurem(const BitVector& bv,
       mpz_fdiv_r_2exp_ull(quot->d_val_gmp, quot->d_val_gmp, d_size);
       mpz_fdiv_r_2exp_ull(rem->d_val_gmp, rem->d_val_gmp, d_size);
     }
+    else if (is_limbs())
+    {
+      /* copy to guard for quot == *this and rem == *this */
+      uint64_t size = d_size;
+      uint64_t q[s_nlimbs], r[s_nlimbs];
+      limbs_udivrem(q, r, d_val_limbs, bv.d_val_limbs);
+      quot->set_limbs(size, q);
+      rem->set_limbs(size, r);
+    }
     else
     {
       /* copy to guard for quot == *this and rem == *this */
@@ -3933,6 +4949,24 @@ BitVector::gmp_value() const
   return d_val_gmp;
 }
 
+void
+BitVector::get_mpz(mpz_t res) const
+{
+  assert(!is_null());
+  if (is_gmp())
+  {
+    mpz_set(res, d_val_gmp);
+  }
+  else if (is_limbs())
+  {
+    mpz_import(res, s_nlimbs, -1, sizeof(uint64_t), 0, 0, d_val_limbs);
+  }
+  else
+  {
+    mpz_set_ull(res, d_val_uint64);
+  }
+}
+
 /* -------------------------------------------------------------------------- */
 
 #define BZLA_BV_MASK_BITS_UINT64(size)
@@ -3952,6 +4986,28 @@ BitVector::count_leading(bool zeros) const
   uint64_t res = 0;
   mp_limb_t limb;
 
+  if (is_limbs())
+  {
+    uint64_t limbs[s_nlimbs];
+    if (zeros)
+    {
+      limbs_set(limbs, d_val_limbs);
+    }
+    else
+    {
+      limbs_com(limbs, d_val_limbs);
+      limbs_fdiv_r_2exp(d_size, limbs);
+    }
+    for (uint64_t i = s_nlimbs; i-- > 0;)
+    {
+      if (limbs[i])
+      {
+        return d_size - (i * 64 + 64 - clz64(limbs[i]));
+      }
+    }
+    return d_size;
+  }
+
   uint64_t n_bits_per_limb = static_cast<uint64_t>(mp_bits_per_limb);
   /* The number of bits that spill over into the most significant limb,
    * assuming that all bits are represented). Zero if the bit-width is a
@@ -3981,6 +5037,7 @@ uint64_t
 BitVector::get_limb(void* limb, uint64_t nbits_rem, bool zeros) const
 {
   assert(!is_null());
+  assert(!is_limbs());
   mp_limb_t* gmp_limb = static_cast<mp_limb_t*>(limb);
   uint64_t i, n_limbs, n_limbs_total;
   mp_limb_t res = 0u, mask;
@@ -4066,6 +5123,42 @@ BitVector::get_limb(void* limb, uint64_t nbits_rem, bool zeros) const
   return n_limbs - i;
 }
 
+void
+BitVector::get_limbs(uint64_t* limbs) const
+{
+  assert(!is_null());
+  assert(!is_gmp());
+  if (is_limbs())
+  {
+    limbs_set(limbs, d_val_limbs);
+  }
+  else
+  {
+    limbs_set_ui(limbs, d_val_uint64);
+  }
+}
+
+void
+BitVector::set_limbs(uint64_t size, const uint64_t* limbs)
+{
+  assert(size > 0);
+  assert(size <= s_limbs_size);
+  if (is_gmp())
+  {
+    mpz_clear(d_val_gmp);
+  }
+  d_size = size;
+  if (is_limbs())
+  {
+    limbs_set(d_val_limbs, limbs);
+  }
+  else
+  {
+    assert(limbs_cmp_ui(limbs, limbs[0]) == 0);
+    d_val_uint64 = limbs[0];
+  }
+}
+
 bool
 BitVector::shift_is_uint64(uint64_t* res) const
 {
@@ -42,6 +42,12 @@ class BitVector
   // 64-bit in d_val_uint64.
   static constexpr size_t s_native_size = sizeof(unsigned long) * 8;
   static_assert(s_native_size == sizeof(mp_bitcnt_t) * 8, "");
+  // Values that exceed s_native_size but require at most s_limbs_size bits
+  // are stored as a fixed-size array of 64-bit limbs, which avoids heap
+  // allocations (and the overhead of GMP) for the common case of 128-bit and
+  // 256-bit words. Values exceeding s_limbs_size are stored as GMP integers.
+  static constexpr size_t s_limbs_size = 256;
+  static_assert(s_limbs_size % 64 == 0 && s_limbs_size > s_native_size, "");
 
   /**
    * Determine if given string representation of a value in the given numeric
@@ -309,7 +315,15 @@ class BitVector
    * @return The uint64_t representation.
    */
   uint64_t to_uint64(bool truncate = false) const;
+  /**
+   * Get the value of this bit-vector as 64-bit limbs.
+   * @param limbs The limbs to store the value in, least significant limb
+   *              first. Must hold num_limbs() limbs.
+   */
+  void to_limbs(uint64_t* limbs) const;
 
+  /** @return The number of 64-bit limbs required to store the value. */
+  uint64_t num_limbs() const { return (d_size + 63) / 64; }
   /** @return the size of this bit-vector. */
   uint64_t size() const { return d_size; }
 
@@ -2207,9 +2221,19 @@ class BitVector
    */
   void bvudivurem(const BitVector& bv, BitVector* quot, BitVector* rem) const;
 
-  /** Get mpz_t value from Integer class. */
+  /**
+   * Get mpz_t value.
+   * @note Only bit-vectors of size > s_limbs_size are stored as mpz_t, use
+   *       get_mpz() for bit-vectors of arbitrary size.
+   */
   const mpz_t& gmp_value() const;
 
+  /**
+   * Store the value of this bit-vector in `res`.
+   * @param res The (initialized) mpz_t to store the value in.
+   */
+  void get_mpz(mpz_t res) const;
+
  private:
   /**
    * Normalize uint64_t value for a given bit-width.
@@ -2248,14 +2272,40 @@ class BitVector
   uint64_t get_limb(void* limb, uint64_t nbits_rem, bool zeros) const;
 
   /**
-   * Determine whether value is stored as GMP value or uint64_t. This check
-   * depends on s_native_size, i.e., for 64-bit Windows values exceeding 32
-   * bit are stored as GMP value, for 64-bit Linux and macOS values exceeding
-   * 64 bit are stored as GMP value.
+   * Determine whether value is stored as GMP value. Values up to
+   * s_native_size bits are stored as uint64_t, values up to s_limbs_size bits
+   * as fixed-size array of limbs, and values exceeding s_limbs_size bits as
+   * GMP value.
    *
    * @return True if bit-vector wraps a mpz_t.
    */
-  bool is_gmp() const { return d_size > s_native_size; }
+  bool is_gmp() const { return d_size > s_limbs_size; }
+  /**
+   * Determine whether value is stored as fixed-size array of limbs, i.e., if
+   * its size exceeds s_native_size but not s_limbs_size.
+   *
+   * @return True if bit-vector is stored in d_val_limbs.
+   */
+  bool is_limbs() const
+  {
+    return d_size > s_native_size && d_size <= s_limbs_size;
+  }
+  /**
+   * Copy the value of this bit-vector into the given limbs, zero-extended to
+   * s_limbs_size bits.
+   * @note Requires that this bit-vector is not stored as GMP value.
+   * @param limbs The limbs to store the value in.
+   */
+  void get_limbs(uint64_t* limbs) const;
+  /**
+   * Set this bit-vector to a bit-vector of given size and value, given as
+   * zero-extended limbs. Releases the GMP value if this bit-vector is
+   * currently stored as GMP value.
+   * @note Requires size <= s_limbs_size and `limbs` to be normalized to size.
+   * @param size  The size of the bit-vector.
+   * @param limbs The value.
+   */
+  void set_limbs(uint64_t size, const uint64_t* limbs);
 
   /** The size of this bit-vector. */
   uint64_t d_size = 0;
@@ -2271,6 +2321,8 @@ class BitVector
   union
   {
     uint64_t d_val_uint64;
+    /** Least significant limb first, normalized to d_size. */
+    uint64_t d_val_limbs[s_limbs_size / 64];
     mpz_t d_val_gmp;
   };
 };
@@ -0,0 +1,238 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "ls/bv/bitvector_batch_evaluator.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "ls/bv/bitvector_node.h"
+
+namespace bzla::ls {
+
+namespace {
+
+/** @return A mask for the lower `size` bits. */
+uint64_t
+mask_of(uint64_t size)
+{
+  assert(size > 0 && size <= 64);
+  return size == 64 ? ~UINT64_C(0) : (UINT64_C(1) << size) - 1;
+}
+
+/** @return The sign-extension of given value of bit-width `size` to 64 bit. */
+int64_t
+sext64(uint64_t value, uint64_t size)
+{
+  return static_cast<int64_t>(value << (64 - size)) >> (64 - size);
+}
+
+}  // namespace
+
+/* --- BitVectorBatchEvaluator public -------------------------------------- */
+
+BitVectorBatchEvaluator::BitVectorBatchEvaluator(size_t num_lanes)
+    : d_num_lanes(num_lanes)
+{
+  assert(num_lanes > 0);
+}
+
+bool
+BitVectorBatchEvaluator::add(const BitVectorNode* node)
+{
+  assert(node->id() == num_nodes());
+  uint64_t size = node->size();
+  if (size > MAX_SIZE)
+  {
+    return false;
+  }
+
+  Instruction instr{node->kind(), size, 0, {0, 0, 0}};
+  for (uint32_t i = 0, arity = node->arity(); i < arity; ++i)
+  {
+    assert(node->child(i)->id() < node->id());
+    instr.d_args[i] = node->child(i)->id();
+  }
+  switch (instr.d_kind)
+  {
+    case NodeKind::BV_EXTRACT:
+      instr.d_param = static_cast<const BitVectorExtract*>(node)->lo();
+      break;
+    case NodeKind::BV_CONCAT: instr.d_param = node->child(1)->size(); break;
+    case NodeKind::BV_SLT:
+    case NodeKind::BV_SEXT: instr.d_param = node->child(0)->size(); break;
+    default: break;
+  }
+
+  d_instructions.push_back(instr);
+  d_lanes.resize(d_instructions.size() * d_num_lanes);
+  if (node->arity() == 0)
+  {
+    d_inputs.push_back(node->id());
+    set(node->id(), node->assignment().to_uint64());
+  }
+  return true;
+}
+
+void
+BitVectorBatchEvaluator::set(uint64_t id, uint64_t value)
+{
+  assert(id < num_nodes());
+  assert(d_instructions[id].d_kind == NodeKind::CONST);
+  assert((value & ~mask_of(d_instructions[id].d_size)) == 0);
+  uint64_t* res = mutable_lanes(id);
+  std::fill(res, res + d_num_lanes, value);
+}
+
+void
+BitVectorBatchEvaluator::set(uint64_t id, size_t lane, uint64_t value)
+{
+  assert(id < num_nodes());
+  assert(lane < d_num_lanes);
+  assert(d_instructions[id].d_kind == NodeKind::CONST);
+  assert((value & ~mask_of(d_instructions[id].d_size)) == 0);
+  mutable_lanes(id)[lane] = value;
+}
+
+void
+BitVectorBatchEvaluator::evaluate()
+{
+  for (size_t id = 0, n = d_instructions.size(); id < n; ++id)
+  {
+    evaluate(d_instructions[id], mutable_lanes(id));
+  }
+}
+
+uint64_t
+BitVectorBatchEvaluator::get(uint64_t id, size_t lane) const
+{
+  assert(id < num_nodes());
+  assert(lane < d_num_lanes);
+  return lanes(id)[lane];
+}
+
+/* --- BitVectorBatchEvaluator private ------------------------------------- */
+
+void
+BitVectorBatchEvaluator::evaluate(const Instruction& instr, uint64_t* res)
+{
+  size_t n          = d_num_lanes;
+  uint64_t size     = instr.d_size;
+  uint64_t mask     = mask_of(size);
+  const uint64_t* a = lanes(instr.d_args[0]);
+  const uint64_t* b = lanes(instr.d_args[1]);
+  const uint64_t* c = lanes(instr.d_args[2]);
+
+  switch (instr.d_kind)
+  {
+    case NodeKind::CONST: break;
+
+    case NodeKind::NOT:
+    case NodeKind::BV_NOT:
+      for (size_t i = 0; i < n; ++i) res[i] = ~a[i] & mask;
+      break;
+
+    case NodeKind::AND:
+    case NodeKind::BV_AND:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] & b[i];
+      break;
+
+    case NodeKind::XOR:
+    case NodeKind::BV_XOR:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] ^ b[i];
+      break;
+
+    case NodeKind::EQ:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] == b[i];
+      break;
+
+    case NodeKind::ITE:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t m = -a[i];
+        res[i]     = (b[i] & m) | (c[i] & ~m);
+      }
+      break;
+
+    case NodeKind::BV_ADD:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] + b[i]) & mask;
+      break;
+
+    case NodeKind::BV_MUL:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] * b[i]) & mask;
+      break;
+
+    case NodeKind::BV_SHL:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = b[i] >= size ? 0 : (a[i] << b[i]) & mask;
+      }
+      break;
+
+    case NodeKind::BV_SHR:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = b[i] >= size ? 0 : a[i] >> b[i];
+      }
+      break;
+
+    case NodeKind::BV_ASHR:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t shift = b[i] >= size ? size - 1 : b[i];
+        res[i] = static_cast<uint64_t>(sext64(a[i], size) >> shift) & mask;
+      }
+      break;
+
+    case NodeKind::BV_UDIV:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = b[i] == 0 ? mask : a[i] / b[i];
+      }
+      break;
+
+    case NodeKind::BV_UREM:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = b[i] == 0 ? a[i] : a[i] % b[i];
+      }
+      break;
+
+    case NodeKind::BV_ULT:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] < b[i];
+      break;
+
+    case NodeKind::BV_SLT:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = sext64(a[i], instr.d_param) < sext64(b[i], instr.d_param);
+      }
+      break;
+
+    case NodeKind::BV_CONCAT:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] << instr.d_param) | b[i];
+      break;
+
+    case NodeKind::BV_EXTRACT:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] >> instr.d_param) & mask;
+      break;
+
+    case NodeKind::BV_SEXT:
+      for (size_t i = 0; i < n; ++i)
+      {
+        res[i] = static_cast<uint64_t>(sext64(a[i], instr.d_param)) & mask;
+      }
+      break;
+
+    default: assert(false);
+  }
+}
+
+}  // namespace bzla::ls
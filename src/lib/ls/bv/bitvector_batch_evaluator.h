@@ -0,0 +1,131 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__LS_BITVECTOR_BATCH_EVALUATOR_H
+#define BZLA__LS_BITVECTOR_BATCH_EVALUATOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ls/ls.h"
+
+namespace bzla::ls {
+
+class BitVectorNode;
+
+/**
+ * Evaluator for bit-vector nodes of bit-width <= 64 over many assignments of
+ * the leaf nodes at once.
+ *
+ * Nodes are compiled into a flat array of instructions indexed by node id.
+ * Since children are always created before their parents, evaluating the
+ * instructions in order of node ids evaluates children first. Each
+ * instruction owns `num_lanes` consecutive 64-bit lanes, one per assignment
+ * (struct-of-arrays layout), and is evaluated by a tight loop over all lanes
+ * that the compiler can vectorize. Values are zero-extended to 64 bits.
+ */
+class BitVectorBatchEvaluator
+{
+ public:
+  /** The maximum bit-width of nodes that can be compiled. */
+  static constexpr uint64_t MAX_SIZE = 64;
+
+  /**
+   * Constructor.
+   * @param num_lanes The number of assignments to evaluate at once.
+   */
+  BitVectorBatchEvaluator(size_t num_lanes);
+
+  /**
+   * Compile given node.
+   * @param node The node to compile, its id must be equal to num_nodes().
+   * @return False if the node is wider than MAX_SIZE bits, in which case it
+   *         is not added.
+   */
+  bool add(const BitVectorNode* node);
+
+  /** @return The number of assignments evaluated at once. */
+  size_t num_lanes() const { return d_num_lanes; }
+  /** @return The number of compiled nodes. */
+  size_t num_nodes() const { return d_instructions.size(); }
+  /** @return The ids of the compiled leaf nodes. */
+  const std::vector<uint64_t>& inputs() const { return d_inputs; }
+
+  /**
+   * Set the value of a leaf node in all lanes.
+   * @param id    The id of the leaf node.
+   * @param value The value, must fit into the bit-width of the node.
+   */
+  void set(uint64_t id, uint64_t value);
+  /**
+   * Set the value of a leaf node in a lane.
+   * @param id    The id of the leaf node.
+   * @param lane  The lane.
+   * @param value The value, must fit into the bit-width of the node.
+   */
+  void set(uint64_t id, size_t lane, uint64_t value);
+
+  /** Evaluate all compiled nodes over all lanes. */
+  void evaluate();
+
+  /**
+   * Get the value of a node in a lane after evaluate().
+   * @param id   The id of the node.
+   * @param lane The lane.
+   * @return The value of the node in `lane`.
+   */
+  uint64_t get(uint64_t id, size_t lane) const;
+  /**
+   * Get the lanes of a node after evaluate().
+   * @param id The id of the node.
+   * @return A pointer to the `num_lanes()` lanes of the node.
+   */
+  const uint64_t* lanes(uint64_t id) const
+  {
+    return &d_lanes[id * d_num_lanes];
+  }
+
+ private:
+  /** A compiled node. */
+  struct Instruction
+  {
+    /** The kind of the node. */
+    NodeKind d_kind;
+    /** The bit-width of the node. */
+    uint64_t d_size;
+    /**
+     * Kind-specific parameter: the lower index for BV_EXTRACT, the bit-width
+     * of the second operand for BV_CONCAT and the bit-width of the operands
+     * for BV_SLT and BV_SEXT.
+     */
+    uint64_t d_param;
+    /** The ids of the children. */
+    uint64_t d_args[3];
+  };
+
+  /** Evaluate given instruction over all lanes. */
+  void evaluate(const Instruction& instr, uint64_t* res);
+
+  /** @return The mutable lanes of the node with given id. */
+  uint64_t* mutable_lanes(uint64_t id) { return &d_lanes[id * d_num_lanes]; }
+
+  /** The number of assignments evaluated at once. */
+  size_t d_num_lanes;
+  /** The compiled nodes, indexed by node id. */
+  std::vector<Instruction> d_instructions;
+  /** The lanes of all compiled nodes. */
+  std::vector<uint64_t> d_lanes;
+  /** The ids of the compiled leaf nodes. */
+  std::vector<uint64_t> d_inputs;
+};
+
+}  // namespace bzla::ls
+
+#endif
@@ -5672,7 +5672,7 @@ BitVectorIte::select_path(const BitVector& t, std::vector<uint64_t>& ess_inputs)
   bool checked_essential = false;
   /* select essential input if any and path selection based on essential
    * inputs is enabled. */
-  if (s_path_sel_essential && d_rng->pick_with_prob(s_prob_pick_ess_input))
+  if (d_path_sel_essential && d_rng->pick_with_prob(d_prob_pick_ess_input))
   {
     /* determine essential inputs, disabled branches are excluded */
     checked_essential = true;
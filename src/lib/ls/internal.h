@@ -16,6 +16,28 @@
 
 namespace bzla::ls {
 
+template <class VALUE>
+struct LocalSearchMove
+{
+  LocalSearchMove() : d_nprops(0), d_nupdates(0), d_input(nullptr) {}
+
+  LocalSearchMove(uint64_t nprops,
+                  uint64_t nupdates,
+                  Node<VALUE>* input,
+                  VALUE assignment)
+      : d_nprops(nprops),
+        d_nupdates(nupdates),
+        d_input(input),
+        d_assignment(assignment)
+  {
+  }
+
+  uint64_t d_nprops;
+  uint64_t d_nupdates;
+  Node<VALUE>* d_input;
+  VALUE d_assignment;
+};
+
 template <class VALUE>
 struct LocalSearch<VALUE>::StatisticsInternal
 {
@@ -33,6 +55,8 @@ struct LocalSearch<VALUE>::StatisticsInternal
 
   uint64_t& num_conflicts;
 
+  uint64_t& num_move_candidates;
+
 #ifndef NDEBUG
   util::HistogramStatistic& num_inv_values;
   util::HistogramStatistic& num_cons_values;
@@ -45,6 +69,7 @@ struct LocalSearch<VALUE>::StatisticsInternal
   util::TimerStatistic& time_move;
   util::TimerStatistic& time_update_cone;
   util::TimerStatistic& time_init_assignment;
+  util::TimerStatistic& time_select_move_candidate;
 };
 
 template <class VALUE>
@@ -60,6 +85,8 @@ LocalSearch<VALUE>::StatisticsInternal::StatisticsInternal(
       num_props_inv(stats.new_stat<uint64_t>(prefix + "num_props_inv")),
       num_props_cons(stats.new_stat<uint64_t>(prefix + "num_props_cons")),
       num_conflicts(stats.new_stat<uint64_t>(prefix + "num_conflicts")),
+      num_move_candidates(
+          stats.new_stat<uint64_t>(prefix + "num_move_candidates")),
 #ifndef NDEBUG
       num_inv_values(
           stats.new_stat<util::HistogramStatistic>(prefix + "num_inv_values")),
@@ -80,7 +107,9 @@ LocalSearch<VALUE>::StatisticsInternal::StatisticsInternal(
       time_update_cone(
           stats.new_stat<util::TimerStatistic>(prefix + "time_update_cone")),
       time_init_assignment(
-          stats.new_stat<util::TimerStatistic>(prefix + "time_init_assignment"))
+          stats.new_stat<util::TimerStatistic>(prefix + "time_init_assignment")),
+      time_select_move_candidate(stats.new_stat<util::TimerStatistic>(
+          prefix + "time_select_move_candidate"))
 {
 }
 
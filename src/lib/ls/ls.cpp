@@ -42,28 +42,6 @@ operator<<(std::ostream& out, const NodeKind& kind)
 
 /* -------------------------------------------------------------------------- */
 
-template <class VALUE>
-struct LocalSearchMove
-{
-  LocalSearchMove() : d_nprops(0), d_nupdates(0), d_input(nullptr) {}
-
-  LocalSearchMove(uint64_t nprops,
-                  uint64_t nupdates,
-                  Node<VALUE>* input,
-                  VALUE assignment)
-      : d_nprops(nprops),
-        d_nupdates(nupdates),
-        d_input(input),
-        d_assignment(assignment)
-  {
-  }
-
-  uint64_t d_nprops;
-  uint64_t d_nupdates;
-  Node<VALUE>* d_input;
-  VALUE d_assignment;
-};
-
 template struct LocalSearchMove<BitVector>;
 
 /* -------------------------------------------------------------------------- */
@@ -152,14 +130,6 @@ LocalSearch<VALUE>::statistics() const
   };
 }
 
-template <class VALUE>
-void
-LocalSearch<VALUE>::init()
-{
-  Node<VALUE>::s_path_sel_essential  = d_options.use_path_sel_essential;
-  Node<VALUE>::s_prob_pick_ess_input = d_options.prob_pick_ess_input;
-}
-
 template <class VALUE>
 uint64_t
 LocalSearch<VALUE>::num_moves() const
@@ -474,6 +444,15 @@ LocalSearch<VALUE>::select_move(Node<VALUE>* root, const VALUE& t_root)
   return LocalSearchMove<VALUE>(nprops, nupdates, nullptr, VALUE());
 }
 
+template <class VALUE>
+size_t
+LocalSearch<VALUE>::select_move_candidate(
+    const std::vector<LocalSearchMove<VALUE>>& moves)
+{
+  (void) moves;
+  return 0;
+}
+
 template <class VALUE>
 void
 LocalSearch<VALUE>::update_unsat_roots(Node<VALUE>* root)
@@ -698,16 +677,21 @@ LocalSearch<VALUE>::move()
 
   if (d_roots_unsat.empty()) return Result::SAT;
 
-  LocalSearchMove<VALUE> m;
+  // Conflicts are retried until a first move is found, additional candidate
+  // moves are selected with a bounded number of tries.
+  uint32_t num_candidates = std::max(d_options.num_move_candidates, 1u);
+  uint32_t num_tries      = 0;
+  std::vector<LocalSearchMove<VALUE>> moves;
   do
   {
-    if (d_max_nprops > 0 && stats.num_props >= d_max_nprops)
-    {
-      return Result::UNKNOWN;
-    }
-    if (d_max_nupdates > 0 && stats.num_updates >= d_max_nupdates)
+    if ((d_max_nprops > 0 && stats.num_props >= d_max_nprops)
+        || (d_max_nupdates > 0 && stats.num_updates >= d_max_nupdates))
     {
-      return Result::UNKNOWN;
+      if (moves.empty())
+      {
+        return Result::UNKNOWN;
+      }
+      break;
     }
 
     Node<VALUE>* root =
@@ -724,11 +708,29 @@ LocalSearch<VALUE>::move()
     Log(1);
     Log(1) << " ** select constraint: " << *root;
 
-    m = select_move(root, *d_true);
-    stats.num_props += m.d_nprops;
-    stats.num_updates += m.d_nupdates;
-  } while (m.d_input == nullptr);
+    LocalSearchMove<VALUE> cand = select_move(root, *d_true);
+    stats.num_props += cand.d_nprops;
+    stats.num_updates += cand.d_nupdates;
+    if (cand.d_input != nullptr)
+    {
+      moves.push_back(std::move(cand));
+    }
+    if (!moves.empty())
+    {
+      num_tries += 1;
+    }
+  } while (moves.empty() || num_tries < num_candidates);
 
+  size_t idx = 0;
+  if (moves.size() > 1)
+  {
+    util::Timer timer(stats.time_select_move_candidate);
+    stats.num_move_candidates += moves.size();
+    idx = select_move_candidate(moves);
+    assert(idx < moves.size());
+    Log(1) << "*** select move candidate " << idx << " of " << moves.size();
+  }
+  const LocalSearchMove<VALUE>& m = moves[idx];
   assert(!m.d_assignment.is_null());
 
   Log(1);
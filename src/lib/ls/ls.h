@@ -175,8 +175,16 @@ class LocalSearch
     /**
      * Probability for picking an essential input if there is one, and else
      * a random input (see use_path_sel_essential).
+     * @note The path selection options are applied to nodes when they are
+     *       created, and must thus be configured before creating nodes.
      */
     uint32_t prob_pick_ess_input = 990;
+    /**
+     * The number of candidate moves to select per move. If greater than 1,
+     * the move that satisfies the most roots is applied (see
+     * select_move_candidate()), else the first selected move is applied.
+     */
+    uint32_t num_move_candidates = 1;
   } d_options;
 
   /**
@@ -203,13 +211,6 @@ class LocalSearch
   /** Destructor. */
   virtual ~LocalSearch();
 
-  /**
-   * Initialize local search module.
-   * Must be called after all options are configured and before nodes are
-   * created.
-   */
-  void init();
-
   /**
    * Get the current number of moves.
    * @return The number of moves.
@@ -383,6 +384,16 @@ class LocalSearch
    * @return An object encapsulating all information necessary for that move.
    */
   LocalSearchMove<VALUE> select_move(Node<VALUE>* root, const VALUE& t_root);
+  /**
+   * Select the move to apply from a set of candidate moves.
+   *
+   * The default implementation selects the first candidate.
+   *
+   * @param moves The candidate moves, at least two.
+   * @return The index of the selected move.
+   */
+  virtual size_t select_move_candidate(
+      const std::vector<LocalSearchMove<VALUE>>& moves);
 
   /**
    * Log contents of parents map if given log_level is enabled.
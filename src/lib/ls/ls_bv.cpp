@@ -10,6 +10,7 @@
 
 #include "ls/ls_bv.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <iostream>
@@ -18,6 +19,7 @@
 #include "../util/hash_pair.h"
 #include "bv/bitvector.h"
 #include "bv/domain/bitvector_domain.h"
+#include "ls/bv/bitvector_batch_evaluator.h"
 #include "ls/bv/bitvector_node.h"
 #include "ls/internal.h"
 
@@ -45,6 +47,8 @@ LocalSearchBV::LocalSearchBV(uint64_t max_nprops,
   d_true.reset(new BitVector(BitVector::mk_true()));
 }
 
+LocalSearchBV::~LocalSearchBV() {}
+
 uint64_t
 LocalSearchBV::mk_node(NodeKind kind,
                        uint64_t size,
@@ -76,6 +80,8 @@ LocalSearchBV::mk_node(const BitVector& assignment,
       new BitVectorNode(d_rng.get(), assignment, domain));
   res->set_id(id);
   res->set_symbol(symbol);
+  res->configure_path_selection(d_options.use_path_sel_essential,
+                                d_options.prob_pick_ess_input);
   d_nodes.push_back(std::move(res));
   assert(get_node(id) == d_nodes.back().get());
   return id;
@@ -104,6 +110,30 @@ LocalSearchBV::fix_bit(uint64_t id, uint32_t idx, bool value)
   node->fix_bit(idx, value);
 }
 
+void
+LocalSearchBV::fix_leaf_bit(uint64_t id, uint32_t idx, bool value)
+{
+  assert(id < d_nodes.size());  // API check
+  BitVectorNode* node = get_node(id);
+  assert(is_leaf_node(node));           // API check
+  assert(idx < node->domain().size());  // API check
+  node->fix_bit(idx, value);
+  if (node->assignment().bit(idx) != value)
+  {
+    BitVector assignment = node->assignment();
+    assignment.set_bit(idx, value);
+    if (d_assignment_consistent)
+    {
+      update_cone(node, assignment);
+    }
+    else
+    {
+      // Assignments of the cone are computed on the next move.
+      node->set_assignment(assignment);
+    }
+  }
+}
+
 /* LocalSearchBv private ---------------------------------------------------- */
 
 uint64_t
@@ -257,6 +287,8 @@ LocalSearchBV::_mk_node(NodeKind kind,
   }
   res->set_id(id);
   res->set_symbol(symbol);
+  res->configure_path_selection(d_options.use_path_sel_essential,
+                                d_options.prob_pick_ess_input);
   d_nodes.push_back(std::move(res));
   assert(get_node(id) == d_nodes.back().get());
 
@@ -416,6 +448,56 @@ LocalSearchBV::compute_bounds(Node<BitVector>* node)
   }
 }
 
+size_t
+LocalSearchBV::select_move_candidate(
+    const std::vector<LocalSearchMove<BitVector>>& moves)
+{
+  assert(moves.size() > 1);
+  if (!d_batch_evaluator
+      || d_batch_evaluator->num_lanes() < d_options.num_move_candidates)
+  {
+    d_batch_evaluator.reset(
+        new BitVectorBatchEvaluator(d_options.num_move_candidates));
+    d_batch_evaluator_complete = true;
+  }
+  assert(moves.size() <= d_batch_evaluator->num_lanes());
+
+  // Compile nodes created since the last call.
+  while (d_batch_evaluator_complete
+         && d_batch_evaluator->num_nodes() < d_nodes.size())
+  {
+    d_batch_evaluator_complete =
+        d_batch_evaluator->add(get_node(d_batch_evaluator->num_nodes()));
+  }
+  if (!d_batch_evaluator_complete)
+  {
+    return 0;
+  }
+
+  // Lane i evaluates the current assignment with the move of candidate i.
+  for (uint64_t id : d_batch_evaluator->inputs())
+  {
+    d_batch_evaluator->set(id, get_node(id)->assignment().to_uint64());
+  }
+  for (size_t i = 0, n = moves.size(); i < n; ++i)
+  {
+    d_batch_evaluator->set(
+        moves[i].d_input->id(), i, moves[i].d_assignment.to_uint64());
+  }
+  d_batch_evaluator->evaluate();
+
+  std::vector<uint64_t> num_sat(moves.size(), 0);
+  for (uint64_t root : d_roots)
+  {
+    const uint64_t* lanes = d_batch_evaluator->lanes(root);
+    for (size_t i = 0, n = moves.size(); i < n; ++i)
+    {
+      num_sat[i] += lanes[i];
+    }
+  }
+  return std::max_element(num_sat.begin(), num_sat.end()) - num_sat.begin();
+}
+
 /* -------------------------------------------------------------------------- */
 
 }  // namespace bzla::ls
@@ -11,6 +11,7 @@
 #ifndef BZLA__LS_LS_BV_H
 #define BZLA__LS_LS_BV_H
 
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -23,6 +24,7 @@ class BitVectorDomain;
 
 namespace ls {
 
+class BitVectorBatchEvaluator;
 class BitVectorNode;
 
 class LocalSearchBV : public LocalSearch<BitVector>
@@ -48,6 +50,8 @@ class LocalSearchBV : public LocalSearch<BitVector>
                 uint32_t verbosity_level        = 0,
                 const std::string& stats_prefix = "lib::ls::bv::",
                 util::Statistics* statistics    = nullptr);
+  /** Destructor. */
+  ~LocalSearchBV();
   /**
    * Create node.
    * @param kind     The node kind.
@@ -107,8 +111,30 @@ class LocalSearchBV : public LocalSearch<BitVector>
   /** Fix domain bit of given node at index 'idx' to 'value'. */
   void fix_bit(uint64_t id, uint32_t idx, bool value);
 
+  /**
+   * Fix domain bit of given leaf node at index 'idx' to 'value'.
+   * If the current assignment of the node does not match, the bit is flipped
+   * and the assignments of the cone of the node are updated.
+   */
+  void fix_leaf_bit(uint64_t id, uint32_t idx, bool value);
+
   void compute_bounds(Node<BitVector>* node) override;
 
+ protected:
+  /**
+   * Select the candidate move that satisfies the most roots.
+   *
+   * The candidates are scored by evaluating all nodes with one candidate per
+   * lane of a batch evaluator. Ties are broken in favor of the candidate that
+   * was selected first. If any node is wider than
+   * BitVectorBatchEvaluator::MAX_SIZE bits, the first candidate is selected.
+   *
+   * @param moves The candidate moves, at least two.
+   * @return The index of the selected move.
+   */
+  size_t select_move_candidate(
+      const std::vector<LocalSearchMove<BitVector>>& moves) override;
+
  private:
   /**
    * Helper for creating a node.
@@ -153,6 +179,14 @@ class LocalSearchBV : public LocalSearch<BitVector>
    *            children.
    */
   void update_bounds_aux(BitVectorNode* root, int32_t pos);
+
+  /**
+   * The batch evaluator for scoring candidate moves, nodes are compiled
+   * lazily on select_move_candidate().
+   */
+  std::unique_ptr<BitVectorBatchEvaluator> d_batch_evaluator;
+  /** False if a node could not be compiled by the batch evaluator. */
+  bool d_batch_evaluator_complete = true;
 };
 
 }  // namespace ls
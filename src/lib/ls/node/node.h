@@ -28,18 +28,6 @@ template <class VALUE>
 class Node
 {
  public:
-  /**
-   * Path selection mode.
-   * True if path is to be selected based on essential inputs, false if it is
-   * to be selected randomly.
-   */
-  static inline bool s_path_sel_essential = true;
-  /**
-   * Probability for picking an essential input if there is one, and else
-   * a random input (see LocalSearch::d_options.use_path_sel_essential).
-   */
-  static inline uint32_t s_prob_pick_ess_input = 990;
-
   /** Destructor. */
   virtual ~Node();
 
@@ -179,6 +167,20 @@ class Node
    */
   virtual std::tuple<uint64_t, bool, bool> select_path(
       const VALUE& t, std::vector<uint64_t>& ess_inputs);
+  /**
+   * Configure path selection of this node.
+   * @param use_essential       True if path is to be selected based on
+   *                            essential inputs, false if it is to be selected
+   *                            randomly.
+   * @param prob_pick_ess_input Probability for picking an essential input if
+   *                            there is one, and else a random input.
+   */
+  void configure_path_selection(bool use_essential,
+                                uint32_t prob_pick_ess_input)
+  {
+    d_path_sel_essential  = use_essential;
+    d_prob_pick_ess_input = prob_pick_ess_input;
+  }
 
   /**
    * Get child at given index.
@@ -293,6 +295,18 @@ class Node
 
   /** The symbol associated with this node. */
   std::optional<std::string> d_symbol;
+
+  /**
+   * Path selection mode.
+   * True if path is to be selected based on essential inputs, false if it is
+   * to be selected randomly.
+   */
+  bool d_path_sel_essential = true;
+  /**
+   * Probability for picking an essential input if there is one, and else
+   * a random input (see LocalSearch::d_options.use_path_sel_essential).
+   */
+  uint32_t d_prob_pick_ess_input = 990;
 };
 
 std::ostream& operator<<(std::ostream& out, const Node<BitVector>& node);
@@ -23,7 +23,6 @@ int32_t
 main(int32_t argc, char* argv[])
 {
   bitwuzla::Options options;
-  bitwuzla::TermManager tm;
 
   std::vector<std::string> args;
   bzla::main::Options main_options =
@@ -33,6 +32,8 @@ main(int32_t argc, char* argv[])
   {
     set_time_limit(main_options.time_limit);
     options.set(args);
+    // Portfolio mode solves on multiple threads over the same terms.
+    bitwuzla::TermManager tm(options.get(bitwuzla::Option::PORTFOLIO) > 1);
 
     if (main_options.print_unsat_core)
     {
@@ -186,7 +186,7 @@ print_help()
   opts.emplace_back("",
                     format_longm("lang"),
                     format_dflt(dflt_opts.language),
-                    "input language {smt2, btor2}");
+                    "input language {smt2, btor2, bin}");
 
   // Format library options
   bitwuzla::Options options;
@@ -430,10 +430,10 @@ parse_options(int32_t argc, char* argv[], std::vector<std::string>& args)
     else if (check_opt_value(arg, "", "--lang"))
     {
       auto [opt, val] = parse_arg_val(argc, i, argv);
-      if (val != "smt2" && val != "btor2")
+      if (val != "smt2" && val != "btor2" && val != "bin")
       {
         Error() << "invalid input language given `" << val << "`, expected "
-                << "'smt2' or 'btor2'";
+                << "'smt2', 'btor2' or 'bin'";
       }
       opts.language = val;
       lang_forced   = true;
@@ -498,6 +498,10 @@ parse_options(int32_t argc, char* argv[], std::vector<std::string>& args)
     {
       opts.language = "btor2";
     }
+    else if (is_input_file(opts.infile_name, ".bin"))
+    {
+      opts.language = "bin";
+    }
     else
     {
       opts.language = "smt2";
@@ -33,21 +33,42 @@ class NodeData;
 class NodeUniqueTable;
 
 /**
- * Node info flags.
+ * Node info.
  *
- * Indicate whether a node with a given kind is below this node.
+ * Structural information about the DAG rooted at a node, computed once on
+ * node creation from the info of its children (see
+ * NodeManager::init_info()). This allows traversals to skip subtrees in O(1).
+ *
+ * Flags indicate whether a node with a given kind or type is below (or is)
+ * this node.
  */
 struct NodeInfo
 {
-  uint8_t quantifier : 1;  // Is EXISTS/FORALL node below?
-  uint8_t lambda : 1;      // Is LAMBDA node below?
-
-  NodeInfo() : quantifier(0), lambda(0) {}
-
+  /** Maximum representable depth, larger depths saturate. */
+  static constexpr uint32_t MAX_DEPTH = (1u << 24) - 1;
+
+  uint32_t quantifier : 1;     // Is EXISTS/FORALL node below?
+  uint32_t lambda : 1;         // Is LAMBDA node below?
+  uint32_t variable : 1;       // Is VARIABLE node below?
+  uint32_t array : 1;          // Is node of array type below?
+  uint32_t bv : 1;             // Is node of bit-vector type below?
+  uint32_t fp : 1;             // Is node of floating-point/RM type below?
+  uint32_t fun : 1;            // Is node of function type below?
+  uint32_t uninterpreted : 1;  // Is node of type over uninterpreted sort below?
+  /** Length of the longest path to a leaf, saturates at MAX_DEPTH. */
+  uint32_t depth : 24;
+
+  /** Merge flags of `info` into this info. */
   void set(const NodeInfo& info)
   {
     quantifier |= info.quantifier;
     lambda |= info.lambda;
+    variable |= info.variable;
+    array |= info.array;
+    bv |= info.bv;
+    fp |= info.fp;
+    fun |= info.fun;
+    uninterpreted |= info.uninterpreted;
   }
 };
 
@@ -203,7 +224,7 @@ class Node
   NodeManager* nm();
   const NodeManager* nm() const;
 
-  /** @return Node info flags. */
+  /** @return Node info. */
   const node::NodeInfo& node_info() const;
 
  private:
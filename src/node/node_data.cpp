@@ -20,7 +20,9 @@ namespace bzla::node {
 /* --- NodeData public ----------------------------------------------------- */
 
 NodeData*
-NodeData::alloc(Kind kind, const std::optional<std::string>& symbol)
+NodeData::alloc(NodeDataAllocator& allocator,
+                Kind kind,
+                const std::optional<std::string>& symbol)
 {
   size_t size         = sizeof(NodeData);
   size_t payload_size = sizeof(PayloadSymbol);
@@ -29,11 +31,7 @@ NodeData::alloc(Kind kind, const std::optional<std::string>& symbol)
   size_t reserved_size = sizeof(NodeData::d_payload);
   payload_size         = std::max(payload_size, reserved_size) - reserved_size;
 
-  NodeData* data = static_cast<NodeData*>(std::calloc(1, size + payload_size));
-  if (data == nullptr)
-  {
-    throw std::bad_alloc();
-  }
+  NodeData* data   = allocator.allocate(size + payload_size);
   data->d_kind     = kind;
   auto& payload    = data->payload_symbol();
   payload.d_symbol = symbol;
@@ -41,9 +39,10 @@ NodeData::alloc(Kind kind, const std::optional<std::string>& symbol)
 }
 
 NodeData*
-NodeData::alloc(Kind kind,
-                const std::vector<Node>& children,
-                const std::vector<uint64_t>& indices)
+NodeData::alloc(NodeDataAllocator& allocator,
+                Kind kind,
+                util::Span<Node> children,
+                util::Span<uint64_t> indices)
 {
   size_t size         = sizeof(NodeData);
   size_t payload_size = 0;
@@ -65,12 +64,8 @@ NodeData::alloc(Kind kind,
   size_t reserved_size = sizeof(NodeData::d_payload);
   payload_size         = std::max(payload_size, reserved_size) - reserved_size;
 
-  NodeData* data = static_cast<NodeData*>(std::calloc(1, size + payload_size));
-  if (data == nullptr)
-  {
-    throw std::bad_alloc();
-  }
-  data->d_kind = kind;
+  NodeData* data = allocator.allocate(size + payload_size);
+  data->d_kind   = kind;
 
   // Connect children payload
   if (!children.empty())
@@ -81,18 +76,8 @@ NodeData::alloc(Kind kind,
     {
       assert(!children[i].is_null());
       payload.d_children[i] = children[i];
-      data->d_info.set(children[i].node_info());
     }
     payload.d_num_children = children.size();
-
-    if (kind == Kind::FORALL || kind == Kind::EXISTS)
-    {
-      data->info().quantifier = 1;
-    }
-    else if (kind == Kind::LAMBDA)
-    {
-      data->info().lambda = 1;
-    }
   }
 
   // Connect indices payload
@@ -111,10 +96,10 @@ NodeData::alloc(Kind kind,
 }
 
 void
-NodeData::dealloc(NodeData* data)
+NodeData::dealloc(NodeDataAllocator& allocator, NodeData* data)
 {
   data->~NodeData();
-  std::free(data);
+  allocator.deallocate(data);
 }
 
 NodeData::~NodeData()
@@ -139,8 +124,13 @@ NodeData::~NodeData()
       auto& payload = payload_value<FloatingPoint>();
       payload.d_value.~FloatingPoint();
     }
+    else if (d_type.is_uninterpreted())
+    {
+      auto& payload = payload_value<std::string>();
+      payload.d_value.~basic_string();
+    }
   }
-  else if (d_kind == Kind::CONSTANT || d_kind == Kind::VALUE)
+  else if (d_kind == Kind::CONSTANT || d_kind == Kind::VARIABLE)
   {
     auto& payload = payload_symbol();
     payload.d_symbol.~optional();
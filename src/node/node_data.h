@@ -11,6 +11,7 @@
 #ifndef BZLA_NODE_NODE_DATA_H_INCLUDED
 #define BZLA_NODE_NODE_DATA_H_INCLUDED
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -18,7 +19,9 @@
 
 #include "node/kind_info.h"
 #include "node/node.h"
+#include "node/node_data_allocator.h"
 #include "type/type.h"
+#include "util/span.h"
 
 namespace bzla::node {
 
@@ -58,21 +61,25 @@ class NodeData
 {
   friend NodeManager;
   friend class NodeUniqueTable;
+  friend class NodeDataAllocator;
 
  public:
   using iterator = const Node*;
 
   /** Allocate node data for constants and variables. */
-  static NodeData* alloc(Kind kind, const std::optional<std::string>& symbol);
+  static NodeData* alloc(NodeDataAllocator& allocator,
+                         Kind kind,
+                         const std::optional<std::string>& symbol);
 
   /** Allocate node data for nodes with children. */
-  static NodeData* alloc(Kind kind,
-                         const std::vector<Node>& children,
-                         const std::vector<uint64_t>& indices);
+  static NodeData* alloc(NodeDataAllocator& allocator,
+                         Kind kind,
+                         util::Span<Node> children,
+                         util::Span<uint64_t> indices);
 
   /** Allocate node data for values. */
   template <class T>
-  static NodeData* alloc(const T& value)
+  static NodeData* alloc(NodeDataAllocator& allocator, const T& value)
   {
     size_t size         = sizeof(NodeData);
     size_t payload_size = sizeof(PayloadValue<T>);
@@ -81,13 +88,8 @@ class NodeData
     size_t reserved_size = sizeof(NodeData::d_payload);
     payload_size = std::max(payload_size, reserved_size) - reserved_size;
 
-    NodeData* data =
-        static_cast<NodeData*>(std::calloc(1, size + payload_size));
-    if (data == nullptr)
-    {
-      throw std::bad_alloc();
-    }
-    data->d_kind = Kind::VALUE;
+    NodeData* data = allocator.allocate(size + payload_size);
+    data->d_kind   = Kind::VALUE;
 
     auto& payload   = data->payload_value<T>();
     payload.d_value = value;
@@ -95,7 +97,7 @@ class NodeData
   }
 
   /** Deallocate node data. */
-  static void dealloc(NodeData* data);
+  static void dealloc(NodeDataAllocator& allocator, NodeData* data);
 
   NodeData() = delete;
   ~NodeData();
@@ -187,19 +189,48 @@ class NodeData
   std::optional<std::reference_wrapper<const std::string>> get_symbol() const;
 
   /** Increase the reference count by one. */
-  void inc_ref() { ++d_refs; }
+  void inc_ref()
+  {
+    if (d_concurrent)
+    {
+      d_refs.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    d_refs.store(d_refs.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+  }
 
   /**
    * Decrease the reference count by one.
    *
    * If reference count becomes zero, this node data object will be
-   * automatically garbage collected.
+   * automatically garbage collected. For node data of a thread-safe node
+   * manager, garbage collection is deferred (see
+   * NodeManager::collect_garbage()).
    */
   void dec_ref()
   {
     assert(d_refs > 0);
-    --d_refs;
-    if (d_refs == 0)
+    if (d_concurrent)
+    {
+      // The last reference is released by the node manager while holding the
+      // lock of the shard this node data is stored in, which synchronizes
+      // with lookups in the unique table and with collect_garbage().
+      uint32_t refs = d_refs.load(std::memory_order_relaxed);
+      while (refs > 1)
+      {
+        if (d_refs.compare_exchange_weak(
+                refs, refs - 1, std::memory_order_acq_rel))
+        {
+          return;
+        }
+      }
+      gc();
+      return;
+    }
+    uint32_t refs = d_refs.load(std::memory_order_relaxed) - 1;
+    d_refs.store(refs, std::memory_order_relaxed);
+    if (refs == 0)
     {
       gc();
     }
@@ -218,7 +249,7 @@ class NodeData
   /** @return Associated node manager instance. */
   NodeManager* nm() { return d_nm; }
 
-  /** @return Node info flags. */
+  /** @return Node info. */
   auto& info() { return d_info; }
 
  private:
@@ -285,18 +316,30 @@ class NodeData
 
   /** Associated node manager. */
   NodeManager* d_nm = nullptr;
-  /** Next node in unique table collision chain. */
-  NodeData* d_next = nullptr;
+  union
+  {
+    /**
+     * Next free slot in the node data allocator free list.
+     * @note Only used while this node data is not in use.
+     */
+    NodeData* d_next = nullptr;
+    /** Node info, only valid while this node data is in use. */
+    NodeInfo d_info;
+  };
   /** Node id. */
   uint64_t d_id = 0;
   /** Node type. */
   Type d_type;
   /** Number of references. */
-  uint32_t d_refs = 0;
+  std::atomic<uint32_t> d_refs = 0;
   /** Node kind. */
   Kind d_kind;
-  /** Node info flags. */
-  NodeInfo d_info;
+  /** Size class of the allocator slab this node data is stored in. */
+  uint8_t d_size_class = 0;
+  /** Node manager shard this node data is stored in. */
+  uint8_t d_shard : 7;
+  /** True if reference counting needs to be thread-safe. */
+  uint8_t d_concurrent : 1;
 
   /**
    * Payload placeholder.
@@ -0,0 +1,146 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_data_allocator.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+#include "node/node_data.h"
+
+namespace bzla::node {
+
+namespace {
+/**
+ * Size of the header that stores the allocation size of heap allocated node
+ * data objects. Must preserve the alignment of NodeData.
+ */
+constexpr size_t s_heap_header_size = NodeDataAllocator::s_granularity;
+}  // namespace
+
+/* --- NodeDataAllocator public --------------------------------------------- */
+
+NodeDataAllocator::NodeDataAllocator(Statistics& stats) : d_stats(stats)
+{
+  static_assert(s_heap_header_size >= sizeof(size_t));
+  static_assert(s_heap_header_size % alignof(NodeData) == 0);
+  static_assert(s_granularity % alignof(NodeData) == 0);
+  static_assert(s_block_size >= s_max_slab_size);
+}
+
+NodeDataAllocator::~NodeDataAllocator() {}
+
+NodeData*
+NodeDataAllocator::allocate(size_t size)
+{
+  uint8_t sc = size_class(size);
+
+  // Large node data objects are allocated on the heap.
+  if (sc == 0)
+  {
+    char* mem =
+        static_cast<char*>(std::calloc(1, s_heap_header_size + size));
+    if (mem == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t*>(mem) = size;
+    ++d_stats.d_num_nodes[0];
+    d_stats.d_num_bytes[0] += size;
+    return reinterpret_cast<NodeData*>(mem + s_heap_header_size);
+  }
+
+  Slab& slab = d_slabs[sc];
+  NodeData* data;
+  if (slab.d_free)
+  {
+    // Reuse previously deallocated slot.
+    data        = slab.d_free;
+    slab.d_free = data->d_next;
+    std::memset(static_cast<void*>(data), 0, sc * s_granularity);
+    ++d_stats.d_num_reused;
+  }
+  else
+  {
+    if (slab.d_cur + sc * s_granularity > slab.d_end)
+    {
+      new_block(sc);
+    }
+    // Note: Blocks are zero-initialized on allocation.
+    data = reinterpret_cast<NodeData*>(slab.d_cur);
+    slab.d_cur += sc * s_granularity;
+  }
+  data->d_size_class = sc;
+  ++d_stats.d_num_nodes[sc];
+  return data;
+}
+
+void
+NodeDataAllocator::deallocate(NodeData* data)
+{
+  uint8_t sc = data->d_size_class;
+  assert(sc < s_num_size_classes);
+  assert(d_stats.d_num_nodes[sc] > 0);
+  --d_stats.d_num_nodes[sc];
+
+  if (sc == 0)
+  {
+    char* mem = reinterpret_cast<char*>(data) - s_heap_header_size;
+    d_stats.d_num_bytes[0] -= *reinterpret_cast<size_t*>(mem);
+    std::free(mem);
+    return;
+  }
+
+  // Mark slot as unused (see for_each()) and prepend it to the free list.
+  Slab& slab    = d_slabs[sc];
+  data->d_nm    = nullptr;
+  data->d_next  = slab.d_free;
+  slab.d_free   = data;
+}
+
+void
+NodeDataAllocator::for_each(const std::function<void(NodeData*)>& fun)
+{
+  for (size_t sc = 1; sc < s_num_size_classes; ++sc)
+  {
+    Slab& slab       = d_slabs[sc];
+    size_t slot_size = sc * s_granularity;
+    for (size_t i = 0, size = slab.d_blocks.size(); i < size; ++i)
+    {
+      char* cur = slab.d_blocks[i].get();
+      // Only the last block is partially used.
+      char* end = i + 1 == size ? slab.d_cur : cur + s_block_size;
+      for (; cur + slot_size <= end; cur += slot_size)
+      {
+        NodeData* data = reinterpret_cast<NodeData*>(cur);
+        // Slots of deallocated node data have no associated node manager.
+        if (data->d_nm != nullptr)
+        {
+          fun(data);
+        }
+      }
+    }
+  }
+}
+
+/* --- NodeDataAllocator private -------------------------------------------- */
+
+void
+NodeDataAllocator::new_block(uint8_t size_class)
+{
+  Slab& slab = d_slabs[size_class];
+  slab.d_blocks.emplace_back(new char[s_block_size]());
+  slab.d_cur = slab.d_blocks.back().get();
+  slab.d_end = slab.d_cur + s_block_size;
+  d_stats.d_num_bytes[size_class] += s_block_size;
+}
+
+}  // namespace bzla::node
@@ -0,0 +1,127 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_DATA_ALLOCATOR_H_INCLUDED
+#define BZLA_NODE_NODE_DATA_ALLOCATOR_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace bzla::node {
+
+class NodeData;
+
+/**
+ * Size-class slab allocator for node data.
+ *
+ * Node data objects are allocated from contiguous per-size-class blocks.
+ * Deallocated slots are kept in a per-size-class free list and reused by
+ * subsequent allocations. Node data objects that exceed the largest size class
+ * (e.g., n-ary nodes with many children) are allocated on the heap.
+ *
+ * The allocator keeps track of all node data objects allocated from slabs,
+ * which allows the node manager to release remaining node data on destruction
+ * without maintaining a separate set of allocated nodes.
+ */
+class NodeDataAllocator
+{
+ public:
+  /** Granularity of size classes in bytes. */
+  static constexpr size_t s_granularity = 16;
+  /** Number of size classes. Size class 0 is reserved for heap allocations. */
+  static constexpr size_t s_num_size_classes = 33;
+  /** Maximum number of bytes that are served from slabs. */
+  static constexpr size_t s_max_slab_size =
+      (s_num_size_classes - 1) * s_granularity;
+  /** Size of a slab block in bytes. */
+  static constexpr size_t s_block_size = 64 * 1024;
+
+  struct Statistics
+  {
+    /** Number of live node data objects per size class. */
+    std::array<uint64_t, s_num_size_classes> d_num_nodes{};
+    /** Number of bytes reserved per size class. */
+    std::array<uint64_t, s_num_size_classes> d_num_bytes{};
+    /** Number of allocations served from a free list. */
+    uint64_t d_num_reused = 0;
+  };
+
+  /**
+   * Constructor.
+   * @param stats The statistics object to update.
+   */
+  NodeDataAllocator(Statistics& stats);
+  ~NodeDataAllocator();
+  NodeDataAllocator(const NodeDataAllocator&)            = delete;
+  NodeDataAllocator& operator=(const NodeDataAllocator&) = delete;
+
+  /**
+   * Allocate zero-initialized memory for a node data object.
+   * @param size The number of bytes required for the node data object,
+   *             including its payload.
+   * @return Pointer to the allocated memory.
+   */
+  NodeData* allocate(size_t size);
+
+  /**
+   * Release the memory of given node data object.
+   * @note The node data object must already be destructed.
+   * @param data The node data object to release.
+   */
+  void deallocate(NodeData* data);
+
+  /**
+   * Call `fun` for each live node data object allocated from a slab.
+   * @note Heap allocated node data objects are not visited.
+   */
+  void for_each(const std::function<void(NodeData*)>& fun);
+
+  /**
+   * @return The size class for node data objects of `size` bytes.
+   */
+  static uint8_t size_class(size_t size)
+  {
+    if (size > s_max_slab_size)
+    {
+      return 0;
+    }
+    return static_cast<uint8_t>((size + s_granularity - 1) / s_granularity);
+  }
+
+ private:
+  /** Slab data of a size class. */
+  struct Slab
+  {
+    /** Allocated blocks. */
+    std::vector<std::unique_ptr<char[]>> d_blocks;
+    /** Next free byte in the current block. */
+    char* d_cur = nullptr;
+    /** End of the current block. */
+    char* d_end = nullptr;
+    /** Head of the free list of deallocated slots. */
+    NodeData* d_free = nullptr;
+  };
+
+  /** Allocate new block for given size class. */
+  void new_block(uint8_t size_class);
+
+  /** The slabs, indexed by size class. */
+  std::array<Slab, s_num_size_classes> d_slabs;
+  /** The associated statistics. */
+  Statistics& d_stats;
+};
+
+}  // namespace bzla::node
+
+#endif
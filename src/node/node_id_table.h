@@ -0,0 +1,269 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+#define BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bzla::node {
+
+/**
+ * Storage of values indexed by node id.
+ *
+ * Node ids are dense and monotonic (see NodeManager::init_id()), which allows
+ * to index values directly by node id instead of hashing nodes. Values are
+ * stored in pages of fixed size, which are allocated on demand and never
+ * moved. The ids of stored values are additionally kept in a dense vector to
+ * support iteration and clearing in time linear in the number of stored
+ * values.
+ *
+ * References to stored values remain valid until they are erased. Iterators
+ * remain valid on insertion, erasing a value may move the last value (in
+ * iteration order) to the position of the erased value.
+ *
+ * @note The page table grows with the largest stored node id. Hence, this is
+ *       intended for caches over large parts of the node DAG. For small,
+ *       short-lived caches std::unordered_map may be the better choice.
+ *
+ * This is the underlying data structure of NodeMap and NodeSet.
+ */
+template <class Value>
+class NodeIdTable
+{
+  /** A storage slot for a single value. */
+  struct Slot
+  {
+    /** The position of the value in d_ids. */
+    size_t d_pos = 0;
+    /** The stored value. */
+    std::optional<Value> d_value;
+  };
+
+ public:
+  template <bool Const>
+  class Iterator
+  {
+    friend NodeIdTable;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Value;
+    using difference_type   = std::ptrdiff_t;
+    using pointer   = std::conditional_t<Const, const Value*, Value*>;
+    using reference = std::conditional_t<Const, const Value&, Value&>;
+
+    Iterator() = default;
+    /** Conversion from non-const iterator. */
+    template <bool C = Const, class = std::enable_if_t<C>>
+    Iterator(const Iterator<false>& other)
+        : d_table(other.d_table), d_pos(other.d_pos)
+    {
+    }
+
+    reference operator*() const { return d_table->value_at(d_pos); }
+    pointer operator->() const { return &d_table->value_at(d_pos); }
+
+    Iterator& operator++()
+    {
+      ++d_pos;
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator res = *this;
+      ++d_pos;
+      return res;
+    }
+
+    bool operator==(const Iterator& other) const
+    {
+      assert(d_table == other.d_table);
+      return d_pos == other.d_pos;
+    }
+    bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+   private:
+    template <bool>
+    friend class Iterator;
+
+    Iterator(const NodeIdTable* table, size_t pos) : d_table(table), d_pos(pos)
+    {
+    }
+
+    /** The associated table. */
+    const NodeIdTable* d_table = nullptr;
+    /** The position in NodeIdTable::d_ids. */
+    size_t d_pos = 0;
+  };
+
+  using iterator       = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  NodeIdTable() = default;
+  NodeIdTable(const NodeIdTable& other) { *this = other; }
+  NodeIdTable(NodeIdTable&& other) = default;
+
+  NodeIdTable& operator=(const NodeIdTable& other)
+  {
+    if (this != &other)
+    {
+      clear();
+      for (uint64_t id : other.d_ids)
+      {
+        emplace(id, *other.slot(id)->d_value);
+      }
+    }
+    return *this;
+  }
+  NodeIdTable& operator=(NodeIdTable&& other) = default;
+
+  /** @return The number of stored values. */
+  size_t size() const { return d_ids.size(); }
+  /** @return True if no values are stored. */
+  bool empty() const { return d_ids.empty(); }
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, d_ids.size()); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, d_ids.size()); }
+
+  /** @return Iterator to the value stored for `id`, or end() if none. */
+  iterator find(uint64_t id)
+  {
+    Slot* s = slot(id);
+    return s && s->d_value ? iterator(this, s->d_pos) : end();
+  }
+  const_iterator find(uint64_t id) const
+  {
+    Slot* s = slot(id);
+    return s && s->d_value ? const_iterator(this, s->d_pos) : end();
+  }
+
+  /**
+   * Construct value for `id` if no value is stored for `id` yet.
+   * @return Iterator to the value stored for `id` and true if the value was
+   *         newly constructed.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(uint64_t id, Args&&... args)
+  {
+    Slot& s = get_or_create_slot(id);
+    if (s.d_value)
+    {
+      return std::make_pair(iterator(this, s.d_pos), false);
+    }
+    s.d_value.emplace(std::forward<Args>(args)...);
+    s.d_pos = d_ids.size();
+    d_ids.push_back(id);
+    return std::make_pair(iterator(this, s.d_pos), true);
+  }
+
+  /**
+   * Erase value stored for `id`.
+   * @return The number of erased values.
+   */
+  size_t erase(uint64_t id)
+  {
+    Slot* s = slot(id);
+    if (s == nullptr || !s->d_value)
+    {
+      return 0;
+    }
+    // Move id of last value to the position of the erased value.
+    uint64_t last     = d_ids.back();
+    d_ids[s->d_pos]   = last;
+    slot(last)->d_pos = s->d_pos;
+    d_ids.pop_back();
+    s->d_value.reset();
+    return 1;
+  }
+
+  /**
+   * Erase value at given position.
+   * @return Iterator to the value that is now at the position of the erased
+   *         value.
+   */
+  iterator erase(const_iterator it)
+  {
+    assert(it.d_table == this);
+    assert(it.d_pos < d_ids.size());
+    erase(d_ids[it.d_pos]);
+    return iterator(this, it.d_pos);
+  }
+
+  /** Erase all values. Allocated pages are kept for reuse. */
+  void clear()
+  {
+    for (uint64_t id : d_ids)
+    {
+      slot(id)->d_value.reset();
+    }
+    d_ids.clear();
+  }
+
+ private:
+  /** Number of bits of a node id that determine the slot within a page. */
+  static constexpr size_t s_page_bits = 8;
+  /** Number of slots per page. */
+  static constexpr size_t s_page_size = 1 << s_page_bits;
+
+  /** @return The slot of `id`, nullptr if its page is not allocated. */
+  Slot* slot(uint64_t id) const
+  {
+    uint64_t page = id >> s_page_bits;
+    if (page >= d_pages.size() || d_pages[page] == nullptr)
+    {
+      return nullptr;
+    }
+    return &d_pages[page][id & (s_page_size - 1)];
+  }
+
+  /** @return The slot of `id`, allocates its page if necessary. */
+  Slot& get_or_create_slot(uint64_t id)
+  {
+    uint64_t page = id >> s_page_bits;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+    }
+    if (d_pages[page] == nullptr)
+    {
+      d_pages[page].reset(new Slot[s_page_size]);
+    }
+    return d_pages[page][id & (s_page_size - 1)];
+  }
+
+  /** @return The value at position `pos` in d_ids. */
+  Value& value_at(size_t pos) const
+  {
+    assert(pos < d_ids.size());
+    Slot* s = slot(d_ids[pos]);
+    assert(s && s->d_value);
+    return *s->d_value;
+  }
+
+  /** The allocated pages, indexed by node id divided by the page size. */
+  std::vector<std::unique_ptr<Slot[]>> d_pages;
+  /** The ids of the stored values. */
+  std::vector<uint64_t> d_ids;
+};
+
+}  // namespace bzla::node
+
+#endif
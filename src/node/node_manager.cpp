@@ -10,7 +10,7 @@
 
 #include "node/node_manager.h"
 
-#include <deque>
+#include <algorithm>
 #include <functional>
 
 #include "bv/bitvector.h"
@@ -24,6 +24,16 @@ using namespace node;
 
 /* --- NodeManager public -------------------------------------------------- */
 
+NodeManager::NodeManager(bool thread_safe)
+    : d_thread_safe(thread_safe), d_tm(thread_safe)
+{
+  size_t num_shards = thread_safe ? s_num_shards : 1;
+  for (size_t i = 0; i < num_shards; ++i)
+  {
+    d_shards.emplace_back(new Shard());
+  }
+}
+
 NodeManager::~NodeManager()
 {
   // Cleanup remaining node data for constants and variables.
@@ -32,9 +42,16 @@ NodeManager::~NodeManager()
   //       data leaks. However, nodes that are stored in static memory do not
   //       get garbage collected. Hence, we have to make sure to invalidate all
   //       node data before destructing the node manager.
-  for (NodeData* d : d_alloc_nodes)
+  for (auto& shard : d_shards)
   {
-    NodeData::dealloc(d);
+    auto& allocator = shard->d_allocator;
+    allocator.for_each([&allocator](NodeData* d) {
+      Kind kind = d->get_kind();
+      if (kind == Kind::CONSTANT || kind == Kind::VARIABLE)
+      {
+        NodeData::dealloc(allocator, d);
+      }
+    });
   }
 }
 
@@ -49,11 +66,7 @@ NodeManager::mk_const(const Type& t, const std::optional<std::string>& symbol)
 {
   assert(!t.is_null());
   assert(t.tm() == &d_tm);
-  NodeData* data = NodeData::alloc(Kind::CONSTANT, symbol);
-  data->d_type   = t;
-  init_id(data);
-  d_alloc_nodes.emplace(data);
-  return Node(data);
+  return mk_symbol(Kind::CONSTANT, t, symbol);
 }
 
 Node
@@ -66,8 +79,7 @@ NodeManager::mk_const_array(const Type& t, const Node& term)
   assert(t.tm() == &d_tm);
   assert(term.nm() == this);
 
-  NodeData* data = find_or_insert_node(Kind::CONST_ARRAY, t, {term}, {});
-  return Node(data);
+  return find_or_insert_node(Kind::CONST_ARRAY, t, {term}, {});
 }
 
 Node
@@ -75,82 +87,45 @@ NodeManager::mk_var(const Type& t, const std::optional<std::string>& symbol)
 {
   assert(!t.is_null());
   assert(t.tm() == &d_tm);
-  NodeData* data = NodeData::alloc(Kind::VARIABLE, symbol);
-  data->d_type   = t;
-  init_id(data);
-  d_alloc_nodes.emplace(data);
-  return Node(data);
+  return mk_symbol(Kind::VARIABLE, t, symbol);
 }
 
 Node
 NodeManager::mk_value(bool value)
 {
-  Type type             = mk_bool_type();
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_bool_type(), value);
 }
 
 Node
 NodeManager::mk_value(const BitVector& value)
 {
-  Type type             = mk_bv_type(value.size());
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_bv_type(value.size()), value);
 }
 
 Node
 NodeManager::mk_value(const RoundingMode value)
 {
-  Type type             = mk_rm_type();
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_rm_type(), value);
 }
 
 Node
 NodeManager::mk_value(const FloatingPoint& value)
 {
-  Type type =
-      mk_fp_type(value.get_exponent_size(), value.get_significand_size());
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(
+      mk_fp_type(value.get_exponent_size(), value.get_significand_size()),
+      value);
 }
 
 Node
 NodeManager::mk_value(const Type& t, const std::string& value)
 {
-  auto [inserted, data] = d_unique_table.find_or_insert(t, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = t;
-  }
-  return Node(data);
+  return find_or_insert_value(t, value);
 }
 
 Node
 NodeManager::mk_node(Kind kind,
-                     const std::vector<Node>& children,
-                     const std::vector<uint64_t>& indices)
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices)
 {
   assert(kind != Kind::CONSTANT);
   assert(kind != Kind::CONST_ARRAY);
@@ -160,8 +135,7 @@ NodeManager::mk_node(Kind kind,
     return c.nm() == this;
   }));
 
-  NodeData* data = find_or_insert_node(kind, Type(), children, indices);
-  return Node(data);
+  return find_or_insert_node(kind, Type(), children, indices);
 }
 
 Node
@@ -176,6 +150,79 @@ NodeManager::invert_node(const Node& node)
   return mk_node(node::Kind::BV_NOT, {node});
 }
 
+uint64_t
+NodeManager::collect_garbage()
+{
+  if (!d_thread_safe)
+  {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> gc_lock(d_gc_mutex);
+  std::vector<std::unique_lock<std::mutex>> locks;
+  for (auto& shard : d_shards)
+  {
+    locks.emplace_back(shard->d_mutex);
+  }
+
+  // Node data may have been recorded multiple times, or may have been
+  // referenced again since it was recorded.
+  std::vector<NodeData*> visit;
+  for (auto& shard : d_shards)
+  {
+    for (NodeData* d : shard->d_unreferenced)
+    {
+      if (d->d_refs.load(std::memory_order_relaxed) == 0)
+      {
+        visit.push_back(d);
+      }
+    }
+    shard->d_unreferenced.clear();
+  }
+  std::sort(visit.begin(), visit.end());
+  visit.erase(std::unique(visit.begin(), visit.end()), visit.end());
+
+  uint64_t num_released = 0;
+  while (!visit.empty())
+  {
+    NodeData* cur = visit.back();
+    visit.pop_back();
+    release(cur, visit);
+    ++num_released;
+  }
+
+  uint64_t num_live = 0;
+  for (auto& shard : d_shards)
+  {
+    num_live += shard->d_stats.d_num_node_data;
+  }
+  d_num_unreferenced.store(0, std::memory_order_relaxed);
+  d_gc_threshold.store(std::max(s_gc_min_unreferenced, num_live / 2),
+                       std::memory_order_relaxed);
+  return num_released;
+}
+
+NodeManager::Statistics
+NodeManager::statistics() const
+{
+  Statistics res;
+  for (auto& shard : d_shards)
+  {
+    auto lock         = this->lock(*shard);
+    const auto& stats = shard->d_stats;
+
+    res.d_num_node_data += stats.d_num_node_data;
+    res.d_num_node_data_dealloc += stats.d_num_node_data_dealloc;
+    for (size_t i = 0; i < NodeDataAllocator::s_num_size_classes; ++i)
+    {
+      res.d_allocator.d_num_nodes[i] += stats.d_allocator.d_num_nodes[i];
+      res.d_allocator.d_num_bytes[i] += stats.d_allocator.d_num_bytes[i];
+    }
+    res.d_allocator.d_num_reused += stats.d_allocator.d_num_reused;
+  }
+  return res;
+}
+
 Type
 NodeManager::mk_bool_type()
 {
@@ -220,8 +267,8 @@ NodeManager::mk_uninterpreted_type(const std::optional<std::string>& symbol)
 
 Type
 NodeManager::compute_type(Kind kind,
-                          const std::vector<Node>& children,
-                          const std::vector<uint64_t>& indices)
+                          util::Span<Node> children,
+                          util::Span<uint64_t> indices)
 {
   assert(check_type(kind, children, indices).first);
 
@@ -383,8 +430,8 @@ NodeManager::compute_type(Kind kind,
 
 std::pair<bool, std::string>
 NodeManager::check_type(Kind kind,
-                        const std::vector<Node>& children,
-                        const std::vector<uint64_t>& indices)
+                        util::Span<Node> children,
+                        util::Span<uint64_t> indices)
 {
   std::stringstream ss;
 
@@ -807,29 +854,190 @@ NodeManager::check_type(Kind kind,
 
 /* --- NodeManager private ------------------------------------------------- */
 
+std::unique_lock<std::mutex>
+NodeManager::lock(Shard& shard) const
+{
+  if (d_thread_safe)
+  {
+    return std::unique_lock<std::mutex>(shard.d_mutex);
+  }
+  return std::unique_lock<std::mutex>();
+}
+
+void
+NodeManager::maybe_collect_garbage()
+{
+  if (d_thread_safe
+      && d_num_unreferenced.load(std::memory_order_relaxed)
+             > d_gc_threshold.load(std::memory_order_relaxed))
+  {
+    collect_garbage();
+  }
+}
+
 void
-NodeManager::init_id(NodeData* data)
+NodeManager::init_id(NodeData* data, size_t shard)
 {
   assert(d_node_id_counter < UINT64_MAX);
   assert(data != nullptr);
   assert(data->d_id == 0);
-  data->d_id = d_node_id_counter++;
-  data->d_nm = this;
-  ++d_stats.d_num_node_data;
+  assert(shard < d_shards.size());
+  if (d_thread_safe)
+  {
+    data->d_id = d_node_id_counter.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    data->d_id = d_node_id_counter.load(std::memory_order_relaxed);
+    d_node_id_counter.store(data->d_id + 1, std::memory_order_relaxed);
+  }
+  data->d_nm         = this;
+  data->d_shard      = shard;
+  data->d_concurrent = d_thread_safe;
+  ++d_shards[shard]->d_stats.d_num_node_data;
+}
+
+namespace {
+
+/** @return True if given type is or contains an uninterpreted sort. */
+bool
+contains_uninterpreted(const Type& type)
+{
+  if (type.is_uninterpreted())
+  {
+    return true;
+  }
+  if (type.is_array())
+  {
+    return contains_uninterpreted(type.array_index())
+           || contains_uninterpreted(type.array_element());
+  }
+  if (type.is_fun())
+  {
+    for (const Type& t : type.fun_types())
+    {
+      if (contains_uninterpreted(t))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+void
+NodeManager::init_info(NodeData* data)
+{
+  assert(data != nullptr);
+  assert(!data->d_type.is_null());
+  node::NodeInfo& info = data->d_info;
+  uint32_t depth       = 0;
+  for (const Node& child : *data)
+  {
+    const node::NodeInfo& cinfo = child.node_info();
+    info.set(cinfo);
+    depth = std::max<uint32_t>(depth, cinfo.depth);
+  }
+  info.depth = std::min<uint32_t>(depth + (data->has_children() ? 1 : 0),
+                                  node::NodeInfo::MAX_DEPTH);
+
+  Kind kind = data->d_kind;
+  if (kind == Kind::FORALL || kind == Kind::EXISTS)
+  {
+    info.quantifier = 1;
+  }
+  else if (kind == Kind::LAMBDA)
+  {
+    info.lambda = 1;
+  }
+  else if (kind == Kind::VARIABLE)
+  {
+    info.variable = 1;
+  }
+
+  const Type& type = data->d_type;
+  if (type.is_array())
+  {
+    info.array = 1;
+  }
+  else if (type.is_bv())
+  {
+    info.bv = 1;
+  }
+  else if (type.is_fp() || type.is_rm())
+  {
+    info.fp = 1;
+  }
+  else if (type.is_fun())
+  {
+    info.fun = 1;
+  }
+  if (!info.uninterpreted && contains_uninterpreted(type))
+  {
+    info.uninterpreted = 1;
+  }
+}
+
+Node
+NodeManager::mk_symbol(Kind kind,
+                       const Type& t,
+                       const std::optional<std::string>& symbol)
+{
+  maybe_collect_garbage();
+  // Constants and variables are not hash consed, we distribute them over the
+  // shards based on the next node id.
+  size_t s =
+      d_thread_safe
+          ? shard_index(d_node_id_counter.load(std::memory_order_relaxed))
+          : 0;
+  Shard& shard   = *d_shards[s];
+  auto lock      = this->lock(shard);
+  NodeData* data = NodeData::alloc(shard.d_allocator, kind, symbol);
+  data->d_type   = t;
+  init_id(data, s);
+  init_info(data);
+  return Node(data);
 }
 
-NodeData*
+template <class T>
+Node
+NodeManager::find_or_insert_value(const Type& type, const T& value)
+{
+  maybe_collect_garbage();
+  size_t s =
+      d_thread_safe ? shard_index(NodeUniqueTable::hash_value(value)) : 0;
+  Shard& shard          = *d_shards[s];
+  auto lock             = this->lock(shard);
+  auto [inserted, data] = shard.d_unique_table.find_or_insert(type, value);
+  if (inserted)
+  {
+    init_id(data, s);
+    data->d_type = type;
+    init_info(data);
+  }
+  return Node(data);
+}
+
+Node
 NodeManager::find_or_insert_node(node::Kind kind,
                                  const Type& type,
-                                 const std::vector<Node>& children,
-                                 const std::vector<uint64_t>& indices)
+                                 util::Span<Node> children,
+                                 util::Span<uint64_t> indices)
 {
+  maybe_collect_garbage();
+  size_t s = d_thread_safe
+                 ? shard_index(NodeUniqueTable::hash(kind, children, indices))
+                 : 0;
+  Shard& shard = *d_shards[s];
+  auto lock    = this->lock(shard);
   auto [inserted, data] =
-      d_unique_table.find_or_insert(kind, type, children, indices);
+      shard.d_unique_table.find_or_insert(kind, type, children, indices);
   if (inserted)
   {
     // Initialize new node
-    init_id(data);
+    init_id(data, s);
     if (type.is_null())
     {
       data->d_type = compute_type(kind, children, indices);
@@ -838,64 +1046,90 @@ NodeManager::find_or_insert_node(node::Kind kind,
     {
       data->d_type = type;
     }
+    init_info(data);
   }
-  return data;
+  return Node(data);
 }
 
 void
 NodeManager::garbage_collect(NodeData* data)
 {
+  if (d_thread_safe)
+  {
+    // Release the last reference while holding the lock of the shard, see
+    // NodeData::dec_ref(). Node data is reclaimed in collect_garbage().
+    Shard& shard = *d_shards[data->d_shard];
+    std::lock_guard<std::mutex> lock(shard.d_mutex);
+    if (data->d_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      shard.d_unreferenced.push_back(data);
+      d_num_unreferenced.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+
   assert(data->d_refs == 0);
   assert(!d_in_gc_mode);
 
   d_in_gc_mode = true;
 
-  std::deque<NodeData*> visit{data};
-
-  NodeData* cur;
+  std::vector<NodeData*> visit{data};
   do
   {
-    cur = visit.front();
-    visit.pop_front();
+    NodeData* cur = visit.back();
+    visit.pop_back();
+    release(cur, visit);
+  } while (!visit.empty());
 
-    size_t num_children = cur->get_num_children();
-    Kind kind           = cur->get_kind();
+  d_in_gc_mode = false;
+}
 
-    // Erase node data before we modify children.
-    if (num_children > 0 || kind == Kind::VALUE)
-    {
-      d_unique_table.erase(cur);
-    }
+void
+NodeManager::release(NodeData* data, std::vector<NodeData*>& unreferenced)
+{
+  assert(data->d_refs == 0);
+  Shard& shard = *d_shards[data->d_shard];
+
+  size_t num_children = data->get_num_children();
+  Kind kind           = data->get_kind();
+
+  // Erase node data before we modify children.
+  if (num_children > 0 || kind == Kind::VALUE)
+  {
+    shard.d_unique_table.erase(data);
+  }
 
-    if (num_children > 0)
+  if (num_children > 0)
+  {
+    auto& payload = data->payload_children();
+    for (size_t i = 0; i < num_children; ++i)
     {
-      auto& payload = cur->payload_children();
-      for (size_t i = 0; i < num_children; ++i)
-      {
-        Node& child = payload.d_children[i];
-        auto d      = child.d_data;
-
-        // Manually decrement reference count to not trigger decrement of
-        // NodeData reference. This will avoid recursive calls to
-        // garbage_collect().
-        --d->d_refs;
-        child.d_data = nullptr;
-        if (d->d_refs == 0)
-        {
-          visit.push_back(d);
-        }
+      Node& child = payload.d_children[i];
+      auto d      = child.d_data;
+
+      // Manually decrement reference count to not trigger decrement of
+      // NodeData reference. This will avoid recursive calls to
+      // garbage_collect().
+      uint32_t refs;
+      if (d_thread_safe)
+      {
+        refs = d->d_refs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+      }
+      else
+      {
+        refs = d->d_refs.load(std::memory_order_relaxed) - 1;
+        d->d_refs.store(refs, std::memory_order_relaxed);
+      }
+      child.d_data = nullptr;
+      if (refs == 0)
+      {
+        unreferenced.push_back(d);
       }
     }
-    else if (kind == Kind::CONSTANT || kind == Kind::VARIABLE)
-    {
-      d_alloc_nodes.erase(cur);
-    }
-    NodeData::dealloc(cur);
-    --d_stats.d_num_node_data;
-    ++d_stats.d_num_node_data_dealloc;
-  } while (!visit.empty());
-
-  d_in_gc_mode = false;
+  }
+  NodeData::dealloc(shard.d_allocator, data);
+  --shard.d_stats.d_num_node_data;
+  ++shard.d_stats.d_num_node_data_dealloc;
 }
 
 const std::optional<std::reference_wrapper<const std::string>>
@@ -11,7 +11,10 @@
 #ifndef BZLA_NODE_NODE_MANAGER_H_INCLUDED
 #define BZLA_NODE_NODE_MANAGER_H_INCLUDED
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -19,8 +22,10 @@
 
 #include "node/node.h"
 #include "node/node_data.h"
+#include "node/node_data_allocator.h"
 #include "node/node_unique_table.h"
 #include "type/type_manager.h"
+#include "util/span.h"
 
 namespace bzla {
 
@@ -33,7 +38,25 @@ class NodeManager
   friend node::NodeData;
 
  public:
-  NodeManager() = default;
+  struct Statistics
+  {
+    uint64_t d_num_node_data = 0;
+    uint64_t d_num_node_data_dealloc = 0;
+    /** Node data allocator statistics (per size class). */
+    node::NodeDataAllocator::Statistics d_allocator;
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param thread_safe True to allow creating and releasing nodes from
+   *                    multiple threads concurrently. Node data is then
+   *                    distributed over multiple shards with separate locks,
+   *                    reference counting is atomic, and node data that
+   *                    becomes unreferenced is reclaimed in batches (see
+   *                    collect_garbage()).
+   */
+  NodeManager(bool thread_safe = false);
   ~NodeManager();
   NodeManager(const NodeManager&)            = delete;
   NodeManager& operator=(const NodeManager&) = delete;
@@ -115,14 +138,18 @@ class NodeManager
   /**
    * Create node of kind `kind` with given children and indices.
    *
+   * @note Children and indices may be given as vectors or brace-enclosed
+   *       lists. The latter do not require any heap allocation if the node
+   *       already exists.
+   *
    * @param kind Node kind.
    * @param children The children of the node.
    * @param indices The indices if kind is indexed.
    * @return Node of kind `kind`.
    */
   Node mk_node(node::Kind kind,
-               const std::vector<Node>& children,
-               const std::vector<uint64_t>& indices = {});
+               util::Span<Node> children,
+               util::Span<uint64_t> indices = {});
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
@@ -187,19 +214,86 @@ class NodeManager
       const std::optional<std::string>& symbol = std::nullopt);
 
   /** Type checking of children and indices based on kind. */
-  std::pair<bool, std::string> check_type(
-      node::Kind kind,
-      const std::vector<Node>& children,
-      const std::vector<uint64_t>& indices = {});
+  std::pair<bool, std::string> check_type(node::Kind kind,
+                                          util::Span<Node> children,
+                                          util::Span<uint64_t> indices = {});
 
 #ifndef NDEBUG
   /** @return Current maximum node id. */
   uint64_t max_node_id() const { return d_node_id_counter; }
 #endif
 
-  const auto& statistics() const { return d_stats; }
+  /** @return True if this node manager is thread-safe. */
+  bool is_thread_safe() const { return d_thread_safe; }
+
+  /**
+   * Reclaim all node data that is not referenced anymore.
+   *
+   * @note Only relevant in thread-safe mode, node data is otherwise reclaimed
+   *       as soon as it becomes unreferenced. Node creation is blocked while
+   *       collecting garbage. Called automatically on node creation once the
+   *       number of unreferenced node data objects exceeds a threshold.
+   *
+   * @return The number of reclaimed node data objects.
+   */
+  uint64_t collect_garbage();
+
+  /** @return Node manager statistics accumulated over all shards. */
+  Statistics statistics() const;
 
  private:
+  /** Number of bits used to determine the shard in thread-safe mode. */
+  static constexpr size_t s_shard_bits = 6;
+  /** Number of shards in thread-safe mode. */
+  static constexpr size_t s_num_shards = 1 << s_shard_bits;
+  /** Minimum number of unreferenced nodes to trigger collect_garbage(). */
+  static constexpr uint64_t s_gc_min_unreferenced = 1 << 16;
+
+  /**
+   * A partition of all node data with its own allocator, unique table and
+   * lock. Non-thread-safe node managers only use a single shard.
+   */
+  struct Shard
+  {
+    Shard() = default;
+    Shard(const Shard&)            = delete;
+    Shard& operator=(const Shard&) = delete;
+
+    /** Guards all members in thread-safe mode. */
+    std::mutex d_mutex;
+    /** Statistics of this shard. */
+    Statistics d_stats;
+    /**
+     * Allocator for node data objects.
+     *
+     * @note Must be declared before d_unique_table since the unique table
+     *       deallocates its node data on destruction.
+     */
+    node::NodeDataAllocator d_allocator{d_stats.d_allocator};
+    /** Lookup data structure for hash consing of node data. */
+    node::NodeUniqueTable d_unique_table{d_allocator};
+    /**
+     * Node data that became unreferenced (thread-safe mode only). May contain
+     * duplicates and node data that was referenced again since.
+     */
+    std::vector<node::NodeData*> d_unreferenced;
+  };
+
+  /**
+   * @return The index of the shard that stores node data with the given hash
+   *         value (thread-safe mode only).
+   */
+  static size_t shard_index(uint64_t hash)
+  {
+    return (hash * 0x9e3779b97f4a7c15u) >> (64 - s_shard_bits);
+  }
+
+  /** @return Lock on given shard, not locked if not in thread-safe mode. */
+  std::unique_lock<std::mutex> lock(Shard& shard) const;
+
+  /** Trigger collect_garbage() if enough node data became unreferenced. */
+  void maybe_collect_garbage();
+
   /**
    * Initialize node data.
    *
@@ -207,8 +301,28 @@ class NodeManager
    * manager.
    *
    * @param d Node data to initialize.
+   * @param shard The index of the shard the node data is stored in.
    */
-  void init_id(node::NodeData* d);
+  void init_id(node::NodeData* d, size_t shard);
+
+  /**
+   * Initialize node info of given node data from the info of its children,
+   * its kind and its type.
+   *
+   * @note Requires the type of `d` to be set.
+   *
+   * @param d Node data to initialize.
+   */
+  void init_info(node::NodeData* d);
+
+  /** Create constant or variable of given type. */
+  Node mk_symbol(node::Kind kind,
+                 const Type& t,
+                 const std::optional<std::string>& symbol);
+
+  /** Find or create value node. */
+  template <class T>
+  Node find_or_insert_value(const Type& type, const T& value);
 
   /**
    * Find or insert new node data based on given criteria.
@@ -217,51 +331,62 @@ class NodeManager
    * @param type The node type (needed for CONST_ARRAY).
    * @param children The node children.
    * @param indices The indices for indexed nodes.
-   * @return The node data pointer.
+   * @return The node.
    */
-  node::NodeData* find_or_insert_node(node::Kind kind,
-                                      const Type& type,
-                                      const std::vector<Node>& children,
-                                      const std::vector<uint64_t>& indices);
+  Node find_or_insert_node(node::Kind kind,
+                           const Type& type,
+                           util::Span<Node> children,
+                           util::Span<uint64_t> indices);
 
   /** Compute type for a node. */
   Type compute_type(node::Kind kind,
-                    const std::vector<Node>& children,
-                    const std::vector<uint64_t>& indices = {});
+                    util::Span<Node> children,
+                    util::Span<uint64_t> indices = {});
 
   /**
    * Garbage collect node data.
    *
    * @note This will recursively delete all node data objects for which the
-   *       reference count becomes zero.
+   *       reference count becomes zero. In thread-safe mode, node data is only
+   *       recorded as unreferenced and reclaimed by collect_garbage().
    *
    * @param d Node data to delete.
    */
   void garbage_collect(node::NodeData* d);
 
+  /**
+   * Release node data and decrement the reference count of its children.
+   *
+   * @param d Node data to delete.
+   * @param unreferenced Children whose reference count becomes zero are
+   *                     added to this vector.
+   */
+  void release(node::NodeData* d, std::vector<node::NodeData*>& unreferenced);
+
   const std::optional<std::reference_wrapper<const std::string>> get_symbol(
       const node::NodeData* d) const;
 
+  /** Indicates whether node manager is thread-safe. */
+  bool d_thread_safe;
+
   /** Type manager. */
   type::TypeManager d_tm;
 
   /** Node id counter. */
-  uint64_t d_node_id_counter = 1;
+  std::atomic<uint64_t> d_node_id_counter = 1;
 
   /** Indicates whether node manager is in garbage collection mode. */
   bool d_in_gc_mode = false;
 
-  /** Stores allocated node data objects for constants and variables. */
-  std::unordered_set<node::NodeData*> d_alloc_nodes;
+  /** Number of unreferenced node data objects (thread-safe mode only). */
+  std::atomic<uint64_t> d_num_unreferenced = 0;
+  /** Threshold of d_num_unreferenced to trigger collect_garbage(). */
+  std::atomic<uint64_t> d_gc_threshold = s_gc_min_unreferenced;
+  /** Serializes calls to collect_garbage(). */
+  std::mutex d_gc_mutex;
 
-  /** Lookup data structure for hash consing of node data. */
-  node::NodeUniqueTable d_unique_table;
-
-  struct Statistics
-  {
-    uint64_t d_num_node_data = 0;
-    uint64_t d_num_node_data_dealloc = 0;
-  } d_stats;
+  /** The node data shards. */
+  std::vector<std::unique_ptr<Shard>> d_shards;
 };
 
 }  // namespace bzla
@@ -0,0 +1,100 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_MAP_H_INCLUDED
+#define BZLA_NODE_NODE_MAP_H_INCLUDED
+
+#include <stdexcept>
+#include <tuple>
+
+#include "node/node.h"
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Map from nodes to values of type T, indexed by node id.
+ *
+ * Drop-in replacement for std::unordered_map<Node, T> for caches in hot
+ * traversals (see NodeIdTable). Iteration order is insertion order unless
+ * values were erased.
+ */
+template <class T>
+class NodeMap
+{
+ public:
+  using key_type       = Node;
+  using mapped_type    = T;
+  using value_type     = std::pair<const Node, T>;
+  using iterator       = typename NodeIdTable<value_type>::iterator;
+  using const_iterator = typename NodeIdTable<value_type>::const_iterator;
+
+  size_t size() const { return d_table.size(); }
+  bool empty() const { return d_table.empty(); }
+
+  iterator begin() { return d_table.begin(); }
+  iterator end() { return d_table.end(); }
+  const_iterator begin() const { return d_table.begin(); }
+  const_iterator end() const { return d_table.end(); }
+
+  iterator find(const Node& key) { return d_table.find(key.id()); }
+  const_iterator find(const Node& key) const { return d_table.find(key.id()); }
+
+  size_t count(const Node& key) const { return find(key) != end(); }
+
+  /** Insert `key` with value constructed from `args` if not present. */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(const Node& key, Args&&... args)
+  {
+    return d_table.emplace(key.id(),
+                           std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value)
+  {
+    return emplace(value.first, value.second);
+  }
+
+  T& operator[](const Node& key) { return emplace(key).first->second; }
+
+  T& at(const Node& key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("NodeMap::at");
+    }
+    return it->second;
+  }
+  const T& at(const Node& key) const
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("NodeMap::at");
+    }
+    return it->second;
+  }
+
+  size_t erase(const Node& key) { return d_table.erase(key.id()); }
+  iterator erase(const_iterator it) { return d_table.erase(it); }
+
+  void clear() { d_table.clear(); }
+
+ private:
+  /** The underlying storage. */
+  NodeIdTable<value_type> d_table;
+};
+
+}  // namespace bzla::node
+
+#endif
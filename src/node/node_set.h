@@ -0,0 +1,65 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_SET_H_INCLUDED
+#define BZLA_NODE_NODE_SET_H_INCLUDED
+
+#include "node/node.h"
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Set of nodes, indexed by node id.
+ *
+ * Drop-in replacement for std::unordered_set<Node> for caches in hot
+ * traversals (see NodeIdTable). Iteration order is insertion order unless
+ * nodes were erased.
+ */
+class NodeSet
+{
+ public:
+  using key_type   = Node;
+  using value_type = Node;
+  // Stored nodes must not be modified.
+  using iterator       = NodeIdTable<Node>::const_iterator;
+  using const_iterator = NodeIdTable<Node>::const_iterator;
+
+  size_t size() const { return d_table.size(); }
+  bool empty() const { return d_table.empty(); }
+
+  const_iterator begin() const { return d_table.begin(); }
+  const_iterator end() const { return d_table.end(); }
+
+  const_iterator find(const Node& node) const
+  {
+    return d_table.find(node.id());
+  }
+
+  size_t count(const Node& node) const { return find(node) != end(); }
+
+  std::pair<const_iterator, bool> insert(const Node& node)
+  {
+    return d_table.emplace(node.id(), node);
+  }
+
+  size_t erase(const Node& node) { return d_table.erase(node.id()); }
+  const_iterator erase(const_iterator it) { return d_table.erase(it); }
+
+  void clear() { d_table.clear(); }
+
+ private:
+  /** The underlying storage. */
+  NodeIdTable<Node> d_table;
+};
+
+}  // namespace bzla::node
+
+#endif
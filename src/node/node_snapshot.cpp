@@ -0,0 +1,797 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_snapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(__WIN32)
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "bv/bitvector.h"
+#include "node/node_manager.h"
+#include "node/node_map.h"
+#include "node/node_ref_vector.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
+#include "solver/fp/symfpu_nm.h"
+#include "util/exceptions.h"
+
+namespace bzla::node {
+
+namespace {
+
+/** The snapshot magic. */
+constexpr char s_magic[] = {'B', 'Z', 'L', 'A', 'S', 'N', 'A', 'P'};
+/** The snapshot format version. */
+constexpr uint64_t s_version = 1;
+
+/** Type tags of type table entries. */
+enum class TypeTag : uint8_t
+{
+  BOOL = 0,
+  BV,
+  FP,
+  RM,
+  ARRAY,
+  FUN,
+  UNINTERPRETED,
+  NUM_TAGS,
+};
+
+/* --- Writer -------------------------------------------------------------- */
+
+class SnapshotWriter
+{
+ public:
+  /** Write snapshot of DAGs rooted at `roots` to `out`. */
+  void write(std::ostream& out, const std::vector<Node>& roots)
+  {
+    std::string nodes;
+    // Post-order traversal yields children before parents.
+    NodeMap<bool> visited;
+    node_ref_vector visit(roots.begin(), roots.end());
+    while (!visit.empty())
+    {
+      const Node& cur     = visit.back();
+      auto [it, inserted] = visited.emplace(cur, false);
+      if (inserted)
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+        continue;
+      }
+      if (!it->second)
+      {
+        it->second = true;
+        write_node(nodes, cur);
+      }
+      visit.pop_back();
+    }
+
+    std::string buf(s_magic, sizeof(s_magic));
+    put_varint(buf, s_version);
+    put_varint(buf, static_cast<uint64_t>(Kind::NUM_KINDS));
+    put_varint(buf, d_num_types);
+    buf.append(d_types);
+    put_varint(buf, d_node_idx.size());
+    buf.append(nodes);
+    put_varint(buf, roots.size());
+    for (const Node& root : roots)
+    {
+      put_varint(buf, d_node_idx.at(root));
+    }
+    out.write(buf.data(), buf.size());
+  }
+
+ private:
+  static void put_varint(std::string& buf, uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      buf.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    buf.push_back(static_cast<char>(value));
+  }
+
+  static void put_string(std::string& buf, const std::string& str)
+  {
+    put_varint(buf, str.size());
+    buf.append(str);
+  }
+
+  /** Optional strings are encoded with their size incremented by one. */
+  static void put_symbol(std::string& buf,
+                         const std::optional<std::string>& symbol)
+  {
+    if (symbol)
+    {
+      put_varint(buf, symbol->size() + 1);
+      buf.append(*symbol);
+    }
+    else
+    {
+      put_varint(buf, 0);
+    }
+  }
+
+  /** Bit-vectors are encoded as 64-bit words, most significant word first. */
+  static void put_bv(std::string& buf, const BitVector& bv)
+  {
+    uint64_t size = bv.size();
+    if (size <= 64)
+    {
+      put_varint(buf, bv.to_uint64());
+      return;
+    }
+    uint64_t hi = size - 1;
+    uint64_t lo = (size - 1) / 64 * 64;
+    for (;;)
+    {
+      put_varint(buf, bv.bvextract(hi, lo).to_uint64());
+      if (lo == 0)
+      {
+        break;
+      }
+      hi = lo - 1;
+      lo -= 64;
+    }
+  }
+
+  /** @return The index of `type` in the type table. */
+  uint64_t type_index(const Type& type)
+  {
+    auto it = d_type_idx.find(type);
+    if (it != d_type_idx.end())
+    {
+      return it->second;
+    }
+    std::vector<uint64_t> refs;
+    if (type.is_array())
+    {
+      refs.push_back(type_index(type.array_index()));
+      refs.push_back(type_index(type.array_element()));
+    }
+    else if (type.is_fun())
+    {
+      for (const Type& t : type.fun_types())
+      {
+        refs.push_back(type_index(t));
+      }
+    }
+
+    if (type.is_bool())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::BOOL));
+    }
+    else if (type.is_bv())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::BV));
+      put_varint(d_types, type.bv_size());
+    }
+    else if (type.is_fp())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::FP));
+      put_varint(d_types, type.fp_exp_size());
+      put_varint(d_types, type.fp_sig_size());
+    }
+    else if (type.is_rm())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::RM));
+    }
+    else if (type.is_array())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::ARRAY));
+      put_varint(d_types, refs[0]);
+      put_varint(d_types, refs[1]);
+    }
+    else if (type.is_fun())
+    {
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::FUN));
+      put_varint(d_types, refs.size());
+      for (uint64_t ref : refs)
+      {
+        put_varint(d_types, ref);
+      }
+    }
+    else
+    {
+      assert(type.is_uninterpreted());
+      put_varint(d_types, static_cast<uint64_t>(TypeTag::UNINTERPRETED));
+      put_symbol(d_types, type.uninterpreted_symbol());
+    }
+    d_type_idx.emplace(type, d_num_types);
+    return d_num_types++;
+  }
+
+  /** Append the record of `node` to `buf`, all children must be written. */
+  void write_node(std::string& buf, const Node& node)
+  {
+    uint64_t idx = d_node_idx.size();
+    Kind kind    = node.kind();
+    put_varint(buf, static_cast<uint64_t>(kind));
+    switch (kind)
+    {
+      case Kind::CONSTANT:
+      case Kind::VARIABLE: {
+        put_varint(buf, type_index(node.type()));
+        auto symbol = node.symbol();
+        put_symbol(buf,
+                   symbol ? std::optional<std::string>(symbol->get())
+                          : std::nullopt);
+      }
+      break;
+
+      case Kind::VALUE: {
+        const Type& type = node.type();
+        put_varint(buf, type_index(type));
+        if (type.is_bool())
+        {
+          put_varint(buf, node.value<bool>());
+        }
+        else if (type.is_bv())
+        {
+          put_bv(buf, node.value<BitVector>());
+        }
+        else if (type.is_fp())
+        {
+          put_bv(buf, node.value<FloatingPoint>().as_bv());
+        }
+        else if (type.is_rm())
+        {
+          put_varint(buf, static_cast<uint64_t>(node.value<RoundingMode>()));
+        }
+        else
+        {
+          assert(type.is_uninterpreted());
+          put_string(buf, node.value<std::string>());
+        }
+      }
+      break;
+
+      case Kind::CONST_ARRAY:
+        put_varint(buf, type_index(node.type()));
+        put_varint(buf, idx - d_node_idx.at(node[0]));
+        break;
+
+      default:
+        put_varint(buf, node.num_children());
+        for (const Node& child : node)
+        {
+          put_varint(buf, idx - d_node_idx.at(child));
+        }
+        put_varint(buf, node.num_indices());
+        for (size_t i = 0, n = node.num_indices(); i < n; ++i)
+        {
+          put_varint(buf, node.index(i));
+        }
+    }
+    d_node_idx.emplace(node, idx);
+  }
+
+  /** The encoded type table. */
+  std::string d_types;
+  /** The number of entries in the type table. */
+  uint64_t d_num_types = 0;
+  /** Maps types to their index in the type table. */
+  std::unordered_map<Type, uint64_t> d_type_idx;
+  /** Maps nodes to their index in the node table. */
+  NodeMap<uint64_t> d_node_idx;
+};
+
+/* --- Reader -------------------------------------------------------------- */
+
+class SnapshotReader
+{
+ public:
+  SnapshotReader(NodeManager& nm, const char* data, size_t size)
+      : d_nm(nm),
+        d_cur(reinterpret_cast<const uint8_t*>(data)),
+        d_end(reinterpret_cast<const uint8_t*>(data) + size)
+  {
+  }
+
+  std::vector<Node> read()
+  {
+    if (!is_snapshot(reinterpret_cast<const char*>(d_cur), d_end - d_cur))
+    {
+      throw Error("invalid snapshot: missing magic");
+    }
+    d_cur += sizeof(s_magic);
+    if (get_varint() != s_version)
+    {
+      throw Error("invalid snapshot: unsupported format version");
+    }
+    if (get_varint() != static_cast<uint64_t>(Kind::NUM_KINDS))
+    {
+      throw Error("invalid snapshot: incompatible set of node kinds");
+    }
+
+    fp::SymFpuNM snm(d_nm);
+    read_types();
+    read_nodes();
+
+    uint64_t num_roots = get_count();
+    std::vector<Node> roots;
+    roots.reserve(num_roots);
+    for (uint64_t i = 0; i < num_roots; ++i)
+    {
+      uint64_t ref = get_varint();
+      if (ref >= d_nodes.size())
+      {
+        throw Error("invalid snapshot: invalid root reference");
+      }
+      roots.push_back(d_nodes[ref]);
+    }
+    if (d_cur != d_end)
+    {
+      throw Error("invalid snapshot: trailing data");
+    }
+    return roots;
+  }
+
+ private:
+  uint64_t get_varint()
+  {
+    uint64_t res = 0;
+    for (uint32_t shift = 0; shift < 64; shift += 7)
+    {
+      if (d_cur == d_end)
+      {
+        throw Error("invalid snapshot: unexpected end of data");
+      }
+      uint8_t byte = *d_cur++;
+      res |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+      {
+        return res;
+      }
+    }
+    throw Error("invalid snapshot: malformed integer");
+  }
+
+  /**
+   * Read number of entries. Every entry occupies at least one byte, which
+   * bounds the number of entries by the remaining data.
+   */
+  uint64_t get_count()
+  {
+    uint64_t res = get_varint();
+    if (res > static_cast<uint64_t>(d_end - d_cur))
+    {
+      throw Error("invalid snapshot: unexpected end of data");
+    }
+    return res;
+  }
+
+  std::string get_string(uint64_t size)
+  {
+    if (size > static_cast<uint64_t>(d_end - d_cur))
+    {
+      throw Error("invalid snapshot: unexpected end of data");
+    }
+    std::string res(reinterpret_cast<const char*>(d_cur), size);
+    d_cur += size;
+    return res;
+  }
+
+  std::optional<std::string> get_symbol()
+  {
+    uint64_t size = get_varint();
+    if (size == 0)
+    {
+      return std::nullopt;
+    }
+    return get_string(size - 1);
+  }
+
+  /**
+   * Read bit-vector value of given size. Every 64-bit word occupies at least
+   * one byte, which bounds the size by the remaining data.
+   */
+  BitVector get_bv(uint64_t size)
+  {
+    if ((size - 1) / 64 + 1 > static_cast<uint64_t>(d_end - d_cur))
+    {
+      throw Error("invalid snapshot: bit-vector value of size "
+                  + std::to_string(size) + " exceeds remaining data");
+    }
+    if (size <= 64)
+    {
+      return BitVector::from_ui(size, get_varint(), true);
+    }
+    uint64_t rem = size % 64;
+    BitVector res =
+        BitVector::from_ui(rem == 0 ? 64 : rem, get_varint(), true);
+    for (uint64_t i = 0, n = (size - 1) / 64; i < n; ++i)
+    {
+      res.ibvconcat(BitVector::from_ui(64, get_varint()));
+    }
+    return res;
+  }
+
+  /** Check that the given floating-point format is supported. */
+  static void check_fp_format(uint64_t exp_size, uint64_t sig_size)
+  {
+    if (exp_size < 2 || sig_size < 2)
+    {
+      throw Error("invalid snapshot: invalid floating-point type");
+    }
+#ifndef BZLA_USE_FPEXP
+    if (!(exp_size == 5 && sig_size == 11) && !(exp_size == 8 && sig_size == 24)
+        && !(exp_size == 11 && sig_size == 53)
+        && !(exp_size == 15 && sig_size == 113))
+    {
+      throw Error("invalid snapshot: unsupported floating-point format ("
+                  + std::to_string(exp_size) + ", " + std::to_string(sig_size)
+                  + ")");
+    }
+#endif
+  }
+
+  /**
+   * Check that the bit-vector size of a node of given kind does not exceed
+   * the maximum bit-vector size. Assumes that the node is well-typed.
+   */
+  static void check_bv_size(Kind kind,
+                            const std::vector<Node>& children,
+                            const std::vector<uint64_t>& indices)
+  {
+    bool overflow = false;
+    switch (kind)
+    {
+      case Kind::BV_CONCAT: {
+        uint64_t size = 0;
+        for (const Node& child : children)
+        {
+          uint64_t csize = child.type().bv_size();
+          if (csize > UINT64_MAX - size)
+          {
+            overflow = true;
+            break;
+          }
+          size += csize;
+        }
+      }
+      break;
+
+      case Kind::BV_REPEAT:
+        overflow = children[0].type().bv_size() > UINT64_MAX / indices[0];
+        break;
+
+      case Kind::BV_SIGN_EXTEND:
+      case Kind::BV_ZERO_EXTEND:
+        overflow = indices[0] > UINT64_MAX - children[0].type().bv_size();
+        break;
+
+      default: break;
+    }
+    if (overflow)
+    {
+      std::stringstream ss;
+      ss << "invalid snapshot: " << kind << ": resulting size exceeds maximum "
+         << "bit-vector size of " << UINT64_MAX;
+      throw Error(ss.str());
+    }
+  }
+
+  const Type& get_type()
+  {
+    uint64_t ref = get_varint();
+    if (ref >= d_types.size())
+    {
+      throw Error("invalid snapshot: invalid type reference");
+    }
+    return d_types[ref];
+  }
+
+  /** @return The node referenced relative to node index `idx`. */
+  const Node& get_child(uint64_t idx)
+  {
+    uint64_t delta = get_varint();
+    if (delta == 0 || delta > idx)
+    {
+      throw Error("invalid snapshot: invalid node reference");
+    }
+    return d_nodes[idx - delta];
+  }
+
+  void read_types()
+  {
+    uint64_t num_types = get_count();
+    d_types.reserve(num_types);
+    for (uint64_t i = 0; i < num_types; ++i)
+    {
+      uint64_t tag = get_varint();
+      switch (static_cast<TypeTag>(tag))
+      {
+        case TypeTag::BOOL: d_types.push_back(d_nm.mk_bool_type()); break;
+
+        case TypeTag::BV: {
+          uint64_t size = get_varint();
+          if (size == 0)
+          {
+            throw Error("invalid snapshot: invalid bit-vector type");
+          }
+          d_types.push_back(d_nm.mk_bv_type(size));
+        }
+        break;
+
+        case TypeTag::FP: {
+          uint64_t exp_size = get_varint();
+          uint64_t sig_size = get_varint();
+          check_fp_format(exp_size, sig_size);
+          d_types.push_back(d_nm.mk_fp_type(exp_size, sig_size));
+        }
+        break;
+
+        case TypeTag::RM: d_types.push_back(d_nm.mk_rm_type()); break;
+
+        case TypeTag::ARRAY: {
+          Type index = get_type();
+          Type elem  = get_type();
+          d_types.push_back(d_nm.mk_array_type(index, elem));
+        }
+        break;
+
+        case TypeTag::FUN: {
+          uint64_t arity = get_count();
+          if (arity < 2)
+          {
+            throw Error("invalid snapshot: invalid function type");
+          }
+          std::vector<Type> types;
+          for (uint64_t j = 0; j < arity; ++j)
+          {
+            types.push_back(get_type());
+          }
+          d_types.push_back(d_nm.mk_fun_type(types));
+        }
+        break;
+
+        case TypeTag::UNINTERPRETED:
+          d_types.push_back(d_nm.mk_uninterpreted_type(get_symbol()));
+          break;
+
+        default: throw Error("invalid snapshot: invalid type tag");
+      }
+    }
+  }
+
+  void read_nodes()
+  {
+    uint64_t num_nodes = get_count();
+    d_nodes.reserve(num_nodes);
+    std::vector<Node> children;
+    std::vector<uint64_t> indices;
+    for (uint64_t i = 0; i < num_nodes; ++i)
+    {
+      uint64_t k = get_varint();
+      if (k == 0 || k >= static_cast<uint64_t>(Kind::NUM_KINDS))
+      {
+        throw Error("invalid snapshot: invalid node kind");
+      }
+      Kind kind = static_cast<Kind>(k);
+      switch (kind)
+      {
+        case Kind::CONSTANT: {
+          const Type& type = get_type();
+          d_nodes.push_back(d_nm.mk_const(type, get_symbol()));
+        }
+        break;
+
+        case Kind::VARIABLE: {
+          const Type& type = get_type();
+          d_nodes.push_back(d_nm.mk_var(type, get_symbol()));
+        }
+        break;
+
+        case Kind::VALUE: d_nodes.push_back(read_value()); break;
+
+        case Kind::CONST_ARRAY: {
+          const Type& type  = get_type();
+          const Node& child = get_child(i);
+          if (!type.is_array() || type.array_element() != child.type())
+          {
+            throw Error("invalid snapshot: invalid constant array");
+          }
+          d_nodes.push_back(d_nm.mk_const_array(type, child));
+        }
+        break;
+
+        default: {
+          children.clear();
+          indices.clear();
+          uint64_t num_children = get_count();
+          for (uint64_t j = 0; j < num_children; ++j)
+          {
+            children.push_back(get_child(i));
+          }
+          uint64_t num_indices = get_count();
+          for (uint64_t j = 0; j < num_indices; ++j)
+          {
+            indices.push_back(get_varint());
+          }
+          auto [ok, msg] = d_nm.check_type(kind, children, indices);
+          if (!ok)
+          {
+            throw Error("invalid snapshot: " + msg);
+          }
+          check_bv_size(kind, children, indices);
+          if (kind == Kind::FP_TO_FP_FROM_BV || kind == Kind::FP_TO_FP_FROM_FP
+              || kind == Kind::FP_TO_FP_FROM_SBV
+              || kind == Kind::FP_TO_FP_FROM_UBV)
+          {
+            check_fp_format(indices[0], indices[1]);
+          }
+          d_nodes.push_back(d_nm.mk_node(kind, children, indices));
+        }
+      }
+    }
+  }
+
+  Node read_value()
+  {
+    const Type& type = get_type();
+    if (type.is_bool())
+    {
+      uint64_t value = get_varint();
+      if (value > 1)
+      {
+        throw Error("invalid snapshot: invalid Boolean value");
+      }
+      return d_nm.mk_value(value == 1);
+    }
+    if (type.is_bv())
+    {
+      return d_nm.mk_value(get_bv(type.bv_size()));
+    }
+    if (type.is_fp())
+    {
+      return d_nm.mk_value(
+          FloatingPoint(type, get_bv(type.fp_ieee_bv_size())));
+    }
+    if (type.is_rm())
+    {
+      uint64_t value = get_varint();
+      if (value >= static_cast<uint64_t>(RoundingMode::NUM_RM))
+      {
+        throw Error("invalid snapshot: invalid rounding mode value");
+      }
+      return d_nm.mk_value(static_cast<RoundingMode>(value));
+    }
+    if (type.is_uninterpreted())
+    {
+      return d_nm.mk_value(type, get_string(get_varint()));
+    }
+    throw Error("invalid snapshot: invalid value type");
+  }
+
+  /** The associated node manager. */
+  NodeManager& d_nm;
+  /** The current position in the snapshot data. */
+  const uint8_t* d_cur;
+  /** The end of the snapshot data. */
+  const uint8_t* d_end;
+  /** The types of the type table. */
+  std::vector<Type> d_types;
+  /** The nodes of the node table. */
+  std::vector<Node> d_nodes;
+};
+
+}  // namespace
+
+void
+save_snapshot(std::ostream& out, const std::vector<Node>& roots)
+{
+  SnapshotWriter().write(out, roots);
+}
+
+void
+save_snapshot(const std::string& filename, const std::vector<Node>& roots)
+{
+  std::ofstream out(filename, std::ios::binary);
+  if (!out)
+  {
+    throw Error("failed to open '" + filename + "' for writing");
+  }
+  save_snapshot(out, roots);
+  if (!out.flush())
+  {
+    throw Error("failed to write '" + filename + "'");
+  }
+}
+
+std::vector<Node>
+load_snapshot(NodeManager& nm, const char* data, size_t size)
+{
+  return SnapshotReader(nm, data, size).read();
+}
+
+#if defined(__WIN32)
+
+std::vector<Node>
+load_snapshot(NodeManager& nm, const std::string& filename)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+  {
+    throw Error("failed to open '" + filename + "'");
+  }
+  std::string data((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  return load_snapshot(nm, data.data(), data.size());
+}
+
+#else
+
+std::vector<Node>
+load_snapshot(NodeManager& nm, const std::string& filename)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw Error("failed to open '" + filename + "'");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0)
+  {
+    close(fd);
+    throw Error("failed to open '" + filename + "'");
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  if (size == 0)
+  {
+    close(fd);
+    return load_snapshot(nm, nullptr, 0);
+  }
+  void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    throw Error("failed to map '" + filename + "'");
+  }
+  // The snapshot is read sequentially.
+  madvise(data, size, MADV_SEQUENTIAL);
+
+  std::vector<Node> res;
+  try
+  {
+    res = load_snapshot(nm, static_cast<const char*>(data), size);
+  }
+  catch (...)
+  {
+    munmap(data, size);
+    throw;
+  }
+  munmap(data, size);
+  return res;
+}
+
+#endif
+
+bool
+is_snapshot(const char* data, size_t size)
+{
+  return size >= sizeof(s_magic)
+         && std::memcmp(data, s_magic, sizeof(s_magic)) == 0;
+}
+
+}  // namespace bzla::node
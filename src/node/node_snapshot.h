@@ -0,0 +1,105 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_SNAPSHOT_H_INCLUDED
+#define BZLA_NODE_NODE_SNAPSHOT_H_INCLUDED
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "node/node.h"
+
+namespace bzla {
+
+class NodeManager;
+
+namespace node {
+
+/**
+ * Binary snapshots of node DAGs.
+ *
+ * A snapshot stores the DAGs rooted at a given set of nodes in a compact
+ * binary format that can be loaded without parsing:
+ *
+ *   header  magic "BZLASNAP", format version, number of node kinds
+ *   types   all types of constants, variables, values and constant arrays,
+ *           children before parents
+ *   nodes   all nodes in topological order (children before parents)
+ *   roots   references to the root nodes
+ *
+ * All integers are encoded as LEB128 varints. Nodes and types are referenced
+ * by their position in the corresponding table, references to children are
+ * encoded relative to the position of the parent. Constants and variables
+ * store their type and symbol, values store their type and payload
+ * (bit-vectors and floating-points as 64-bit words of their (IEEE-754)
+ * bit-vector representation, rounding modes as their enum value and
+ * uninterpreted values as their identifier string). All other nodes store
+ * their kind, children and indices.
+ *
+ * @note Node kinds are stored by their numeric value, snapshots are thus only
+ *       compatible between versions with the same set of node kinds, which is
+ *       checked on load.
+ */
+
+/**
+ * Write binary snapshot of the DAGs rooted at `roots`.
+ * @param out   The output stream.
+ * @param roots The root nodes.
+ */
+void save_snapshot(std::ostream& out, const std::vector<Node>& roots);
+
+/**
+ * Write binary snapshot of the DAGs rooted at `roots` to file.
+ * @param filename The name of the output file.
+ * @param roots    The root nodes.
+ */
+void save_snapshot(const std::string& filename, const std::vector<Node>& roots);
+
+/**
+ * Rebuild the nodes stored in given snapshot data.
+ *
+ * Throws bzla::Error if the data is not a valid snapshot.
+ *
+ * @param nm   The node manager to create the nodes with.
+ * @param data The snapshot data.
+ * @param size The size of the snapshot data in bytes.
+ * @return The root nodes of the snapshot, in the order they were saved.
+ */
+std::vector<Node> load_snapshot(NodeManager& nm,
+                                const char* data,
+                                size_t size);
+
+/**
+ * Rebuild the nodes stored in given snapshot file.
+ *
+ * The file is memory-mapped (if supported by the platform) and not read into
+ * a separate buffer. Throws bzla::Error if the file cannot be read or is not
+ * a valid snapshot.
+ *
+ * @param nm       The node manager to create the nodes with.
+ * @param filename The name of the snapshot file.
+ * @return The root nodes of the snapshot, in the order they were saved.
+ */
+std::vector<Node> load_snapshot(NodeManager& nm, const std::string& filename);
+
+/**
+ * Determine if given data starts with the snapshot magic.
+ * @param data The data.
+ * @param size The size of the data in bytes.
+ * @return True if `data` is (the beginning of) a snapshot.
+ */
+bool is_snapshot(const char* data, size_t size);
+
+}  // namespace node
+}  // namespace bzla
+
+#endif
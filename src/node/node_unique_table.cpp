@@ -1,12 +1,18 @@
 #include "node/node_unique_table.h"
 
+#include <algorithm>
+
 #include "solver/fp/floating_point.h"
 
 namespace bzla::node {
 
 /* --- NodeUniqueTable public ----------------------------------------------- */
 
-NodeUniqueTable::NodeUniqueTable() { d_buckets.resize(16, nullptr); }
+NodeUniqueTable::NodeUniqueTable(NodeDataAllocator& allocator)
+    : d_allocator(allocator)
+{
+  d_table.resize(16);
+}
 
 NodeUniqueTable::~NodeUniqueTable()
 {
@@ -16,12 +22,15 @@ NodeUniqueTable::~NodeUniqueTable()
   //       data leaks. However, nodes that are stored in static memory do not
   //       get garbage collected. Hence, we have to make sure to invalidate all
   //       node data before destructing the unique table.
-  for (size_t i = 0, size = d_buckets.size(); i < size; ++i)
+  for (auto* table : {&d_table, &d_old_table})
   {
-    NodeData* cur = d_buckets[i];
-    while (cur != nullptr)
+    for (const Entry& e : *table)
     {
-      NodeData* next = cur->d_next;
+      NodeData* cur = e.d_data;
+      if (cur == nullptr || cur == tombstone())
+      {
+        continue;
+      }
       if (cur->has_children())
       {
         auto& payload = cur->payload_children();
@@ -30,8 +39,7 @@ NodeUniqueTable::~NodeUniqueTable()
           payload.d_children[j].d_data = nullptr;
         }
       }
-      NodeData::dealloc(cur);
-      cur = next;
+      NodeData::dealloc(d_allocator, cur);
     }
   }
 }
@@ -39,97 +47,156 @@ NodeUniqueTable::~NodeUniqueTable()
 std::pair<bool, NodeData*>
 NodeUniqueTable::find_or_insert(Kind kind,
                                 const Type& type,
-                                const std::vector<Node>& children,
-                                const std::vector<uint64_t>& indices)
+                                util::Span<Node> children,
+                                util::Span<uint64_t> indices)
 {
   assert(kind != Kind::VALUE);
 
-  size_t hd     = hash(kind, children, indices);
-  size_t h      = bucket_hash(hd);
-  NodeData* cur = d_buckets[h];
+  size_t h      = hash(kind, children, indices);
+  NodeData* cur = find(h, [&](const NodeData* d) {
+    return equals(*d, kind, type, children, indices);
+  });
 
-  // Check collision chain.
-  while (cur)
+  // Found existing node
+  if (cur)
   {
-    // Found existing node
-    if (equals(*cur, kind, type, children, indices))
-    {
-      return std::make_pair(false, cur);
-    }
-    cur = cur->d_next;
+    return std::make_pair(false, cur);
   }
 
   // Create new node and insert
-  NodeData* d = NodeData::alloc(kind, children, indices);
-  if (needs_resize())
-  {
-    resize();
-    h = bucket_hash(hd);
-  }
-  assert(d->d_next == nullptr);
-  d->d_next    = d_buckets[h];
-  d_buckets[h] = d;
-
-  ++d_num_elements;
+  NodeData* d = NodeData::alloc(d_allocator, kind, children, indices);
+  insert(h, d);
   return std::make_pair(true, d);
 }
 
 void
 NodeUniqueTable::erase(const NodeData* d)
 {
-  size_t h       = bucket_hash(hash(d));
-  NodeData* cur  = d_buckets[h];
-  NodeData* prev = nullptr;
-  assert(cur != nullptr);
+  size_t h    = hash(d);
+  size_t mask = d_table.size() - 1;
 
-  // Find data in collision chain.
-  while (cur)
+  // Note: No need to use equals() here, we can safely compare the pointers.
+  for (size_t i = home(h, mask), dist = 0;; i = (i + 1) & mask, ++dist)
   {
-    // Note: No need to use equals() here, we can safely compare the pointers.
-    if (cur == d)
+    const Entry& e = d_table[i];
+    if (e.d_data == nullptr || probe_distance(e.d_hash, i, mask) < dist)
     {
       break;
     }
-    prev = cur;
-    cur  = cur->d_next;
+    if (e.d_data == d)
+    {
+      // Backward shift deletion: move subsequent entries of the probe
+      // sequence one slot closer to their home slot.
+      size_t j = (i + 1) & mask;
+      while (d_table[j].d_data != nullptr
+             && probe_distance(d_table[j].d_hash, j, mask) > 0)
+      {
+        d_table[i] = d_table[j];
+        i          = j;
+        j          = (j + 1) & mask;
+      }
+      d_table[i] = Entry();
+      --d_num_elements;
+      return;
+    }
   }
-  assert(cur);
 
-  // Update collision chain.
-  if (prev == nullptr)
+  // Not yet migrated, erase from old table.
+  assert(!d_old_table.empty());
+  mask = d_old_table.size() - 1;
+  for (size_t i = home(h, mask);; i = (i + 1) & mask)
   {
-    d_buckets[h] = cur->d_next;
+    Entry& e = d_old_table[i];
+    assert(e.d_data != nullptr);
+    if (e.d_data == d)
+    {
+      e.d_data = tombstone();
+      --d_num_elements;
+      return;
+    }
   }
-  else
+}
+
+/* --- NodeUniqueTable private ---------------------------------------------- */
+
+void
+NodeUniqueTable::insert(size_t hash, NodeData* d)
+{
+  if (needs_resize())
   {
-    prev->d_next = cur->d_next;
+    resize();
   }
-  --d_num_elements;
+  migrate(s_migrate_steps);
+  insert_entry({hash, d});
+  ++d_num_elements;
 }
 
-/* --- NodeUniqueTable private ---------------------------------------------- */
+void
+NodeUniqueTable::insert_entry(Entry entry)
+{
+  size_t mask = d_table.size() - 1;
+  size_t dist = 0;
+  for (size_t i = home(entry.d_hash, mask);; i = (i + 1) & mask, ++dist)
+  {
+    Entry& cur = d_table[i];
+    if (cur.d_data == nullptr)
+    {
+      cur = entry;
+      return;
+    }
+    // Robin Hood: take the slot from entries closer to their home slot.
+    size_t cur_dist = probe_distance(cur.d_hash, i, mask);
+    if (cur_dist < dist)
+    {
+      std::swap(cur, entry);
+      dist = cur_dist;
+    }
+  }
+}
 
 void
 NodeUniqueTable::resize()
 {
-  size_t new_size = d_buckets.capacity() * 2;
-  std::vector<NodeData*> buckets(new_size, nullptr);
+  // Finish pending migration before starting a new one.
+  if (!d_old_table.empty())
+  {
+    migrate(d_old_table.size());
+  }
+  assert(d_old_table.empty());
+
+  size_t new_size = d_table.size() * 2;
+  d_old_table     = std::move(d_table);
+  d_table         = std::vector<Entry>(new_size);
+  d_migrate_pos   = 0;
+}
+
+void
+NodeUniqueTable::migrate(size_t steps)
+{
+  if (d_old_table.empty())
+  {
+    return;
+  }
 
-  // Rehash elements.
-  size_t mask = new_size - 1;
-  for (auto cur : d_buckets)
+  size_t size = d_old_table.size();
+  for (size_t end = std::min(size, d_migrate_pos + steps); d_migrate_pos < end;
+       ++d_migrate_pos)
   {
-    while (cur)
+    Entry& e = d_old_table[d_migrate_pos];
+    if (e.d_data != nullptr && e.d_data != tombstone())
     {
-      size_t h     = bucket_hash(hash(cur), mask);
-      auto next    = cur->d_next;
-      cur->d_next  = buckets[h];
-      buckets[h]   = cur;
-      cur          = next;
+      // Note: No need to rehash, the hash value is cached in the entry.
+      insert_entry(e);
+      // Keep the slot occupied for lookups of not yet migrated entries.
+      e.d_data = tombstone();
     }
   }
 
-  d_buckets = std::move(buckets);
+  if (d_migrate_pos == size)
+  {
+    std::vector<Entry>().swap(d_old_table);
+    d_migrate_pos = 0;
+  }
 }
 
 size_t
@@ -188,8 +255,8 @@ NodeUniqueTable::hash(const NodeData* d) const
 
 size_t
 NodeUniqueTable::hash(Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices) const
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices)
 {
   assert(!children.empty());
 
@@ -208,8 +275,8 @@ bool
 NodeUniqueTable::equals(const NodeData& data,
                         Kind kind,
                         const Type& type,
-                        const std::vector<Node>& children,
-                        const std::vector<uint64_t>& indices) const
+                        util::Span<Node> children,
+                        util::Span<uint64_t> indices) const
 {
   assert(kind != Kind::VALUE);
 
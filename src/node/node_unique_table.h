@@ -11,16 +11,35 @@
 #ifndef BZLA_NODE_NODE_UNIQUE_TABLE_H_INCLUDED
 #define BZLA_NODE_NODE_UNIQUE_TABLE_H_INCLUDED
 
+#include <array>
+#include <cstdint>
 #include <vector>
 
 #include "node/node_data.h"
 
 namespace bzla::node {
 
+/**
+ * Unique table for hash consing of node data.
+ *
+ * Open-addressing hash table with Robin Hood linear probing. Each slot stores
+ * the full hash value together with the node data pointer, which allows to
+ * skip most of the node comparisons during lookup and avoids recomputing hash
+ * values on resize.
+ *
+ * Growing the table is incremental: the old slots are kept and migrated to
+ * the new table in small steps on every subsequent insertion, hence no single
+ * insertion pays for rehashing all nodes. While a migration is in progress,
+ * lookups consult both tables.
+ */
 class NodeUniqueTable
 {
  public:
-  NodeUniqueTable();
+  /**
+   * Constructor.
+   * @param allocator The allocator used for allocating new node data.
+   */
+  NodeUniqueTable(NodeDataAllocator& allocator);
   ~NodeUniqueTable();
 
   /**
@@ -30,8 +49,8 @@ class NodeUniqueTable
   std::pair<bool, NodeData*> find_or_insert(
       Kind kind,
       const Type& type,
-      const std::vector<Node>& children,
-      const std::vector<uint64_t>& indices);
+      util::Span<Node> children,
+      util::Span<uint64_t> indices);
 
   /**
    * Find value with specified criteria. If node does not exist yet, allocates
@@ -40,87 +59,152 @@ class NodeUniqueTable
   template <class T>
   std::pair<bool, NodeData*> find_or_insert(const Type& type, const T& value)
   {
-    size_t hd     = hash_value(value);
-    size_t h      = bucket_hash(hd);
-    NodeData* cur = d_buckets[h];
-
-    // Check collision chain.
-    while (cur)
+    size_t h      = hash_value(value);
+    NodeData* cur = find(h, [&type, &value](const NodeData* d) {
+      return d->d_kind == Kind::VALUE && d->get_type() == type
+             && d->payload_value<T>().d_value == value;
+    });
+    if (cur)
     {
-      if (cur->d_kind == Kind::VALUE && cur->get_type() == type)
-      {
-        const auto& payload = cur->payload_value<T>();
-        if (payload.d_value == value)
-        {
-          return std::make_pair(false, cur);
-        }
-      }
-      cur = cur->d_next;
+      return std::make_pair(false, cur);
     }
 
     // Create new node and insert
-    NodeData* d = NodeData::alloc(value);
-    if (needs_resize())
-    {
-      resize();
-      h = bucket_hash(hd);
-    }
-    assert(d->d_next == nullptr);
-    d->d_next    = d_buckets[h];
-    d_buckets[h] = d;
-
-    ++d_num_elements;
+    NodeData* d = NodeData::alloc(d_allocator, value);
+    insert(h, d);
     return std::make_pair(true, d);
   }
 
   /** Delete node data from unique table. */
   void erase(const NodeData* d);
 
+  /** @return The number of nodes stored in the unique table. */
+  size_t size() const { return d_num_elements; }
+
+  /** Compute hash value of node lookup data. */
+  static size_t hash(Kind kind,
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices);
+
+  /** Compute has value of value node lookup data. */
+  template <class T>
+  static size_t hash_value(const T& value)
+  {
+    return static_cast<size_t>(Kind::VALUE) + std::hash<T>{}(value);
+  }
+
  private:
   static constexpr std::array<size_t, 4> s_primes = {
       333444569u, 76891121u, 456790003u, 111130391u};
 
-  /** Check whether unique table needs to be resized. */
-  bool needs_resize() const { return d_num_elements >= d_buckets.capacity(); }
+  /** Number of old slots migrated per insertion while growing. */
+  static constexpr size_t s_migrate_steps = 16;
 
-  /** Resizes unique table and rehashes node data. */
-  void resize();
+  /** Unique table slot. */
+  struct Entry
+  {
+    /** The cached hash value of the node data. */
+    size_t d_hash = 0;
+    /** The node data, nullptr if slot is empty. */
+    NodeData* d_data = nullptr;
+  };
 
-  /** Hash node data. */
-  size_t hash(const NodeData* d) const;
+  /**
+   * @return Marker for slots of the old table that were already migrated or
+   *         erased. Lookups in the old table continue over these slots.
+   */
+  static NodeData* tombstone()
+  {
+    return reinterpret_cast<NodeData*>(static_cast<uintptr_t>(1));
+  }
 
-  /** Compute hash value of node lookup data. */
-  size_t hash(Kind kind,
-              const std::vector<Node>& children,
-              const std::vector<uint64_t>& indices) const;
+  /**
+   * @return The home slot of `hash`.
+   * @note The node hash values are sums of child ids, which cluster heavily
+   *       under linear probing. The bits are hence mixed before masking.
+   */
+  static size_t home(size_t hash, size_t mask)
+  {
+    hash ^= hash >> 32;
+    hash *= 0x9e3779b97f4a7c15u;
+    return (hash ^ (hash >> 29)) & mask;
+  }
 
-  /** Compare node data against node lookup data. */
-  bool equals(const NodeData& data,
-              Kind kind,
-              const Type& type,
-              const std::vector<Node>& children,
-              const std::vector<uint64_t>& indices) const;
+  /** @return Distance of slot `pos` from the home slot of `hash`. */
+  static size_t probe_distance(size_t hash, size_t pos, size_t mask)
+  {
+    return (pos - home(hash, mask)) & mask;
+  }
 
-  /** Compute position in d_buckets based on hash value. */
-  size_t bucket_hash(size_t hash, size_t mask = 0) const
+  /**
+   * Find node data with given hash value that satisfies `equal`.
+   * @return The node data or nullptr if no such node data exists.
+   */
+  template <class Equal>
+  NodeData* find(size_t hash, Equal&& equal) const
   {
-    if (mask == 0)
+    size_t mask = d_table.size() - 1;
+    for (size_t i = home(hash, mask), dist = 0;; i = (i + 1) & mask, ++dist)
+    {
+      const Entry& e = d_table[i];
+      // Robin Hood invariant: the lookup node would have been stored here.
+      if (e.d_data == nullptr || probe_distance(e.d_hash, i, mask) < dist)
+      {
+        break;
+      }
+      if (e.d_hash == hash && equal(e.d_data))
+      {
+        return e.d_data;
+      }
+    }
+    if (!d_old_table.empty())
     {
-      mask = d_buckets.capacity() - 1;
+      mask = d_old_table.size() - 1;
+      for (size_t i = home(hash, mask);; i = (i + 1) & mask)
+      {
+        const Entry& e = d_old_table[i];
+        if (e.d_data == nullptr)
+        {
+          break;
+        }
+        if (e.d_data != tombstone() && e.d_hash == hash && equal(e.d_data))
+        {
+          return e.d_data;
+        }
+      }
     }
-    return hash & mask;
+    return nullptr;
   }
 
-  /** Compute has value of value node lookup data. */
-  template <class T>
-  size_t hash_value(const T& value)
+  /** Insert new node data with given hash value. */
+  void insert(size_t hash, NodeData* d);
+
+  /** Insert entry into d_table without triggering a resize or migration. */
+  void insert_entry(Entry entry);
+
+  /** Check whether unique table needs to be resized. */
+  bool needs_resize() const
   {
-    return static_cast<size_t>(Kind::VALUE) + std::hash<T>{}(value);
+    return (d_num_elements + 1) * 4 > d_table.size() * 3;
   }
 
-  inline size_t hash_children(size_t hash,
-                              size_t size,
-                              const Node* children) const
+  /** Start growing the table, old slots are migrated incrementally. */
+  void resize();
+
+  /** Migrate at most `steps` slots from the old table to the new table. */
+  void migrate(size_t steps);
+
+  /** Hash node data. */
+  size_t hash(const NodeData* d) const;
+
+  /** Compare node data against node lookup data. */
+  bool equals(const NodeData& data,
+              Kind kind,
+              const Type& type,
+              util::Span<Node> children,
+              util::Span<uint64_t> indices) const;
+
+  static size_t hash_children(size_t hash, size_t size, const Node* children)
   {
     for (size_t i = 0; i < size; ++i)
     {
@@ -129,9 +213,7 @@ class NodeUniqueTable
     return hash;
   }
 
-  inline size_t hash_indices(size_t hash,
-                             size_t size,
-                             const uint64_t* indices) const
+  static size_t hash_indices(size_t hash, size_t size, const uint64_t* indices)
   {
     for (size_t i = 0; i < size; ++i)
     {
@@ -140,10 +222,16 @@ class NodeUniqueTable
     return hash;
   }
 
-  /** Number of nodes stored in unique table. */
+  /** The allocator for new node data. */
+  NodeDataAllocator& d_allocator;
+  /** Number of nodes stored in unique table (including old table). */
   size_t d_num_elements = 0;
-  /** Hash table buckets. */
-  std::vector<NodeData*> d_buckets;
+  /** Hash table slots. */
+  std::vector<Entry> d_table;
+  /** Slots of the previous table that are not fully migrated yet. */
+  std::vector<Entry> d_old_table;
+  /** Position of next slot in d_old_table to migrate. */
+  size_t d_migrate_pos = 0;
 };
 
 }  // namespace bzla::node
@@ -41,6 +41,96 @@ _is_bv_sext_aux(const Node& ite, const Node& ext, size_t idx)
   }
   return false;
 }
+
+template <class Map>
+Node
+_rebuild_node(NodeManager& nm, const Node& node, const Map& cache)
+{
+  std::vector<Node> children;
+
+  bool changed = false;
+  for (const Node& child : node)
+  {
+    auto iit = cache.find(child);
+    assert(iit != cache.end());
+    assert(!iit->second.is_null());
+    children.push_back(iit->second);
+    changed |= iit->second != child;
+  }
+
+  if (!changed || node.num_children() == 0)
+  {
+    return node;
+  }
+  else if (node.kind() == Kind::CONST_ARRAY)
+  {
+    assert(children.size() == 1);
+    return nm.mk_const_array(node.type(), children[0]);
+  }
+  else
+  {
+    if (node.num_indices() > 0)
+    {
+      return nm.mk_node(node.kind(), children, node.indices());
+    }
+    return nm.mk_node(node.kind(), children);
+  }
+}
+
+template <class Map>
+Node
+_substitute(NodeManager& nm,
+            const Node& node,
+            const std::unordered_map<Node, Node>& substitutions,
+            Map& cache)
+{
+  node::node_ref_vector visit{node};
+
+  do
+  {
+    const Node& cur     = visit.back();
+    auto [it, inserted] = cache.emplace(cur, Node());
+    if (inserted)
+    {
+      auto its = substitutions.find(cur);
+      if (its != substitutions.end() && its->second != cur)
+      {
+        visit.push_back(its->second);
+      }
+      else
+      {
+        visit.insert(visit.end(), cur.begin(), cur.end());
+      }
+      continue;
+    }
+    else if (it->second.is_null())
+    {
+      auto its = substitutions.find(cur);
+      if (its != substitutions.end() && its->second != cur)
+      {
+        auto iit = cache.find(its->second);
+        assert(iit != cache.end());
+        it->second = iit->second;
+      }
+      else
+      {
+        std::vector<Node> children;
+        for (const Node& child : cur)
+        {
+          auto itc = cache.find(child);
+          assert(itc != cache.end());
+          assert(!itc->second.is_null());
+          children.push_back(itc->second);
+        }
+        it->second = node::utils::rebuild_node(nm, cur, children);
+      }
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  auto it = cache.find(node);
+  assert(it != cache.end());
+  return it->second;
+}
 }  // namespace
 
 bool
@@ -232,35 +322,13 @@ rebuild_node(NodeManager& nm,
              const Node& node,
              const std::unordered_map<Node, Node>& cache)
 {
-  std::vector<Node> children;
-
-  bool changed = false;
-  for (const Node& child : node)
-  {
-    auto iit = cache.find(child);
-    assert(iit != cache.end());
-    assert(!iit->second.is_null());
-    children.push_back(iit->second);
-    changed |= iit->second != child;
-  }
+  return _rebuild_node(nm, node, cache);
+}
 
-  if (!changed || node.num_children() == 0)
-  {
-    return node;
-  }
-  else if (node.kind() == Kind::CONST_ARRAY)
-  {
-    assert(children.size() == 1);
-    return nm.mk_const_array(node.type(), children[0]);
-  }
-  else
-  {
-    if (node.num_indices() > 0)
-    {
-      return nm.mk_node(node.kind(), children, node.indices());
-    }
-    return nm.mk_node(node.kind(), children);
-  }
+Node
+rebuild_node(NodeManager& nm, const Node& node, const NodeMap<Node>& cache)
+{
+  return _rebuild_node(nm, node, cache);
 }
 
 Node
@@ -269,52 +337,16 @@ substitute(NodeManager& nm,
            const std::unordered_map<Node, Node>& substitutions,
            std::unordered_map<Node, Node>& cache)
 {
-  node::node_ref_vector visit{node};
+  return _substitute(nm, node, substitutions, cache);
+}
 
-  do
-  {
-    const Node& cur     = visit.back();
-    auto [it, inserted] = cache.emplace(cur, Node());
-    if (inserted)
-    {
-      auto its = substitutions.find(cur);
-      if (its != substitutions.end() && its->second != cur)
-      {
-        visit.push_back(its->second);
-      }
-      else
-      {
-        visit.insert(visit.end(), cur.begin(), cur.end());
-      }
-      continue;
-    }
-    else if (it->second.is_null())
-    {
-      auto its = substitutions.find(cur);
-      if (its != substitutions.end() && its->second != cur)
-      {
-        auto iit = cache.find(its->second);
-        assert(iit != cache.end());
-        it->second = iit->second;
-      }
-      else
-      {
-        std::vector<Node> children;
-        for (const Node& child : cur)
-        {
-          auto itc = cache.find(child);
-          assert(itc != cache.end());
-          assert(!itc->second.is_null());
-          children.push_back(itc->second);
-        }
-        it->second = node::utils::rebuild_node(nm, cur, children);
-      }
-    }
-    visit.pop_back();
-  } while (!visit.empty());
-  auto it = cache.find(node);
-  assert(it != cache.end());
-  return it->second;
+Node
+substitute(NodeManager& nm,
+           const Node& node,
+           const std::unordered_map<Node, Node>& substitutions,
+           NodeMap<Node>& cache)
+{
+  return _substitute(nm, node, substitutions, cache);
 }
 
 }  // namespace bzla::node::utils
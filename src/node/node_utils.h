@@ -14,6 +14,7 @@
 #include <unordered_map>
 
 #include "node/node.h"
+#include "node/node_map.h"
 
 namespace bzla::node::utils {
 
@@ -85,6 +86,17 @@ Node rebuild_node(NodeManager& nm,
                   const Node& node,
                   const std::unordered_map<Node, Node>& cache);
 
+/**
+ * Rebuild node with same kind and indices but new children taken from cache.
+ *
+ * @param node The node to rebuild.
+ * @param cache The node cache for children.
+ * @return Rebuilt node.
+ */
+Node rebuild_node(NodeManager& nm,
+                  const Node& node,
+                  const NodeMap<Node>& cache);
+
 /**
  * Apply substitutions to node.
  *
@@ -97,6 +109,22 @@ Node substitute(NodeManager& nm,
                 const Node& node,
                 const std::unordered_map<Node, Node>& substitutions,
                 std::unordered_map<Node, Node>& cache);
+
+/**
+ * Apply substitutions to node.
+ *
+ * @note NodeMap allocates pages up to the largest node id, only use this
+ *       overload with caches over large parts of the node DAG.
+ *
+ * @param node The node process.
+ * @param substitutions The substitution map to apply.
+ * @param cache The substitution cache.
+ * @return The node with substituions applied.
+ */
+Node substitute(NodeManager& nm,
+                const Node& node,
+                const std::unordered_map<Node, Node>& substitutions,
+                NodeMap<Node>& cache);
 }
 
 #endif
@@ -163,11 +163,21 @@ Options::Options()
           Option::NTHREADS,
           1,
           1,
-          UINT64_MAX,
-          "set number of threads to utilize in parallel (currently, this only "
-          "configures parallel threads in the CryptoMiniSat back end)",
+          256,
+          "set number of threads to utilize in parallel (configures parallel "
+          "threads in the CryptoMiniSat back end, the number of CaDiCaL "
+          "instances in the parallel SAT portfolio and the number of workers "
+          "for batched satisfiability checks)",
           "nthreads",
           "j"),
+      portfolio(this,
+                Option::PORTFOLIO,
+                0,
+                0,
+                256,
+                "number of differently configured solver instances to run in "
+                "parallel on the preprocessed formula (0 or 1 to disable)",
+                "portfolio"),
 
       // Bitwuzla-specific
       bv_solver(this,
@@ -187,6 +197,14 @@ Options::Options()
                  "backend SAT solver",
                  "sat-solver",
                  "S"),
+      sat_sharing(this,
+                  Option::SAT_SHARING,
+                  false,
+                  "share learned clauses between the instances of the "
+                  "parallel SAT portfolio",
+                  "sat-sharing",
+                  nullptr,
+                  true),
       write_aiger(this,
                   Option::WRITE_AIGER,
                   "",
@@ -197,6 +215,41 @@ Options::Options()
                 "",
                 "write bv abstraction as CNF to filename",
                 "write-cnf"),
+      cnf_polarity(this,
+                   Option::CNF_POLARITY,
+                   false,
+                   "polarity-aware (Plaisted-Greenbaum) CNF encoding of "
+                   "bit-blasted AIGs",
+                   "cnf-polarity",
+                   nullptr,
+                   true),
+      fraig(this,
+            Option::FRAIG,
+            false,
+            "SAT sweeping of bit-blasted AIGs before CNF encoding",
+            "fraig",
+            nullptr,
+            true),
+      bv_mul_encoding(this,
+                      Option::BV_MUL_ENCODING,
+                      BvMulEncoding::ARRAY,
+                      {{BvMulEncoding::ARRAY, "array"},
+                       {BvMulEncoding::WALLACE, "wallace"},
+                       {BvMulEncoding::DADDA, "dadda"}},
+                      "circuit for bit-blasting bit-vector multiplication",
+                      "bv-mul-encoding",
+                      nullptr,
+                      true),
+      bv_cube_depth(this,
+                    Option::BV_CUBE_DEPTH,
+                    0,
+                    0,
+                    16,
+                    "number of input bits to split on for cube-and-conquer "
+                    "(0 to disable)",
+                    "bv-cube-depth",
+                    nullptr,
+                    true),
       rewrite_level(this,
                     Option::REWRITE_LEVEL,
                     Rewriter::LEVEL_MAX,
@@ -273,6 +326,32 @@ Options::Options()
                 "concats that represent sign_extend nodes for "
                 "propagation-based local search engine",
                 "prop-sext"),
+      prop_async(this,
+                 Option::PROP_ASYNC,
+                 false,
+                 "run propagation-based local search concurrently with "
+                 "bit-blasting in preprop mode",
+                 "prop-async",
+                 nullptr,
+                 true),
+      prop_phase_hints(this,
+                       Option::PROP_PHASE_HINTS,
+                       false,
+                       "use local search assignments as SAT solver phases in "
+                       "asynchronous preprop mode",
+                       "prop-phase-hints",
+                       nullptr,
+                       true),
+      prop_move_candidates(this,
+                           Option::PROP_MOVE_CANDIDATES,
+                           1,
+                           1,
+                           64,
+                           "number of candidate moves scored per move of "
+                           "propagation-based local search engine",
+                           "prop-move-candidates",
+                           nullptr,
+                           true),
       abstraction(this,
                   Option::ABSTRACTION,
                   false,
@@ -748,13 +827,19 @@ Options::data(Option opt)
     case Option::PRODUCE_UNSAT_ASSUMPTIONS: return &produce_unsat_assumptions;
     case Option::PRODUCE_UNSAT_CORES: return &produce_unsat_cores;
     case Option::SAT_SOLVER: return &sat_solver;
+    case Option::SAT_SHARING: return &sat_sharing;
     case Option::WRITE_AIGER: return &write_aiger;
     case Option::WRITE_CNF: return &write_cnf;
+    case Option::CNF_POLARITY: return &cnf_polarity;
+    case Option::FRAIG: return &fraig;
+    case Option::BV_MUL_ENCODING: return &bv_mul_encoding;
+    case Option::BV_CUBE_DEPTH: return &bv_cube_depth;
     case Option::SEED: return &seed;
     case Option::VERBOSITY: return &verbosity;
     case Option::TIME_LIMIT_PER: return &time_limit_per;
     case Option::MEMORY_LIMIT: return &memory_limit;
     case Option::NTHREADS: return &nthreads;
+    case Option::PORTFOLIO: return &portfolio;
 
     case Option::BV_SOLVER: return &bv_solver;
     case Option::REWRITE_LEVEL: return &rewrite_level;
@@ -769,6 +854,9 @@ Options::data(Option opt)
     case Option::PROP_INEQ_BOUNDS: return &prop_ineq_bounds;
     case Option::PROP_OPT_LT_CONCAT_SEXT: return &prop_opt_lt_concat_sext;
     case Option::PROP_SEXT: return &prop_sext;
+    case Option::PROP_ASYNC: return &prop_async;
+    case Option::PROP_PHASE_HINTS: return &prop_phase_hints;
+    case Option::PROP_MOVE_CANDIDATES: return &prop_move_candidates;
     case Option::ABSTRACTION: return &abstraction;
     case Option::ABSTRACTION_BV_SIZE: return &abstraction_bv_size;
     case Option::ABSTRACTION_EAGER_REFINE: return &abstraction_eager_refine;
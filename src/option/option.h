@@ -31,13 +31,19 @@ enum class Option
   TIME_LIMIT_PER,             // numeric
   MEMORY_LIMIT,               // numeric
   NTHREADS,                   // numeric
+  PORTFOLIO,                  // numeric
 
   BV_SOLVER,      // enum
   REWRITE_LEVEL,  // numeric
   SAT_SOLVER,     // enum
+  SAT_SHARING,    // bool
 
-  WRITE_AIGER,  // str
-  WRITE_CNF,    // str
+  WRITE_AIGER,      // str
+  WRITE_CNF,        // str
+  CNF_POLARITY,     // bool
+  FRAIG,            // bool
+  BV_MUL_ENCODING,  // enum
+  BV_CUBE_DEPTH,    // numeric
 
   PROP_NPROPS,                  // numeric
   PROP_NUPDATES,                // numeric
@@ -48,6 +54,9 @@ enum class Option
   PROP_INEQ_BOUNDS,             // bool
   PROP_OPT_LT_CONCAT_SEXT,      // bool
   PROP_SEXT,                    // bool
+  PROP_ASYNC,                   // bool
+  PROP_PHASE_HINTS,             // bool
+  PROP_MOVE_CANDIDATES,         // numeric
 
   // Abstraction module
   ABSTRACTION,                 // bool
@@ -110,6 +119,13 @@ enum class BvSolver
   PREPROP,
 };
 
+enum class BvMulEncoding
+{
+  ARRAY,
+  WALLACE,
+  DADDA,
+};
+
 enum class SatSolver
 {
   CADICAL,
@@ -539,12 +555,18 @@ class Options
   OptionNumeric time_limit_per;
   OptionNumeric memory_limit;
   OptionNumeric nthreads;
+  OptionNumeric portfolio;
 
   // Bitwuzla-specific options
   OptionModeT<BvSolver> bv_solver;
   OptionModeT<SatSolver> sat_solver;
+  OptionBool sat_sharing;
   OptionStr write_aiger;
   OptionStr write_cnf;
+  OptionBool cnf_polarity;
+  OptionBool fraig;
+  OptionModeT<BvMulEncoding> bv_mul_encoding;
+  OptionNumeric bv_cube_depth;
   OptionNumeric rewrite_level;
 
   // BV: propagation-based local search engine
@@ -557,6 +579,9 @@ class Options
   OptionBool prop_ineq_bounds;
   OptionBool prop_opt_lt_concat_sext;
   OptionBool prop_sext;
+  OptionBool prop_async;
+  OptionBool prop_phase_hints;
+  OptionNumeric prop_move_candidates;
 
   OptionBool abstraction;
   OptionNumeric abstraction_bv_size;
@@ -0,0 +1,190 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "parser/bin/parser.h"
+
+#include <sstream>
+#include <unordered_set>
+
+namespace bzla {
+namespace parser::bin {
+
+/* Parser public ------------------------------------------------------------ */
+
+Parser::Parser(bitwuzla::TermManager& tm,
+               bitwuzla::Options& options,
+               std::ostream* out)
+    : bzla::parser::Parser(tm, options, out)
+{
+  init_bitwuzla();
+}
+
+Parser::~Parser() {}
+
+bool
+Parser::parse(const std::string& input, bool parse_only, bool parse_file)
+{
+  if (!parse_file)
+  {
+    std::stringstream instring;
+    instring << input;
+    return parse("<string>", instring, parse_only);
+  }
+  if (input == "<stdin>")
+  {
+    return parse(input, std::cin, parse_only);
+  }
+
+  util::Timer timer(d_statistics.time_parse);
+  Log(2) << "parse " << input;
+  d_infile_name = input;
+
+  if (!d_error.empty())
+  {
+    d_error = "parser in unsafe state after parse error";
+    return false;
+  }
+
+  // Load from file directly, which memory-maps the snapshot.
+  std::vector<bitwuzla::Term> terms;
+  try
+  {
+    terms = d_tm.load_snapshot(input);
+  }
+  catch (bitwuzla::Exception& e)
+  {
+    d_error = d_infile_name + ": " + e.msg();
+    return false;
+  }
+  return process(terms, parse_only);
+}
+
+bool
+Parser::parse(const std::string& infile_name,
+              std::istream& input,
+              bool parse_only)
+{
+  util::Timer timer(d_statistics.time_parse);
+  Log(2) << "parse " << infile_name;
+  d_infile_name = infile_name;
+
+  if (!d_error.empty())
+  {
+    d_error = "parser in unsafe state after parse error";
+    return false;
+  }
+
+  std::vector<bitwuzla::Term> terms;
+  try
+  {
+    terms = d_tm.load_snapshot(input);
+  }
+  catch (bitwuzla::Exception& e)
+  {
+    d_error = d_infile_name + ": " + e.msg();
+    return false;
+  }
+  return process(terms, parse_only);
+}
+
+bool
+Parser::parse_term(const std::string& input, bitwuzla::Term& res)
+{
+  (void) input;
+  (void) res;
+  d_error = "parsing terms from strings not supported for binary snapshots";
+  return false;
+}
+
+bool
+Parser::parse_sort(const std::string& input, bitwuzla::Sort& res)
+{
+  (void) input;
+  (void) res;
+  d_error = "parsing sorts from strings not supported for binary snapshots";
+  return false;
+}
+
+std::vector<bitwuzla::Sort>
+Parser::get_declared_sorts() const
+{
+  return {};
+}
+
+std::vector<bitwuzla::Term>
+Parser::get_declared_funs() const
+{
+  std::vector<bitwuzla::Term> res;
+  std::unordered_set<bitwuzla::Term> cache;
+  std::vector<bitwuzla::Term> visit(d_terms.begin(), d_terms.end());
+  while (!visit.empty())
+  {
+    bitwuzla::Term cur = visit.back();
+    visit.pop_back();
+    if (cache.insert(cur).second)
+    {
+      if (cur.is_const() && cur.symbol())
+      {
+        res.push_back(cur);
+      }
+      for (const auto& child : cur.children())
+      {
+        visit.push_back(child);
+      }
+    }
+  }
+  return res;
+}
+
+/* Parser private ----------------------------------------------------------- */
+
+bool
+Parser::process(const std::vector<bitwuzla::Term>& terms, bool parse_only)
+{
+  d_statistics.num_terms += terms.size();
+  Msg(1) << "loaded " << terms.size() << " terms in "
+         << ((double) d_statistics.time_parse.elapsed() / 1000) << " seconds";
+
+  for (size_t i = 0, n = terms.size(); i < n; ++i)
+  {
+    if (!terms[i].sort().is_bool())
+    {
+      d_error = d_infile_name + ": expected Boolean term at index "
+                + std::to_string(i) + " of snapshot";
+      return false;
+    }
+  }
+  for (const auto& term : terms)
+  {
+    d_bitwuzla->assert_formula(term);
+  }
+  d_terms.insert(d_terms.end(), terms.begin(), terms.end());
+
+  if (!parse_only)
+  {
+    d_result = d_bitwuzla->check_sat();
+    (*d_out) << d_result << std::endl;
+  }
+  return true;
+}
+
+/* Parser::Statistics ------------------------------------------------------- */
+
+Parser::Statistics::Statistics()
+    : num_terms(d_stats.new_stat<uint64_t>("parser::bin::num_terms")),
+      time_parse(
+          d_stats.new_stat<util::TimerStatistic>("parser::bin::time_parse"))
+{
+}
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace parser::bin
+}  // namespace bzla
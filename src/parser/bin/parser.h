@@ -0,0 +1,85 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PARSER_BIN_PARSER_H_INCLUDED
+#define BZLA_PARSER_BIN_PARSER_H_INCLUDED
+
+#include "parser/parser.h"
+
+namespace bzla {
+namespace parser::bin {
+
+/**
+ * Parser for binary term snapshots (see TermManager::save_snapshot()).
+ *
+ * All terms stored in the snapshot are interpreted as assertions, which are
+ * checked for satisfiability with a single check-sat call.
+ */
+class Parser : public bzla::parser::Parser
+{
+ public:
+  /**
+   * Constructor.
+   * @param options  The associated Bitwuzla options. Parser creates Bitwuzla
+   *                 instance from these options.
+   * @param out      The output stream.
+   */
+  Parser(bitwuzla::TermManager& tm,
+         bitwuzla::Options& options,
+         std::ostream* out = &std::cout);
+  /** Destructor. */
+  ~Parser();
+
+  bool parse(const std::string& input,
+             bool parse_only,
+             bool parse_file) override;
+  bool parse(const std::string& infile_name,
+             std::istream& input,
+             bool parse_only) override;
+
+  bool parse_term(const std::string& input, bitwuzla::Term& res) override;
+  bool parse_sort(const std::string& input, bitwuzla::Sort& res) override;
+  std::vector<bitwuzla::Sort> get_declared_sorts() const override;
+  std::vector<bitwuzla::Term> get_declared_funs() const override;
+
+ private:
+  /**
+   * Assert the loaded terms and check satisfiability.
+   * @param terms      The loaded terms.
+   * @param parse_only True to only assert without calling check-sat.
+   * @return False on error.
+   */
+  bool process(const std::vector<bitwuzla::Term>& terms, bool parse_only);
+
+  /** The loaded terms. */
+  std::vector<bitwuzla::Term> d_terms;
+
+  /** Parse statistics. */
+  struct Statistics
+  {
+    Statistics();
+
+    util::Statistics d_stats;
+
+    /** The overall number of loaded terms. */
+    uint64_t& num_terms;
+
+    /**
+     * The time required for parsing.
+     * @note This is not parse-only, it includes time for the check-sat call.
+     */
+    util::TimerStatistic& time_parse;
+
+  } d_statistics;
+};
+}  // namespace parser::bin
+}  // namespace bzla
+
+#endif
@@ -48,7 +48,7 @@ class PassContradictingAnds : public PreprocessingPass
    * Cache of processed nodes that maybe shared across substitutions.
    * Clear after a call to process to avoid sharing.
    */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeMap<Node> d_cache;
 
   struct Statistics
   {
@@ -32,9 +32,9 @@ class PassElimUdiv : public PreprocessingPass
   const Node& quotient(const Node& node);
   const Node& remainder(const Node& node);
 
-  std::unordered_map<Node, Node> d_cache;
-  std::unordered_map<Node, Node> d_quot_cache;
-  std::unordered_map<Node, Node> d_rem_cache;
+  node::NodeMap<Node> d_cache;
+  node::NodeMap<Node> d_quot_cache;
+  node::NodeMap<Node> d_rem_cache;
 
   struct Statistics
   {
@@ -56,7 +56,10 @@ PassElimUninterpreted::apply(AssertionVector& assertions)
   unordered_node_ref_set uns;
   for (size_t i = 0, size = assertions.size(); i < size; ++i)
   {
-    visit.push_back(assertions[i]);
+    if (assertions[i].node_info().uninterpreted)
+    {
+      visit.push_back(assertions[i]);
+    }
   }
 
   if (visit.empty())
@@ -71,7 +74,14 @@ PassElimUninterpreted::apply(AssertionVector& assertions)
     visit.pop_back();
     if (vinserted)
     {
-      visit.insert(visit.end(), cur.begin(), cur.end());
+      for (const Node& child : cur)
+      {
+        // skip subtrees without nodes over uninterpreted sorts
+        if (child.node_info().uninterpreted)
+        {
+          visit.push_back(child);
+        }
+      }
       if (cur.type().is_uninterpreted())
       {
         auto [cit, cinserted] = cnt.emplace(cur.type(), 1);
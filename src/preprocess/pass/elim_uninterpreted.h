@@ -32,7 +32,7 @@ class PassElimUninterpreted : public PreprocessingPass
   /** Backtrackable substitution map. */
   backtrack::unordered_map<Node, Node> d_substitutions;
   /** Cache of processed nodes that maybe shared across substitutions. */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeMap<Node> d_cache;
 
   struct Statistics
   {
@@ -65,7 +65,7 @@ PassEmbeddedConstraints::apply(AssertionVector& assertions)
     return;
   }
 
-  std::unordered_map<Node, Node> cache;
+  node::NodeMap<Node> cache;
   for (size_t i = 0, size = assertions.size(); i < size; ++i)
   {
     const Node& assertion = assertions[i];
@@ -93,15 +93,16 @@ PassEmbeddedConstraints::apply(AssertionVector& assertions)
 Node
 PassEmbeddedConstraints::process(const Node& node)
 {
+  // Per-term cache, a NodeMap would allocate pages up to the largest node id.
   std::unordered_map<Node, Node> cache;
   return _process(node, cache);
 }
 
 /* --- PassEmbeddedConstraints private -------------------------------------- */
 
+template <class Cache>
 Node
-PassEmbeddedConstraints::_process(const Node& node,
-                                  std::unordered_map<Node, Node>& cache)
+PassEmbeddedConstraints::_process(const Node& node, Cache& cache)
 {
   auto [res, num_substs] = substitute(node, d_substitutions, cache);
   res                    = d_env.rewriter().rewrite(res);
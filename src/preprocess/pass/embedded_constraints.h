@@ -29,7 +29,8 @@ class PassEmbeddedConstraints : public PreprocessingPass
   Node process(const Node& node) override;
 
  private:
-  Node _process(const Node& node, std::unordered_map<Node, Node>& cache);
+  template <class Cache>
+  Node _process(const Node& node, Cache& cache);
 
   /** Backtrackable substitution map. */
   backtrack::unordered_map<Node, Node> d_substitutions;
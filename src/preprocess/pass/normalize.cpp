@@ -48,9 +48,7 @@ using namespace bzla::node;
 class AigScore
 {
  public:
-  using AigNodeRefSet =
-      std::unordered_set<std::reference_wrapper<const bitblast::AigNode>,
-                         std::hash<bitblast::AigNode>>;
+  using AigNodeSet = std::unordered_set<bitblast::AigNode>;
 
   /** Add term to score. */
   void add(const Node& term) { d_visit.push_back(term); }
@@ -678,9 +676,16 @@ namespace {
 util::Integer
 ubv_to_int(const BitVector& bv)
 {
-  return (bv.size() <= BitVector::s_native_size)
-             ? util::Integer(bv.to_uint64())
-             : util::Integer::from_mpz_t(bv.gmp_value());
+  if (bv.size() <= BitVector::s_native_size)
+  {
+    return util::Integer(bv.to_uint64());
+  }
+  mpz_t val;
+  mpz_init(val);
+  bv.get_mpz(val);
+  util::Integer res = util::Integer::from_mpz_t(val);
+  mpz_clear(val);
+  return res;
 }
 
 }  // namespace
@@ -1710,7 +1715,7 @@ PassNormalize::normalize_adders(const std::vector<Node>& assertions,
     }
   }
 
-  std::unordered_map<Node, Node> subst_cache;
+  node::NodeMap<Node> subst_cache;
   for (size_t i = 0, size = assertions.size(); i < size; ++i)
   {
     norm_assertions.push_back(
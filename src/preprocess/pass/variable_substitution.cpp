@@ -767,6 +767,39 @@ PassVariableSubstitution::find_vars(const Node& assertion, size_t index)
   } while (!visit.empty());
 }
 
+std::vector<Node>
+PassVariableSubstitution::copy(const PassVariableSubstitution& other,
+                               size_t begin,
+                               size_t end)
+{
+  std::vector<Node> res;
+  auto& substitution_map = d_cache.substitutions();
+  for (const auto& [index, var] : other.d_substitution_assertions)
+  {
+    if (index < begin || index >= end)
+    {
+      continue;
+    }
+    auto it = other.d_substitutions.find(var);
+    assert(it != other.d_substitutions.end());
+    d_substitution_assertions.emplace(index, var);
+    d_substitutions.emplace(var, it->second);
+    substitution_map.emplace(var, it->second.first);
+    res.push_back(it->second.second);
+  }
+  for (const auto& [var, index] : other.d_first_seen)
+  {
+    if (index >= begin && index < end)
+    {
+      d_first_seen.emplace(var, index);
+      d_first_seen_cache.insert(var);
+    }
+  }
+  d_cache.cache().clear();
+  d_stats.num_substs = substitution_map.size();
+  return res;
+}
+
 const std::unordered_map<Node, Node>&
 PassVariableSubstitution::substitutions() const
 {
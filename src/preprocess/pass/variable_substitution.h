@@ -39,6 +39,18 @@ class PassVariableSubstitution : public PreprocessingPass
   /** Get substitution assertion for substituted variable. */
   const Node& substitution_assertion(const Node& var) const;
 
+  /**
+   * Copy the substitutions of `other` that were derived from assertions
+   * with index in [begin, end).
+   * @param other The pass to copy the substitutions from.
+   * @param begin The index of the first assertion.
+   * @param end   The index after the last assertion.
+   * @return The substitution assertions of the copied substitutions.
+   */
+  std::vector<Node> copy(const PassVariableSubstitution& other,
+                         size_t begin,
+                         size_t end);
+
  private:
   void remove_indirect_cycles(std::unordered_map<Node, Node>& substs) const;
 
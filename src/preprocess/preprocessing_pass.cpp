@@ -63,10 +63,11 @@ PreprocessingPass::count_parents(const Node& node,
   } while (!visit.empty());
 }
 
+template <class Cache>
 std::pair<Node, uint64_t>
 PreprocessingPass::substitute(const Node& node,
                               const SubstitutionMap& substitutions,
-                              std::unordered_map<Node, Node>& cache) const
+                              Cache& cache) const
 {
   node::node_ref_vector visit{node};
   uint64_t num_substs = 0;
@@ -108,15 +109,31 @@ PreprocessingPass::substitute(const Node& node,
   return std::make_pair(it->second, num_substs);
 }
 
+template <class Cache>
 Node
 PreprocessingPass::substitute(
     const Node& node,
     const std::unordered_map<Node, Node>& substitutions,
-    std::unordered_map<Node, Node>& cache) const
+    Cache& cache) const
 {
   return node::utils::substitute(d_env.nm(), node, substitutions, cache);
 }
 
+template std::pair<Node, uint64_t> PreprocessingPass::substitute(
+    const Node&,
+    const SubstitutionMap&,
+    std::unordered_map<Node, Node>&) const;
+template std::pair<Node, uint64_t> PreprocessingPass::substitute(
+    const Node&, const SubstitutionMap&, node::NodeMap<Node>&) const;
+template Node PreprocessingPass::substitute(
+    const Node&,
+    const std::unordered_map<Node, Node>&,
+    std::unordered_map<Node, Node>&) const;
+template Node PreprocessingPass::substitute(
+    const Node&,
+    const std::unordered_map<Node, Node>&,
+    node::NodeMap<Node>&) const;
+
 bool
 PreprocessingPass::cache_assertion(const Node& assertion)
 {
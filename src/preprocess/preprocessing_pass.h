@@ -15,6 +15,7 @@
 
 #include "backtrack/unordered_map.h"
 #include "node/node.h"
+#include "node/node_map.h"
 #include "preprocess/assertion_vector.h"
 #include "util/statistics.h"
 
@@ -85,19 +86,22 @@ class PreprocessingPass
    * @param substitutions A Map from node that should be substituted to node to
    *                      substitute with.
    * @param cache         The substitution cache, maps node to its substitution
-   *                      if applicable, else to itself.
+   *                      if applicable, else to itself. Either a
+   *                      std::unordered_map<Node, Node> or, for caches over
+   *                      large parts of the node DAG, a node::NodeMap<Node>.
    * @return The rewritten form of the node with all occurrences in the
    *         substitution map replaced by their substitutions and the number
    *         of substitutions performed.
    */
-  std::pair<Node, uint64_t> substitute(
-      const Node& node,
-      const SubstitutionMap& substitutions,
-      std::unordered_map<Node, Node>& cache) const;
+  template <class Cache>
+  std::pair<Node, uint64_t> substitute(const Node& node,
+                                       const SubstitutionMap& substitutions,
+                                       Cache& cache) const;
 
+  template <class Cache>
   Node substitute(const Node& node,
                   const std::unordered_map<Node, Node>& substitutions,
-                  std::unordered_map<Node, Node>& cache) const;
+                  Cache& cache) const;
 
   /**
    * Mark assertion as processed.
@@ -212,6 +212,20 @@ Preprocessor::substitutions() const
   return d_pass_variable_substitution.substitutions();
 }
 
+std::vector<Node>
+Preprocessor::copy_level(const Preprocessor& other, size_t level)
+{
+  assert(d_assertions.begin() == d_assertions.begin(level));
+  sync_scope(level);
+  size_t begin = d_assertions.begin(level);
+  size_t end   = d_assertions.end(level);
+  std::vector<Node> res = d_pass_variable_substitution.copy(
+      other.d_pass_variable_substitution, begin, end);
+  d_assertions.set_index(end);
+  d_num_preprocess = other.d_num_preprocess;
+  return res;
+}
+
 /* --- Preprocessor private ------------------------------------------------- */
 
 void
@@ -62,6 +62,21 @@ class Preprocessor
   /** Get current map of active substitutions. */
   const std::unordered_map<Node, Node>& substitutions() const;
 
+  /**
+   * Copy the preprocessing state of `other` for the assertions on the given
+   * level and mark these assertions as preprocessed.
+   *
+   * The preprocessed assertions of `other` up to this level must have been
+   * asserted at the same indices and levels in this preprocessor's assertion
+   * stack. Only the variable substitutions are copied, the state of the
+   * remaining passes is not required for preprocessing further assertions.
+   *
+   * @param other The preprocessor to copy from.
+   * @param level The assertion level to copy.
+   * @return The substitution assertions of the copied substitutions.
+   */
+  std::vector<Node> copy_level(const Preprocessor& other, size_t level);
+
  private:
   /** Apply all preprocessing passes to assertions until fixed-point. */
   void apply(AssertionVector& assertions);
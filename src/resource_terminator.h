@@ -31,6 +31,8 @@ class ResourceTerminator : public Terminator
   bool terminate() override;
 
   void set_terminator(Terminator* terminator);
+  /** @return The wrapped terminator, nullptr if none was configured. */
+  Terminator* terminator() const { return d_terminator; }
   void set_time_limit(uint64_t time_limit);
   void set_memory_limit(uint64_t memory_limit);
 
@@ -50,38 +50,26 @@ using namespace node;
 #ifndef NDEBUG
 namespace {
 
-std::pair<size_t, size_t>
+size_t
 diff(uint64_t max_id, const Node& rewritten)
 {
   node::node_ref_vector visit{rewritten};
-  std::vector<size_t> depths{0};
-  size_t max_depth = 0;
   node::unordered_node_ref_set cache;
   do
   {
     const Node& cur = visit.back();
-    size_t depth    = depths.back();
     visit.pop_back();
-    depths.pop_back();
     if (cur.id() < max_id)
     {
       continue;
     }
-    if (depth > max_depth)
-    {
-      max_depth = depth;
-    }
     auto [it, inserted] = cache.insert(cur);
     if (inserted)
     {
       visit.insert(visit.end(), cur.begin(), cur.end());
-      for (size_t i = 0; i < cur.num_children(); ++i)
-      {
-        depths.push_back(depth + 1);
-      }
     }
   } while (!visit.empty());
-  return std::make_pair(cache.size(), max_depth);
+  return cache.size();
 }
 
 }  // namespace
@@ -132,9 +120,10 @@ Rewriter::rewrite(const Node& node)
         uint64_t thresh = d_env.options().dbg_rw_node_thresh();
         if (thresh > 0 && d_num_nodes > 0)
         {
-          auto [new_nodes, depth] = diff(max_id, it->second);
+          size_t new_nodes = diff(max_id, it->second);
           Warn(new_nodes >= thresh) << "_rewrite() introduced " << new_nodes
-                                    << " new nodes up to depth " << depth;
+                                    << " new nodes up to depth "
+                                    << it->second.node_info().depth;
         }
 #endif
       }
@@ -183,8 +172,8 @@ Rewriter::eval(const Node& node)
 
 const Node&
 Rewriter::mk_node(node::Kind kind,
-                  const std::vector<Node>& children,
-                  const std::vector<uint64_t>& indices)
+                  util::Span<Node> children,
+                  util::Span<uint64_t> indices)
 {
 #ifndef NDEBUG
   uint64_t max_id = d_env.nm().max_node_id();
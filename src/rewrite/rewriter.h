@@ -17,6 +17,8 @@
 #endif
 
 #include "node/node.h"
+#include "node/node_map.h"
+#include "util/span.h"
 #include "util/statistics.h"
 
 namespace bzla {
@@ -77,8 +79,8 @@ class Rewriter
    * @return The created, rewritten node.
    */
   const Node& mk_node(node::Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices = {});
+                      util::Span<Node> children,
+                      util::Span<uint64_t> indices = {});
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
@@ -287,7 +289,7 @@ class Rewriter
   uint8_t d_level;
   const bool d_arithmetic;
   /** Cache nodes rewritten during rewrite(), maps node to rewritten form. */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeMap<Node> d_cache;
   /**
    * Cache nodes rewritten during eval(), maps node to rewritten form.
    * This points to the general rewriter cache (d_cache) if the rewrite level
@@ -296,7 +298,7 @@ class Rewriter
    *       duplicate eval work (and duplicate nodes between the 2 caches) for
    *       rwl >= 1.
    */
-  std::unordered_map<Node, Node>& d_eval_cache;
+  node::NodeMap<Node>& d_eval_cache;
   /**
    * The actual eval cache.
    * This cache is only utilized if the rewrite level = 0 to avoid duplicate
@@ -304,7 +306,7 @@ class Rewriter
    * @note We need a separate cache from the rewriter cache for eval() to be
    *       able to evaluate nodes in case level 1 rewriting is disabled.
    */
-  std::unordered_map<Node, Node> d_eval_cache_aux;
+  node::NodeMap<Node> d_eval_cache_aux;
 #ifndef NDEBUG
   /** Cache for detecting rewrite cycles in debug mode. */
   std::unordered_set<Node> d_rec_cache;
@@ -10,6 +10,8 @@
 
 #include "sat/cadical.h"
 
+#include <cstdlib>
+
 namespace bzla::sat {
 
 /* CadicalTerminator public ------------------------------------------------- */
@@ -41,6 +43,27 @@ Cadical::add(int32_t lit)
   d_solver->add(lit);
 }
 
+void
+Cadical::add_clause(util::Span<int32_t> lits)
+{
+  CaDiCaL::Solver* solver = d_solver.get();
+  for (int32_t lit : lits)
+  {
+    solver->add(lit);
+  }
+  solver->add(0);
+}
+
+void
+Cadical::add_clauses(util::Span<int32_t> clauses)
+{
+  CaDiCaL::Solver* solver = d_solver.get();
+  for (int32_t lit : clauses)
+  {
+    solver->add(lit);
+  }
+}
+
 void
 Cadical::assume(int32_t lit)
 {
@@ -91,6 +114,80 @@ Cadical::configure_terminator(Terminator* terminator)
   }
 }
 
+void
+Cadical::freeze(int32_t lit)
+{
+  d_solver->freeze(lit);
+}
+
+void
+Cadical::melt(int32_t lit)
+{
+  d_solver->melt(lit);
+}
+
+void
+Cadical::phase(int32_t lit)
+{
+  d_solver->phase(lit);
+}
+
+void
+Cadical::set_conflict_limit(int32_t limit)
+{
+  d_solver->limit("conflicts", limit);
+}
+
+void
+Cadical::set_option(const char* name, int32_t value)
+{
+  d_solver->set(name, value);
+}
+
+void
+Cadical::configure(const char* config)
+{
+  d_solver->configure(config);
+}
+
+void
+Cadical::connect_learner(CaDiCaL::Learner* learner)
+{
+  if (learner)
+  {
+    d_solver->connect_learner(learner);
+  }
+  else
+  {
+    d_solver->disconnect_learner();
+  }
+}
+
+void
+Cadical::connect_external_propagator(CaDiCaL::ExternalPropagator* propagator)
+{
+  if (propagator)
+  {
+    d_solver->connect_external_propagator(propagator);
+  }
+  else
+  {
+    d_solver->disconnect_external_propagator();
+  }
+}
+
+void
+Cadical::add_observed_var(int32_t lit)
+{
+  d_solver->add_observed_var(std::abs(lit));
+}
+
+void
+Cadical::remove_observed_var(int32_t lit)
+{
+  d_solver->remove_observed_var(std::abs(lit));
+}
+
 const char *
 Cadical::get_version() const
 {
@@ -36,12 +36,54 @@ class Cadical : public SatSolver
   Cadical();
 
   void add(int32_t lit) override;
+  void add_clause(util::Span<int32_t> lits) override;
+  void add_clauses(util::Span<int32_t> clauses) override;
   void assume(int32_t lit) override;
   int32_t value(int32_t lit) override;
   bool failed(int32_t lit) override;
   int32_t fixed(int32_t lit) override;
+  void freeze(int32_t lit) override;
+  void melt(int32_t lit) override;
+  void phase(int32_t lit) override;
   Result solve() override;
   void configure_terminator(Terminator* terminator) override;
+  /**
+   * Limit the number of conflicts of the next solve() call, which returns
+   * UNKNOWN if the limit is reached.
+   */
+  void set_conflict_limit(int32_t limit);
+  /**
+   * Set CaDiCaL option.
+   * @param name  The name of the option.
+   * @param value The value of the option.
+   */
+  void set_option(const char *name, int32_t value);
+  /**
+   * Apply CaDiCaL configuration, must be called before adding clauses.
+   * @param config The name of the configuration, e.g., "sat" or "unsat".
+   */
+  void configure(const char *config);
+  /**
+   * Connect learner, which is notified about learned clauses.
+   * @param learner The learner, nullptr to disconnect.
+   */
+  void connect_learner(CaDiCaL::Learner *learner);
+  /**
+   * Connect external propagator.
+   * @param propagator The propagator, nullptr to disconnect.
+   */
+  void connect_external_propagator(CaDiCaL::ExternalPropagator *propagator);
+  /**
+   * Mark variable of valid non-zero literal as observed by the external
+   * propagator. Observed variables are not eliminated.
+   * @param lit The literal.
+   */
+  void add_observed_var(int32_t lit);
+  /**
+   * Remove variable of valid non-zero literal from the observed variables.
+   * @param lit The literal.
+   */
+  void remove_observed_var(int32_t lit);
   const char *get_name() const override { return "CaDiCaL"; }
   const char *get_version() const override;
 
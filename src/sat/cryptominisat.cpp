@@ -40,6 +40,33 @@ CryptoMiniSat::add(int32_t lit)
   }
 }
 
+void
+CryptoMiniSat::add_clause(util::Span<int32_t> lits)
+{
+  assert(d_clause.empty());
+  for (int32_t lit : lits)
+  {
+    d_clause.push_back(import_lit(lit));
+  }
+  d_solver->add_clause(d_clause), d_clause.clear();
+}
+
+void
+CryptoMiniSat::add_clauses(util::Span<int32_t> clauses)
+{
+  for (int32_t lit : clauses)
+  {
+    if (lit)
+    {
+      d_clause.push_back(import_lit(lit));
+    }
+    else
+    {
+      d_solver->add_clause(d_clause), d_clause.clear();
+    }
+  }
+}
+
 void
 CryptoMiniSat::assume(int32_t lit)
 {
@@ -29,6 +29,8 @@ class CryptoMiniSat : public SatSolver
   CryptoMiniSat(uint32_t nthreads);
 
   void add(int32_t lit) override;
+  void add_clause(util::Span<int32_t> lits) override;
+  void add_clauses(util::Span<int32_t> clauses) override;
   void assume(int32_t lit) override;
   int32_t value(int32_t lit) override;
   bool failed(int32_t lit) override;
@@ -49,6 +49,25 @@ Kissat::add(int32_t lit)
   kissat_add(d_solver, lit);
 }
 
+void
+Kissat::add_clause(util::Span<int32_t> lits)
+{
+  for (int32_t lit : lits)
+  {
+    kissat_add(d_solver, lit);
+  }
+  kissat_add(d_solver, 0);
+}
+
+void
+Kissat::add_clauses(util::Span<int32_t> clauses)
+{
+  for (int32_t lit : clauses)
+  {
+    kissat_add(d_solver, lit);
+  }
+}
+
 void
 Kissat::assume(int32_t lit)
 {
@@ -0,0 +1,591 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "sat/portfolio.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+
+namespace bzla::sat {
+
+/* Portfolio::PortfolioTerminator public ------------------------------------ */
+
+bool
+Portfolio::PortfolioTerminator::terminate()
+{
+  if (d_portfolio.d_done)
+  {
+    return true;
+  }
+  if (d_portfolio.d_external_terminator)
+  {
+    std::lock_guard<std::mutex> lock(d_portfolio.d_terminator_mutex);
+    return d_portfolio.d_external_terminator->terminate();
+  }
+  return false;
+}
+
+/* Portfolio::ClauseBuffer public ------------------------------------------- */
+
+Portfolio::ClauseBuffer::ClauseBuffer() : d_lits(s_buffer_capacity) {}
+
+void
+Portfolio::ClauseBuffer::write(const std::vector<int32_t>& clause)
+{
+  uint64_t pos = d_head.load(std::memory_order_relaxed);
+  uint64_t end = pos + clause.size() + 1;
+  // Announce positions to be overwritten before writing them, consumers
+  // check d_reserved after reading to detect overwritten clauses.
+  d_reserved.store(end, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (int32_t lit : clause)
+  {
+    d_lits[pos++ % s_buffer_capacity].store(lit, std::memory_order_relaxed);
+  }
+  d_lits[pos % s_buffer_capacity].store(0, std::memory_order_relaxed);
+  d_head.store(end, std::memory_order_release);
+}
+
+bool
+Portfolio::ClauseBuffer::read(uint64_t& pos, std::vector<int32_t>& clause) const
+{
+  uint64_t head = d_head.load(std::memory_order_acquire);
+  if (pos == head)
+  {
+    return false;
+  }
+  if (head - pos > s_buffer_capacity)
+  {
+    // Unread clauses were overwritten.
+    pos = head;
+    return false;
+  }
+
+  uint64_t start = pos;
+  clause.clear();
+  int32_t lit;
+  while ((lit = d_lits[pos++ % s_buffer_capacity].load(
+              std::memory_order_relaxed))
+         != 0)
+  {
+    clause.push_back(lit);
+    if (clause.size() > static_cast<size_t>(s_max_shared_size))
+    {
+      break;
+    }
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (lit != 0
+      || d_reserved.load(std::memory_order_relaxed)
+             > start + s_buffer_capacity)
+  {
+    // Clause was overwritten while reading.
+    pos = d_head.load(std::memory_order_acquire);
+    return false;
+  }
+  return true;
+}
+
+/* Portfolio::ClauseExchange public ----------------------------------------- */
+
+Portfolio::ClauseExchange::ClauseExchange(Portfolio& portfolio, size_t idx)
+    : d_portfolio(portfolio),
+      d_idx(idx),
+      d_read_pos(portfolio.d_solvers.size()),
+      d_next((idx + 1) % portfolio.d_solvers.size())
+{
+}
+
+bool
+Portfolio::ClauseExchange::learning(int size)
+{
+  return size <= s_max_shared_size;
+}
+
+void
+Portfolio::ClauseExchange::learn(int lit)
+{
+  if (lit)
+  {
+    d_learned.push_back(lit);
+  }
+  else
+  {
+    d_portfolio.d_buffers[d_idx]->write(d_learned);
+    d_learned.clear();
+    ++d_num_exported;
+  }
+}
+
+void
+Portfolio::ClauseExchange::notify_assignment(const std::vector<int>& lits)
+{
+  (void) lits;
+}
+
+void
+Portfolio::ClauseExchange::notify_backtrack(size_t new_level)
+{
+  (void) new_level;
+}
+
+bool
+Portfolio::ClauseExchange::cb_check_found_model(const std::vector<int>& model)
+{
+  (void) model;
+  return true;
+}
+
+bool
+Portfolio::ClauseExchange::cb_has_external_clause(bool& is_forgettable)
+{
+  size_t num_solvers = d_read_pos.size();
+  for (size_t i = 0; i < num_solvers; ++i)
+  {
+    size_t idx = (d_next + i) % num_solvers;
+    if (idx == d_idx)
+    {
+      continue;
+    }
+    const ClauseBuffer& buffer = *d_portfolio.d_buffers[idx];
+    while (buffer.read(d_read_pos[idx], d_import))
+    {
+      if (is_observed(d_import))
+      {
+        d_next         = idx;
+        d_import_pos   = 0;
+        is_forgettable = true;
+        ++d_num_imported;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+int
+Portfolio::ClauseExchange::cb_add_external_clause_lit()
+{
+  if (d_import_pos < d_import.size())
+  {
+    return d_import[d_import_pos++];
+  }
+  return 0;
+}
+
+/* Portfolio::ClauseExchange private ---------------------------------------- */
+
+bool
+Portfolio::ClauseExchange::is_observed(const std::vector<int32_t>& clause) const
+{
+  const std::vector<bool>& observed = d_portfolio.d_observed;
+  for (int32_t lit : clause)
+  {
+    size_t var = std::abs(lit);
+    if (var >= observed.size() || !observed[var])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Portfolio public --------------------------------------------------------- */
+
+Portfolio::Portfolio(uint64_t num_solvers, bool share)
+    : d_terminator(*this), d_share(share && num_solvers > 1)
+{
+  assert(num_solvers > 0);
+  for (uint64_t i = 0; i < num_solvers; ++i)
+  {
+    Cadical* solver = new Cadical();
+    d_solvers.emplace_back(solver);
+    // Diversify instances, the first instance uses the default configuration.
+    switch (i % 4)
+    {
+      case 1: solver->set_option("phase", 0); break;
+      case 2: solver->configure("sat"); break;
+      case 3: solver->configure("unsat"); break;
+      default: break;
+    }
+    solver->set_option("seed", static_cast<int32_t>(i));
+    solver->configure_terminator(&d_terminator);
+  }
+  if (d_share)
+  {
+    for (size_t i = 0; i < d_solvers.size(); ++i)
+    {
+      d_buffers.emplace_back(new ClauseBuffer());
+      d_exchanges.emplace_back(new ClauseExchange(*this, i));
+      d_solvers[i]->connect_learner(d_exchanges[i].get());
+      d_solvers[i]->connect_external_propagator(d_exchanges[i].get());
+    }
+  }
+  for (size_t i = 1; i < d_solvers.size(); ++i)
+  {
+    d_workers.emplace_back(&Portfolio::worker, this, i);
+  }
+}
+
+Portfolio::~Portfolio()
+{
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_shutdown = true;
+  }
+  d_start.notify_all();
+  for (auto& t : d_workers)
+  {
+    t.join();
+  }
+  if (d_share)
+  {
+    for (auto& solver : d_solvers)
+    {
+      solver->connect_learner(nullptr);
+      solver->connect_external_propagator(nullptr);
+    }
+  }
+}
+
+void
+Portfolio::add(int32_t lit)
+{
+  if (d_share)
+  {
+    d_max_var = std::max(d_max_var, std::abs(lit));
+  }
+  for (auto& solver : d_solvers)
+  {
+    solver->add(lit);
+  }
+}
+
+void
+Portfolio::add_clause(util::Span<int32_t> lits)
+{
+  if (d_share)
+  {
+    for (int32_t lit : lits)
+    {
+      d_max_var = std::max(d_max_var, std::abs(lit));
+    }
+  }
+  for (auto& solver : d_solvers)
+  {
+    solver->add_clause(lits);
+  }
+}
+
+void
+Portfolio::add_clauses(util::Span<int32_t> clauses)
+{
+  if (d_share)
+  {
+    for (int32_t lit : clauses)
+    {
+      d_max_var = std::max(d_max_var, std::abs(lit));
+    }
+  }
+  for (auto& solver : d_solvers)
+  {
+    solver->add_clauses(clauses);
+  }
+}
+
+void
+Portfolio::assume(int32_t lit)
+{
+  if (d_share)
+  {
+    d_max_var = std::max(d_max_var, std::abs(lit));
+  }
+  d_assumptions.push_back(lit);
+}
+
+int32_t
+Portfolio::value(int32_t lit)
+{
+  return d_solvers[d_winner]->value(lit);
+}
+
+bool
+Portfolio::failed(int32_t lit)
+{
+  if (d_cube_mode)
+  {
+    return d_failed.find(lit) != d_failed.end();
+  }
+  return d_solvers[d_winner]->failed(lit);
+}
+
+int32_t
+Portfolio::fixed(int32_t lit)
+{
+  return d_solvers[d_winner]->fixed(lit);
+}
+
+void
+Portfolio::freeze(int32_t lit)
+{
+  for (auto& solver : d_solvers)
+  {
+    solver->freeze(lit);
+  }
+}
+
+void
+Portfolio::melt(int32_t lit)
+{
+  for (auto& solver : d_solvers)
+  {
+    solver->melt(lit);
+  }
+  // Allow CaDiCaL to eliminate melted variables.
+  if (d_share)
+  {
+    size_t var = std::abs(lit);
+    observe_vars();
+    if (var < d_observed.size() && d_observed[var])
+    {
+      d_observed[var] = false;
+      for (auto& solver : d_solvers)
+      {
+        solver->remove_observed_var(lit);
+      }
+    }
+  }
+}
+
+void
+Portfolio::phase(int32_t lit)
+{
+  for (auto& solver : d_solvers)
+  {
+    solver->phase(lit);
+  }
+}
+
+Result
+Portfolio::solve()
+{
+  if (d_share)
+  {
+    observe_vars();
+  }
+
+  for (auto& solver : d_solvers)
+  {
+    for (int32_t lit : d_assumptions)
+    {
+      solver->assume(lit);
+    }
+  }
+  d_assumptions.clear();
+  d_cube_mode = false;
+
+  run_round();
+  return d_result;
+}
+
+Result
+Portfolio::solve_cubes(const std::vector<std::vector<int32_t>>& cubes)
+{
+  if (d_share)
+  {
+    observe_vars();
+  }
+
+  // Assumptions are added to each cube in conquer().
+  d_cubes     = &cubes;
+  d_cube_mode = true;
+  d_next_cube = 0;
+  d_cube_results.assign(cubes.size(), CubeResult());
+  d_cube_failed.resize(d_solvers.size());
+  for (auto& failed : d_cube_failed)
+  {
+    failed.clear();
+  }
+
+  run_round();
+
+  d_cubes = nullptr;
+  d_assumptions.clear();
+  d_failed.clear();
+  if (d_result != Result::SAT)
+  {
+    d_result = Result::UNSAT;
+    for (const CubeResult& res : d_cube_results)
+    {
+      if (res.result != Result::UNSAT)
+      {
+        d_result = Result::UNKNOWN;
+        break;
+      }
+    }
+    if (d_result == Result::UNSAT)
+    {
+      for (const auto& failed : d_cube_failed)
+      {
+        d_failed.insert(failed.begin(), failed.end());
+      }
+    }
+  }
+  return d_result;
+}
+
+void
+Portfolio::configure_terminator(Terminator* terminator)
+{
+  d_external_terminator = terminator;
+}
+
+const char *
+Portfolio::get_version() const
+{
+  return d_solvers[0]->get_version();
+}
+
+/* Portfolio private -------------------------------------------------------- */
+
+void
+Portfolio::worker(size_t idx)
+{
+  uint64_t round = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(d_mutex);
+      d_start.wait(lock, [this, round]() {
+        return d_shutdown || d_round != round;
+      });
+      if (d_shutdown)
+      {
+        return;
+      }
+      round = d_round;
+    }
+    solve_instance(idx);
+  }
+}
+
+void
+Portfolio::observe_vars()
+{
+  size_t num_vars = static_cast<size_t>(d_max_var) + 1;
+  if (num_vars <= d_observed.size())
+  {
+    return;
+  }
+  size_t first = std::max<size_t>(d_observed.size(), 1);
+  d_observed.resize(num_vars, true);
+  for (size_t var = first; var < num_vars; ++var)
+  {
+    for (auto& solver : d_solvers)
+    {
+      solver->add_observed_var(static_cast<int32_t>(var));
+    }
+  }
+}
+
+void
+Portfolio::run_round()
+{
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_result       = Result::UNKNOWN;
+    d_winner       = 0;
+    d_num_finished = 0;
+    d_done         = false;
+    ++d_round;
+  }
+  d_start.notify_all();
+
+  solve_instance(0);
+
+  std::unique_lock<std::mutex> lock(d_mutex);
+  d_finished.wait(lock,
+                  [this]() { return d_num_finished == d_solvers.size(); });
+
+  if (d_share)
+  {
+    d_statistics = {};
+    for (const auto& exchange : d_exchanges)
+    {
+      d_statistics.num_exported += exchange->d_num_exported;
+      d_statistics.num_imported += exchange->d_num_imported;
+    }
+  }
+}
+
+Result
+Portfolio::conquer(size_t idx)
+{
+  Cadical& solver = *d_solvers[idx];
+  while (!d_done)
+  {
+    size_t i = d_next_cube++;
+    if (i >= d_cubes->size())
+    {
+      break;
+    }
+    for (int32_t lit : d_assumptions)
+    {
+      solver.assume(lit);
+    }
+    for (int32_t lit : (*d_cubes)[i])
+    {
+      solver.assume(lit);
+    }
+    auto start = std::chrono::steady_clock::now();
+    Result res = solver.solve();
+    // Each cube is solved by exactly one instance, no locking required.
+    d_cube_results[i].result  = res;
+    d_cube_results[i].time_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    if (res != Result::UNSAT)
+    {
+      return res;
+    }
+    for (int32_t lit : d_assumptions)
+    {
+      if (solver.failed(lit))
+      {
+        d_cube_failed[idx].push_back(lit);
+      }
+    }
+  }
+  return Result::UNSAT;
+}
+
+void
+Portfolio::solve_instance(size_t idx)
+{
+  Result res = d_cubes ? conquer(idx) : d_solvers[idx]->solve();
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    // In cube mode, UNSAT only means that all cubes solved by this instance
+    // are unsatisfiable.
+    if (res != Result::UNKNOWN && (!d_cubes || res == Result::SAT) && !d_done)
+    {
+      d_result = res;
+      d_winner = idx;
+      d_done   = true;
+    }
+    ++d_num_finished;
+  }
+  d_finished.notify_one();
+}
+
+}  // namespace bzla::sat
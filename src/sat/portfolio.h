@@ -0,0 +1,299 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_SAT_PORTFOLIO_H_INCLUDED
+#define BZLA_SAT_PORTFOLIO_H_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "sat/cadical.h"
+#include "sat/sat_solver.h"
+#include "terminator.h"
+
+namespace bzla::sat {
+
+/**
+ * Parallel portfolio of differently configured CaDiCaL instances.
+ *
+ * All clauses, assumptions and freeze/melt calls are replayed into every
+ * instance. On solve(), the instances are raced on a pool of worker threads
+ * (the calling thread runs the first instance). The first definitive answer
+ * terminates the remaining instances, and model and failed literal queries
+ * are answered by the winning instance.
+ *
+ * If clause sharing is enabled, instances export short learned clauses into
+ * a lock-free ring buffer per instance, from which the other instances
+ * import them via CaDiCaL's external propagator interface while solving.
+ * Learned clauses are implied by the (shared) input clauses and do not
+ * depend on assumptions, hence they stay valid across incremental calls.
+ * Imported clauses may only contain variables observed by the external
+ * propagator, which are not eliminated by CaDiCaL. Hence, all variables are
+ * observed until they are melted.
+ *
+ * In cube-and-conquer mode (solve_cubes()), the instances do not race on
+ * the same problem but solve a given set of cubes as additional
+ * assumptions, where each instance picks the next unsolved cube.
+ */
+class Portfolio : public SatSolver
+{
+ public:
+  struct Statistics
+  {
+    uint64_t num_exported = 0;  // Number of exported learned clauses
+    uint64_t num_imported = 0;  // Number of imported learned clauses
+  };
+
+  /** The result of a cube of the last solve_cubes() call. */
+  struct CubeResult
+  {
+    /** The result, UNKNOWN if the cube was not solved. */
+    Result result = Result::UNKNOWN;
+    /** The solving time in milliseconds. */
+    uint64_t time_ms = 0;
+  };
+
+  /** The maximum size of shared learned clauses. */
+  static constexpr int32_t s_max_shared_size = 8;
+  /** The capacity of the clause buffer of each instance in literals. */
+  static constexpr uint64_t s_buffer_capacity = 1 << 20;
+
+  /**
+   * Constructor.
+   * @param num_solvers The number of solver instances, must be at least 1.
+   * @param share       True to share learned clauses between instances.
+   */
+  Portfolio(uint64_t num_solvers, bool share = false);
+  ~Portfolio();
+
+  void add(int32_t lit) override;
+  void add_clause(util::Span<int32_t> lits) override;
+  void add_clauses(util::Span<int32_t> clauses) override;
+  void assume(int32_t lit) override;
+  int32_t value(int32_t lit) override;
+  bool failed(int32_t lit) override;
+  int32_t fixed(int32_t lit) override;
+  void freeze(int32_t lit) override;
+  void melt(int32_t lit) override;
+  void phase(int32_t lit) override;
+  Result solve() override;
+  void configure_terminator(Terminator *terminator) override;
+  const char *get_name() const override { return "Portfolio"; }
+  const char *get_version() const override;
+
+  /**
+   * Check satisfiability of current formula via cube-and-conquer.
+   *
+   * The cubes are solved as assumptions (in addition to the assumptions
+   * added via assume()) on all instances until a cube is satisfiable or all
+   * cubes are unsatisfiable. The cubes must cover the search space, i.e.,
+   * their disjunction must be valid.
+   *
+   * If the result is UNSAT, failed() is answered with respect to the union
+   * of the failed assumptions of all cubes.
+   *
+   * @param cubes The cubes.
+   * @return SAT if any cube is satisfiable, UNSAT if all cubes are
+   *         unsatisfiable, and UNKNOWN otherwise.
+   */
+  Result solve_cubes(const std::vector<std::vector<int32_t>> &cubes);
+
+  /** @return The results of the cubes of the last solve_cubes() call. */
+  const std::vector<CubeResult> &cube_results() const
+  {
+    return d_cube_results;
+  }
+
+  /** @return The index of the instance that answered the last solve() call. */
+  size_t winner() const { return d_winner; }
+
+  /** @return Clause sharing statistics, updated after each solve() call. */
+  const Statistics& statistics() const { return d_statistics; }
+
+ private:
+  /**
+   * Lock-free single-producer multi-consumer ring buffer of 0-terminated
+   * clauses. Consumers keep their own read position. Clauses overwritten
+   * before they were read are skipped.
+   */
+  class ClauseBuffer
+  {
+   public:
+    ClauseBuffer();
+    /** Append clause, must only be called by the producer. */
+    void write(const std::vector<int32_t>& clause);
+    /**
+     * Read next clause.
+     * @param pos    The read position of the consumer, updated.
+     * @param clause Cleared and filled with the literals of the clause.
+     * @return False if no clause was read.
+     */
+    bool read(uint64_t& pos, std::vector<int32_t>& clause) const;
+
+   private:
+    /** The literals, indexed by position modulo capacity. */
+    std::vector<std::atomic<int32_t>> d_lits;
+    /** The end position of the last clause visible to consumers. */
+    std::atomic<uint64_t> d_head = 0;
+    /**
+     * The end position of the clause currently written, positions up to
+     * d_reserved - capacity may be overwritten.
+     */
+    std::atomic<uint64_t> d_reserved = 0;
+  };
+
+  /**
+   * Exports learned clauses of one instance and imports the clauses exported
+   * by the other instances.
+   */
+  class ClauseExchange : public CaDiCaL::Learner,
+                         public CaDiCaL::ExternalPropagator
+  {
+   public:
+    ClauseExchange(Portfolio& portfolio, size_t idx);
+
+    bool learning(int size) override;
+    void learn(int lit) override;
+
+    void notify_assignment(const std::vector<int>& lits) override;
+    void notify_new_decision_level() override {}
+    void notify_backtrack(size_t new_level) override;
+    bool cb_check_found_model(const std::vector<int>& model) override;
+    bool cb_has_external_clause(bool& is_forgettable) override;
+    int cb_add_external_clause_lit() override;
+
+    /** The number of exported clauses. */
+    uint64_t d_num_exported = 0;
+    /** The number of imported clauses. */
+    uint64_t d_num_imported = 0;
+
+   private:
+    /** @return True if all variables of `clause` are observed. */
+    bool is_observed(const std::vector<int32_t>& clause) const;
+
+    Portfolio& d_portfolio;
+    /** The index of the instance. */
+    size_t d_idx;
+    /** The learned clause currently exported. */
+    std::vector<int32_t> d_learned;
+    /** The read positions in the clause buffers of the other instances. */
+    std::vector<uint64_t> d_read_pos;
+    /** The index of the next clause buffer to import from. */
+    size_t d_next = 0;
+    /** The clause currently imported. */
+    std::vector<int32_t> d_import;
+    /** The position of the next literal of d_import to add. */
+    size_t d_import_pos = 0;
+  };
+
+  /** Mark variables added since the last call as observed. */
+  void observe_vars();
+  /** Start a solving round on all instances and wait for its end. */
+  void run_round();
+  /**
+   * Solve cubes on instance `idx` until a cube is satisfiable or there are
+   * no more cubes.
+   * @return SAT if a cube is satisfiable, UNKNOWN if solving a cube was
+   *         terminated, and UNSAT otherwise.
+   */
+  Result conquer(size_t idx);
+
+  /**
+   * Terminator connected to all instances. Terminates an instance if another
+   * instance already found a definitive answer, or if the terminator
+   * configured via configure_terminator() requests termination.
+   */
+  class PortfolioTerminator : public Terminator
+  {
+   public:
+    PortfolioTerminator(Portfolio& portfolio) : d_portfolio(portfolio) {}
+    bool terminate() override;
+
+   private:
+    Portfolio& d_portfolio;
+  };
+
+  /** Worker thread loop, solves instance `idx` whenever a round starts. */
+  void worker(size_t idx);
+  /** Solve instance `idx` and record its result. */
+  void solve_instance(size_t idx);
+
+  /** The solver instances. */
+  std::vector<std::unique_ptr<Cadical>> d_solvers;
+  /** Assumptions for the next solve() call. */
+  std::vector<int32_t> d_assumptions;
+  /** The worker threads, one per instance except the first. */
+  std::vector<std::thread> d_workers;
+  /** Terminator connected to all instances. */
+  PortfolioTerminator d_terminator;
+  /** The terminator configured via configure_terminator(). */
+  Terminator *d_external_terminator = nullptr;
+  /** Serializes calls to the external terminator. */
+  std::mutex d_terminator_mutex;
+
+  /** Protects the following members. */
+  std::mutex d_mutex;
+  /** Notifies workers about the start of a round. */
+  std::condition_variable d_start;
+  /** Notifies solve() about finished instances. */
+  std::condition_variable d_finished;
+  /** The current solving round, incremented on each solve() call. */
+  uint64_t d_round = 0;
+  /** The number of instances that finished the current round. */
+  size_t d_num_finished = 0;
+  /** True if worker threads should exit. */
+  bool d_shutdown = false;
+  /** The result of the current round. */
+  Result d_result = Result::UNKNOWN;
+  /** The index of the instance that determined `d_result`. */
+  size_t d_winner = 0;
+  /** True if an instance found a definitive answer in the current round. */
+  std::atomic<bool> d_done = false;
+
+  /** The cubes of the current round, nullptr if not in cube mode. */
+  const std::vector<std::vector<int32_t>> *d_cubes = nullptr;
+  /** The index of the next cube to solve. */
+  std::atomic<size_t> d_next_cube = 0;
+  /** The results of the cubes of the last solve_cubes() call. */
+  std::vector<CubeResult> d_cube_results;
+  /** The failed assumptions of unsatisfiable cubes, per instance. */
+  std::vector<std::vector<int32_t>> d_cube_failed;
+  /**
+   * The union of the failed assumptions of all cubes if the last call was a
+   * solve_cubes() call that returned UNSAT.
+   */
+  std::unordered_set<int32_t> d_failed;
+  /** True if the last call was solve_cubes(). */
+  bool d_cube_mode = false;
+
+  /** True if learned clauses are shared between instances. */
+  bool d_share;
+  /** The maximum variable added, only maintained if sharing is enabled. */
+  int32_t d_max_var = 0;
+  /**
+   * Maps variable to true if it is observed by the external propagators of
+   * all instances. Only modified outside of solve().
+   */
+  std::vector<bool> d_observed;
+  /** The clause buffers, one per instance. */
+  std::vector<std::unique_ptr<ClauseBuffer>> d_buffers;
+  /** The clause exchanges, one per instance. */
+  std::vector<std::unique_ptr<ClauseExchange>> d_exchanges;
+
+  Statistics d_statistics;
+};
+
+}  // namespace bzla::sat
+#endif
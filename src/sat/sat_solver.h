@@ -15,6 +15,7 @@
 
 #include "solver/result.h"
 #include "terminator.h"
+#include "util/span.h"
 
 namespace bzla::sat {
 
@@ -34,6 +35,30 @@ class SatSolver
    * @param lit The literal to add, 0 to terminate clause..
    */
   virtual void add(int32_t lit) = 0;
+  /**
+   * Add clause.
+   * @param lits The literals of the clause (without terminating 0).
+   */
+  virtual void add_clause(util::Span<int32_t> lits)
+  {
+    for (int32_t lit : lits)
+    {
+      add(lit);
+    }
+    add(0);
+  }
+  /**
+   * Add clauses.
+   * @param clauses The literals of the clauses, each clause is terminated
+   *                by 0.
+   */
+  virtual void add_clauses(util::Span<int32_t> clauses)
+  {
+    for (int32_t lit : clauses)
+    {
+      add(lit);
+    }
+  }
   /**
    * Assume valid (non-zero) literal for next call to 'check_sat'.
    * @param lit The literal to assume.
@@ -56,6 +81,24 @@ class SatSolver
    * @return 1 if it is implied, -1 if it is not implied and 0 if unknown.
    */
   virtual int32_t fixed(int32_t lit) = 0;
+  /**
+   * Freeze variable of valid non-zero literal, i.e., prevent the solver from
+   * eliminating it.
+   * @param lit The literal to freeze.
+   */
+  virtual void freeze(int32_t lit) { (void) lit; }
+  /**
+   * Melt variable of valid non-zero literal that was frozen via freeze().
+   * @param lit The literal to melt.
+   */
+  virtual void melt(int32_t lit) { (void) lit; }
+  /**
+   * Suggest the polarity of valid non-zero literal as initial phase of its
+   * variable for subsequent solve() calls. Ignored by solvers that do not
+   * support phases.
+   * @param lit The literal to assign true when deciding on its variable.
+   */
+  virtual void phase(int32_t lit) { (void) lit; }
   /**
    * Check satisfiability of current formula.
    * @return The result of the satisfiability check.
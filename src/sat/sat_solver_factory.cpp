@@ -10,16 +10,19 @@
 
 #include "sat/sat_solver_factory.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "sat/cadical.h"
 #include "sat/cryptominisat.h"
 #include "sat/kissat.h"
+#include "sat/portfolio.h"
 
 namespace bzla::sat {
 
 SatSolver*
 new_sat_solver(const option::Options& options)
 {
-  (void) options;
 #ifdef BZLA_USE_KISSAT
   if (options.sat_solver() == option::SatSolver::KISSAT)
   {
@@ -32,6 +35,20 @@ new_sat_solver(const option::Options& options)
     return new CryptoMiniSat(options.nthreads());
   }
 #endif
+  if (options.nthreads() > 1)
+  {
+    // More instances than hardware threads only compete for the same cores.
+    uint64_t num_solvers = std::min<uint64_t>(
+        options.nthreads(),
+        std::max<uint64_t>(std::thread::hardware_concurrency(), 1));
+    return new Portfolio(num_solvers, options.sat_sharing());
+  }
+  if (options.bv_cube_depth() > 0)
+  {
+    // Cube-and-conquer is implemented by Portfolio::solve_cubes(), with a
+    // single instance the cubes are solved sequentially.
+    return new Portfolio(1);
+  }
   return new Cadical();
 }
 
@@ -190,6 +190,7 @@ AigBitblaster::bitblast(const Node& t)
         // We should never reach other kinds.
         default: assert(false); break;
       }
+      d_bitblasted.emplace_back(cur, d_bitblaster.num_aig_nodes());
     }
     visit.pop_back();
   } while (!visit.empty());
@@ -205,10 +206,23 @@ AigBitblaster::bits(const Node& term) const
   return d_bitblaster_cache.at(term);
 }
 
+void
+AigBitblaster::garbage_collect(uint32_t num_nodes)
+{
+  // Terms are added in the order they were bit-blasted, hence only terms at
+  // the end can refer to deleted nodes.
+  while (!d_bitblasted.empty() && d_bitblasted.back().second > num_nodes)
+  {
+    d_bitblaster_cache.erase(d_bitblasted.back().first);
+    d_bitblasted.pop_back();
+  }
+  d_bitblaster.garbage_collect(num_nodes);
+}
+
 uint64_t
-AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
+AigBitblaster::count_aig_ands(const Node& term, AigNodeSet& cache)
 {
-  std::vector<std::reference_wrapper<const bitblast::AigNode>> visit;
+  std::vector<bitblast::AigNode> visit;
   bitblast(term);
   const auto& b = bits(term);
   visit.insert(visit.end(), b.begin(), b.end());
@@ -217,7 +231,7 @@ AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
   uint64_t res = 0;
   do
   {
-    const bitblast::AigNode& cur = visit.back();
+    bitblast::AigNode cur = visit.back();
     visit.pop_back();
 
     if (cache.insert(cur).second)
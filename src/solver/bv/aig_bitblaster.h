@@ -12,19 +12,17 @@
 #define BZLA_SOLVER_BV_AIG_BITBLASTER_H_INCLUDED
 
 #include <unordered_set>
-#include <unordered_map>
 
 #include "bitblast/aig_bitblaster.h"
 #include "node/node.h"
+#include "node/node_map.h"
 
 namespace bzla::bv {
 
 class AigBitblaster
 {
  public:
-  using AigNodeRefSet =
-      std::unordered_set<std::reference_wrapper<const bitblast::AigNode>,
-                         std::hash<bitblast::AigNode>>;
+  using AigNodeSet = std::unordered_set<bitblast::AigNode>;
 
   /** Recursively bit-blast `term`. */
   void bitblast(const Node& term);
@@ -33,11 +31,34 @@ class AigBitblaster
   const bitblast::AigBitblaster::Bits& bits(const Node& term) const;
 
   /** Count number of AIG nodes in term. */
-  uint64_t count_aig_ands(const Node& term, AigNodeRefSet& cache);
+  uint64_t count_aig_ands(const Node& term, AigNodeSet& cache);
+
+  /** Configure the circuit used for bit-blasting multiplication. */
+  void set_mul_encoding(bitblast::MulEncoding enc)
+  {
+    d_bitblaster.set_mul_encoding(enc);
+  }
+
+  /** @return The AIG manager of the bit-blaster. */
+  bitblast::AigManager& aig_manager() { return d_bitblaster.aig_manager(); }
 
   uint64_t num_aig_ands() const { return d_bitblaster.num_aig_ands(); }
   uint64_t num_aig_consts() const { return d_bitblaster.num_aig_consts(); }
   uint64_t num_aig_shared() const { return d_bitblaster.num_aig_shared(); }
+  uint64_t num_aig_deleted() const { return d_bitblaster.num_aig_deleted(); }
+
+  /** @return Statistics of the bit-blaster. */
+  const auto& statistics() const { return d_bitblaster.statistics(); }
+
+  /** @return The number of AIG nodes. */
+  uint32_t num_aig_nodes() const { return d_bitblaster.num_aig_nodes(); }
+
+  /**
+   * Delete all AIG nodes with an id greater than `num_nodes` and remove the
+   * bit-blasted terms that refer to them from the cache.
+   * @see bitblast::AigManager::garbage_collect()
+   */
+  void garbage_collect(uint32_t num_nodes);
 
  private:
   bitblast::AigBitblaster::Bits d_empty;
@@ -45,7 +66,12 @@ class AigBitblaster
   /** AIG bit-blaster. */
   bitblast::AigBitblaster d_bitblaster;
   /** Cached to store bit-blasted terms and their encoded bits. */
-  std::unordered_map<Node, bitblast::AigBitblaster::Bits> d_bitblaster_cache;
+  node::NodeMap<bitblast::AigBitblaster::Bits> d_bitblaster_cache;
+  /**
+   * The bit-blasted terms in the order they were added to the cache, with
+   * the number of AIG nodes after bit-blasting them.
+   */
+  std::vector<std::pair<Node, uint32_t>> d_bitblasted;
 };
 
 }  // namespace bzla::bv
@@ -10,10 +10,15 @@
 
 #include "solver/bv/bv_bitblast_solver.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "bv/bitvector.h"
 #include "env.h"
 #include "node/node_manager.h"
 #include "node/node_utils.h"
+#include "sat/cadical.h"
+#include "sat/portfolio.h"
 #include "sat/sat_solver_factory.h"
 #include "solver/bv/bv_solver.h"
 
@@ -29,6 +34,40 @@ class BvBitblastSolver::BitblastSatSolver : public bitblast::SatInterface
 
   void add(int64_t lit) override { d_solver.add(lit); }
 
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    d_buffer.assign(literals.begin(), literals.end());
+    d_solver.add_clause(d_buffer);
+  }
+
+  void add_clauses(const std::vector<int32_t>& clauses) override
+  {
+    d_solver.add_clauses(clauses);
+  }
+
+  bool value(int64_t lit) override
+  {
+    return d_solver.value(lit) == 1 ? true : false;
+  }
+
+  void freeze(int64_t lit) override { d_solver.freeze(lit); }
+
+  void melt(int64_t lit) override { d_solver.melt(lit); }
+
+ private:
+  sat::SatSolver& d_solver;
+  /** Reusable buffer for passing single clauses to the SAT solver. */
+  std::vector<int32_t> d_buffer;
+};
+
+/** Sat solver wrapper for AIG SAT sweeping. */
+class BvBitblastSolver::FraigSatSolver : public bitblast::FraigSatInterface
+{
+ public:
+  FraigSatSolver(sat::Cadical& solver) : d_solver(solver) {}
+
+  void add(int64_t lit) override { d_solver.add(lit); }
+
   void add_clause(const std::initializer_list<int64_t>& literals) override
   {
     for (int64_t lit : literals)
@@ -38,15 +77,67 @@ class BvBitblastSolver::BitblastSatSolver : public bitblast::SatInterface
     d_solver.add(0);
   }
 
-  bool value(int64_t lit) override
+  bool value(int64_t lit) override { return d_solver.value(lit) == 1; }
+
+  void assume(int64_t lit) override { d_solver.assume(lit); }
+
+  Result solve(uint64_t conflict_limit) override
   {
-    return d_solver.value(lit) == 1 ? true : false;
+    d_solver.set_conflict_limit(static_cast<int32_t>(conflict_limit));
+    switch (d_solver.solve())
+    {
+      case bzla::Result::SAT: return Result::SAT;
+      case bzla::Result::UNSAT: return Result::UNSAT;
+      default: return Result::UNKNOWN;
+    }
   }
 
  private:
-  sat::SatSolver& d_solver;
+  sat::Cadical& d_solver;
 };
 
+/* -------------------------------------------------------------------------- */
+
+namespace {
+
+/**
+ * Collect the inputs of the AIGs rooted at `roots` that were not visited
+ * before.
+ * @param roots The roots of the AIGs to traverse.
+ * @param skip The ids of AIG nodes that are not traversed.
+ * @param visited The ids of the visited AIG nodes, updated.
+ * @param inputs The collected inputs, updated.
+ */
+void
+collect_inputs(const std::vector<bitblast::AigNode>& roots,
+               const std::unordered_set<int64_t>& skip,
+               std::unordered_set<int64_t>& visited,
+               std::vector<bitblast::AigNode>& inputs)
+{
+  std::vector<bitblast::AigNode> visit(roots.begin(), roots.end());
+  while (!visit.empty())
+  {
+    bitblast::AigNode cur = visit.back();
+    visit.pop_back();
+    int64_t id = std::abs(cur.get_id());
+    if (skip.find(id) != skip.end() || !visited.insert(id).second)
+    {
+      continue;
+    }
+    if (cur.is_and())
+    {
+      visit.push_back(cur[0]);
+      visit.push_back(cur[1]);
+    }
+    else if (cur.is_const())
+    {
+      inputs.push_back(cur);
+    }
+  }
+}
+
+}  // namespace
+
 /* --- BvBitblastSolver public ---------------------------------------------- */
 
 BvBitblastSolver::BvBitblastSolver(Env& env, SolverState& state)
@@ -56,11 +147,33 @@ BvBitblastSolver::BvBitblastSolver(Env& env, SolverState& state)
       d_last_result(Result::UNKNOWN),
       d_opt_print_aig(!env.options().write_aiger().empty()
                       || !env.options().write_cnf().empty()),
-      d_stats(env.statistics(), "solver::bv::bitblast::")
+      d_stats(env.statistics(), "solver::bv::bitblast::"),
+      d_gc_backtrack(state.backtrack_mgr(), *this)
 {
+  switch (env.options().bv_mul_encoding())
+  {
+    case option::BvMulEncoding::ARRAY:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::ARRAY);
+      break;
+    case option::BvMulEncoding::WALLACE:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::WALLACE);
+      break;
+    case option::BvMulEncoding::DADDA:
+      d_bitblaster.set_mul_encoding(bitblast::MulEncoding::DADDA);
+      break;
+  }
   d_sat_solver.reset(sat::new_sat_solver(env.options()));
   d_bitblast_sat_solver.reset(new BitblastSatSolver(*d_sat_solver));
-  d_cnf_encoder.reset(new bitblast::AigCnfEncoder(*d_bitblast_sat_solver));
+  d_sat_portfolio = dynamic_cast<sat::Portfolio*>(d_sat_solver.get());
+  d_cnf_encoder.reset(new bitblast::AigCnfEncoder(
+      *d_bitblast_sat_solver, env.options().cnf_polarity()));
+  if (env.options().fraig())
+  {
+    d_fraig_sat_solver.reset(new sat::Cadical());
+    d_fraig_sat_interface.reset(new FraigSatSolver(*d_fraig_sat_solver));
+    d_fraig.reset(new bitblast::AigFraig(d_bitblaster.aig_manager(),
+                                         *d_fraig_sat_interface));
+  }
 }
 
 BvBitblastSolver::~BvBitblastSolver() {}
@@ -70,25 +183,51 @@ BvBitblastSolver::solve()
 {
   d_sat_solver->configure_terminator(d_env.terminator());
 
-  if (!d_assertions.empty())
+  std::vector<bitblast::AigNode> assertion_aigs;
+  for (const Node& assertion : d_assertions)
   {
-    util::Timer timer(d_stats.time_encode);
-    for (const Node& assertion : d_assertions)
-    {
-      const auto& bits = d_bitblaster.bits(assertion);
-      assert(!bits.empty());
-      d_cnf_encoder->encode(bits[0], true);
-    }
-    d_assertions.clear();
+    const auto& bits = d_bitblaster.bits(assertion);
+    assert(!bits.empty());
+    assertion_aigs.push_back(bits[0]);
   }
+  d_assertions.clear();
 
+  d_assumption_aigs.clear();
   for (const Node& assumption : d_assumptions)
   {
     const auto& bits = d_bitblaster.bits(assumption);
     assert(!bits.empty());
+    d_assumption_aigs.push_back(bits[0]);
+  }
+
+  if (d_fraig)
+  {
+    util::Timer timer(d_stats.time_fraig);
+    d_fraig_sat_solver->configure_terminator(d_env.terminator());
+    assertion_aigs    = d_fraig->sweep(assertion_aigs);
+    d_assumption_aigs = d_fraig->sweep(d_assumption_aigs);
+  }
+
+  // Variables encoded within scopes are frozen until their AIG nodes are
+  // garbage collected on pop.
+  d_cnf_encoder->set_freeze(!d_scope_num_nodes.empty());
+
+  if (!assertion_aigs.empty())
+  {
     util::Timer timer(d_stats.time_encode);
-    d_cnf_encoder->encode(bits[0], false);
-    d_sat_solver->assume(bits[0].get_id());
+    for (const bitblast::AigNode& aig : assertion_aigs)
+    {
+      d_cnf_encoder->encode(aig, true);
+    }
+    // Top-level assertions (and their swept AIGs) are permanent.
+    d_gc_num_nodes = d_bitblaster.num_aig_nodes();
+  }
+
+  for (const bitblast::AigNode& aig : d_assumption_aigs)
+  {
+    util::Timer timer(d_stats.time_encode);
+    d_cnf_encoder->encode(aig, bitblast::AigCnfEncoder::POSITIVE);
+    d_sat_solver->assume(d_cnf_encoder->literal(aig));
   }
 
   // Update CNF statistics
@@ -109,8 +248,22 @@ BvBitblastSolver::solve()
     }
   }
 
-  util::Timer timer(d_stats.time_sat);
-  d_last_result = d_sat_solver->solve();
+  if (d_sat_portfolio && d_env.options().bv_cube_depth() > 0)
+  {
+    d_last_result = solve_cubes(assertion_aigs);
+  }
+  else
+  {
+    util::Timer timer(d_stats.time_sat);
+    d_last_result = d_sat_solver->solve();
+  }
+
+  if (d_sat_portfolio)
+  {
+    auto& sat_stats          = d_sat_portfolio->statistics();
+    d_stats.num_sat_exported = sat_stats.num_exported;
+    d_stats.num_sat_imported = sat_stats.num_imported;
+  }
 
   return d_last_result;
 }
@@ -144,6 +297,11 @@ BvBitblastSolver::register_assertion(const Node& assertion,
     }
   }
 
+  if (top_level)
+  {
+    d_gc_num_nodes = d_bitblaster.num_aig_nodes();
+  }
+
   // Update AIG statistics
   update_statistics();
 }
@@ -183,25 +341,193 @@ BvBitblastSolver::unsat_core(std::vector<Node>& core) const
   assert(d_last_result == Result::UNSAT);
   assert(d_env.options().produce_unsat_cores());
 
-  for (const Node& assumption : d_assumptions)
+  assert(d_assumptions.size() == d_assumption_aigs.size());
+  for (size_t i = 0, size = d_assumptions.size(); i < size; ++i)
   {
-    const auto& bits = d_bitblaster.bits(assumption);
-    assert(bits.size() == 1);
-    if (d_sat_solver->failed(bits[0].get_id()))
+    if (d_sat_solver->failed(d_cnf_encoder->literal(d_assumption_aigs[i])))
+    {
+      core.push_back(d_assumptions[i]);
+    }
+  }
+}
+
+void
+BvBitblastSolver::phase(const Node& term, const BitVector& value)
+{
+  const auto& bits = d_bitblaster.bits(term);
+  assert(bits.empty() || bits.size() == value.size());
+  for (size_t i = 0, size = bits.size(); i < size; ++i)
+  {
+    const bitblast::AigNode& bit = bits[i];
+    if (bit.is_true() || bit.is_false() || !d_cnf_encoder->is_encoded(bit))
+    {
+      continue;
+    }
+    int32_t lit = d_cnf_encoder->literal(bit);
+    d_sat_solver->phase(value.bit(size - 1 - i) ? lit : -lit);
+  }
+}
+
+BitVectorDomain
+BvBitblastSolver::fixed_bits(const Node& term)
+{
+  const auto& bits = d_bitblaster.bits(term);
+  uint64_t size    = term.type().is_bool() ? 1 : term.type().bv_size();
+  BitVectorDomain res(size);
+  assert(bits.empty() || bits.size() == size);
+  for (size_t i = 0, n = bits.size(); i < n; ++i)
+  {
+    const bitblast::AigNode& bit = bits[i];
+    if (bit.is_true() || bit.is_false())
+    {
+      res.fix_bit(size - 1 - i, bit.is_true());
+    }
+    else if (d_cnf_encoder->is_encoded(bit))
     {
-      core.push_back(assumption);
+      int32_t fixed = d_sat_solver->fixed(d_cnf_encoder->literal(bit));
+      if (fixed != 0)
+      {
+        res.fix_bit(size - 1 - i, fixed > 0);
+      }
     }
   }
+  return res;
 }
 
 /* --- BvBitblastSolver private --------------------------------------------- */
 
+void
+BvBitblastSolver::push_scope()
+{
+  d_scope_num_nodes.push_back(d_bitblaster.num_aig_nodes());
+}
+
+void
+BvBitblastSolver::pop_scope()
+{
+  assert(!d_scope_num_nodes.empty());
+  uint32_t num_nodes = std::max(d_scope_num_nodes.back(), d_gc_num_nodes);
+  d_scope_num_nodes.pop_back();
+  // AIG printing keeps track of all assertions.
+  if (!d_opt_print_aig && num_nodes < d_bitblaster.num_aig_nodes())
+  {
+    garbage_collect(num_nodes);
+  }
+}
+
+void
+BvBitblastSolver::garbage_collect(uint32_t num_nodes)
+{
+  util::Timer timer(d_stats.time_gc);
+  d_assumption_aigs.clear();
+  // Drop split candidates that are about to be deleted.
+  d_cube_inputs.erase(
+      std::remove_if(d_cube_inputs.begin(),
+                     d_cube_inputs.end(),
+                     [num_nodes](const bitblast::AigNode& aig) {
+                       return std::abs(aig.get_id()) > num_nodes;
+                     }),
+      d_cube_inputs.end());
+  for (auto it = d_cube_visited.begin(); it != d_cube_visited.end();)
+  {
+    it = *it > num_nodes ? d_cube_visited.erase(it) : std::next(it);
+  }
+  d_cnf_encoder->garbage_collect(num_nodes);
+  if (d_fraig)
+  {
+    d_fraig->garbage_collect(num_nodes);
+  }
+  d_bitblaster.garbage_collect(num_nodes);
+  update_statistics();
+}
+
+Result
+BvBitblastSolver::solve_cubes(const std::vector<bitblast::AigNode>& roots)
+{
+  util::Timer timer(d_stats.time_cube);
+
+  // Split on the inputs with the highest fan-out. The inputs of assertions
+  // are accumulated over all checks since assertions encoded in previous
+  // checks still constrain the formula, the inputs of the assumptions are
+  // only added for the current check.
+  collect_inputs(roots, {}, d_cube_visited, d_cube_inputs);
+  std::vector<bitblast::AigNode> inputs(d_cube_inputs);
+  std::unordered_set<int64_t> cache;
+  collect_inputs(d_assumption_aigs, d_cube_visited, cache, inputs);
+
+  size_t depth = std::min<size_t>(d_env.options().bv_cube_depth(),
+                                  inputs.size());
+  if (depth < d_env.options().bv_cube_depth())
+  {
+    ++d_stats.num_cube_depth_reduced;
+    Log(1) << "reduced cube depth from " << d_env.options().bv_cube_depth()
+           << " to " << depth << ", only " << inputs.size()
+           << " split candidates";
+  }
+  std::partial_sort(
+      inputs.begin(),
+      inputs.begin() + depth,
+      inputs.end(),
+      [](const auto& a, const auto& b) {
+        return a.parents() > b.parents()
+               || (a.parents() == b.parents()
+                   && std::abs(a.get_id()) < std::abs(b.get_id()));
+      });
+
+  std::vector<std::vector<int32_t>> cubes(size_t(1) << depth);
+  for (size_t i = 0, size = cubes.size(); i < size; ++i)
+  {
+    for (size_t j = 0; j < depth; ++j)
+    {
+      int32_t lit = d_cnf_encoder->literal(inputs[j]);
+      cubes[i].push_back((i >> j) & 1 ? lit : -lit);
+    }
+  }
+
+  Result res = d_sat_portfolio->solve_cubes(cubes);
+
+  for (const auto& cube : d_sat_portfolio->cube_results())
+  {
+    if (cube.result == Result::UNKNOWN)
+    {
+      continue;
+    }
+    ++d_stats.num_cubes;
+    if (cube.result == Result::UNSAT)
+    {
+      ++d_stats.num_cubes_unsat;
+    }
+    d_stats.cube_max_time = std::max(d_stats.cube_max_time, cube.time_ms);
+    // Bucket i contains cubes solved in [2^(i-1), 2^i) milliseconds.
+    uint64_t bucket = 0;
+    for (uint64_t t = cube.time_ms; t > 0; t >>= 1)
+    {
+      ++bucket;
+    }
+    d_stats.cube_time << bucket;
+  }
+  return res;
+}
+
 void
 BvBitblastSolver::update_statistics()
 {
-  d_stats.num_aig_ands     = d_bitblaster.num_aig_ands();
-  d_stats.num_aig_consts   = d_bitblaster.num_aig_consts();
-  d_stats.num_aig_shared   = d_bitblaster.num_aig_shared();
+  d_stats.num_aig_ands       = d_bitblaster.num_aig_ands();
+  d_stats.num_aig_consts     = d_bitblaster.num_aig_consts();
+  d_stats.num_aig_shared     = d_bitblaster.num_aig_shared();
+  d_stats.num_aig_deleted    = d_bitblaster.num_aig_deleted();
+  auto& bb_stats             = d_bitblaster.statistics();
+  d_stats.num_div_circuits   = bb_stats.num_div_circuits;
+  d_stats.num_div_reused     = bb_stats.num_div_reused;
+  d_stats.num_div_saved_ands = bb_stats.num_div_saved;
+  if (d_fraig)
+  {
+    auto& fraig_stats            = d_fraig->statistics();
+    d_stats.num_fraig_merged     = fraig_stats.num_merged;
+    d_stats.num_fraig_sat_checks = fraig_stats.num_sat_checks;
+    d_stats.num_fraig_cex        = fraig_stats.num_cex;
+    d_stats.num_fraig_unknown    = fraig_stats.num_unknown;
+  }
   auto& cnf_stats          = d_cnf_encoder->statistics();
   d_stats.num_cnf_vars     = cnf_stats.num_vars;
   d_stats.num_cnf_clauses  = cnf_stats.num_clauses;
@@ -216,12 +542,38 @@ BvBitblastSolver::Statistics::Statistics(util::Statistics& stats,
           stats.new_stat<util::TimerStatistic>(prefix + "aig::time_bitblast")),
       time_encode(
           stats.new_stat<util::TimerStatistic>(prefix + "cnf::time_encode")),
+      time_fraig(
+          stats.new_stat<util::TimerStatistic>(prefix + "fraig::time_sweep")),
+      time_gc(stats.new_stat<util::TimerStatistic>(prefix + "aig::time_gc")),
       num_aig_ands(stats.new_stat<uint64_t>(prefix + "aig::num_ands")),
       num_aig_consts(stats.new_stat<uint64_t>(prefix + "aig::num_consts")),
       num_aig_shared(stats.new_stat<uint64_t>(prefix + "aig::num_shared")),
+      num_aig_deleted(stats.new_stat<uint64_t>(prefix + "aig::num_deleted")),
+      num_div_circuits(
+          stats.new_stat<uint64_t>(prefix + "aig::div::num_circuits")),
+      num_div_reused(stats.new_stat<uint64_t>(prefix + "aig::div::num_reused")),
+      num_div_saved_ands(
+          stats.new_stat<uint64_t>(prefix + "aig::div::num_saved_ands")),
+      num_fraig_merged(stats.new_stat<uint64_t>(prefix + "fraig::num_merged")),
+      num_fraig_sat_checks(
+          stats.new_stat<uint64_t>(prefix + "fraig::num_sat_checks")),
+      num_fraig_cex(stats.new_stat<uint64_t>(prefix + "fraig::num_cex")),
+      num_fraig_unknown(
+          stats.new_stat<uint64_t>(prefix + "fraig::num_unknown")),
       num_cnf_vars(stats.new_stat<uint64_t>(prefix + "cnf::num_vars")),
       num_cnf_clauses(stats.new_stat<uint64_t>(prefix + "cnf::num_clauses")),
-      num_cnf_literals(stats.new_stat<uint64_t>(prefix + "cnf::num_literals"))
+      num_cnf_literals(stats.new_stat<uint64_t>(prefix + "cnf::num_literals")),
+      num_sat_exported(stats.new_stat<uint64_t>(prefix + "sat::num_exported")),
+      num_sat_imported(stats.new_stat<uint64_t>(prefix + "sat::num_imported")),
+      time_cube(
+          stats.new_stat<util::TimerStatistic>(prefix + "cube::time_solve")),
+      num_cubes(stats.new_stat<uint64_t>(prefix + "cube::num_solved")),
+      num_cubes_unsat(stats.new_stat<uint64_t>(prefix + "cube::num_unsat")),
+      cube_max_time(stats.new_stat<uint64_t>(prefix + "cube::max_time_ms")),
+      num_cube_depth_reduced(
+          stats.new_stat<uint64_t>(prefix + "cube::num_depth_reduced")),
+      cube_time(stats.new_stat<util::HistogramStatistic>(
+          prefix + "cube::time_ms_log2"))
 {
 }
 
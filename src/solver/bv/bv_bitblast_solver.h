@@ -11,15 +11,25 @@
 #ifndef BZLA_SOLVER_BV_BV_BITBLAST_SOLVER_H_INCLUDED
 #define BZLA_SOLVER_BV_BV_BITBLAST_SOLVER_H_INCLUDED
 
+#include <unordered_set>
+
+#include "backtrack/backtrackable.h"
 #include "backtrack/vector.h"
 #include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig/aig_fraig.h"
 #include "bitblast/aig/aig_printer.h"
+#include "bv/domain/bitvector_domain.h"
 #include "sat/sat_solver.h"
 #include "solver/bv/aig_bitblaster.h"
 #include "solver/bv/bv_solver_interface.h"
 #include "solver/solver.h"
 #include "util/statistics.h"
 
+namespace bzla::sat {
+class Cadical;
+class Portfolio;
+}
+
 namespace bzla::bv {
 
 class BvSolver;
@@ -42,6 +52,24 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Get unsat core of last solve() call. */
   void unsat_core(std::vector<Node>& core) const override;
 
+  /**
+   * Use given value of bit-blasted leaf node as phases of the SAT variables
+   * of its bits in subsequent solve() calls. Bits that are not encoded yet
+   * are ignored.
+   * @param term  The leaf node.
+   * @param value The value of `term`, a bit-vector of size 1 for Booleans.
+   */
+  void phase(const Node& term, const BitVector& value);
+
+  /**
+   * Get the bits of a bit-blasted leaf node that are fixed by the SAT solver,
+   * i.e., implied by the top-level assertions.
+   * @note Must not be called while solving.
+   * @param term The leaf node.
+   * @return The domain of `term` with the fixed bits fixed.
+   */
+  BitVectorDomain fixed_bits(const Node& term);
+
   /** Get AIG bit-blaster instance. */
   AigBitblaster& bitblaster() { return d_bitblaster; }
 
@@ -52,8 +80,44 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Update AIG and CNF statistics. */
   void update_statistics();
 
+  /**
+   * Check satisfiability of the encoded formula via cube-and-conquer on the
+   * SAT portfolio. The split variables are selected from the inputs of all
+   * encoded assertions and the assumptions of the current check.
+   * @param roots The AIGs of the assertions encoded in the current check.
+   * @return The result of the check.
+   */
+  Result solve_cubes(const std::vector<bitblast::AigNode>& roots);
+
+  /** Notifies the solver about push()/pop() to garbage collect AIG nodes. */
+  class GcBacktrack : public backtrack::Backtrackable
+  {
+   public:
+    GcBacktrack(backtrack::BacktrackManager* mgr, BvBitblastSolver& solver)
+        : Backtrackable(mgr), d_solver(solver)
+    {
+    }
+    void push() override { d_solver.push_scope(); }
+    void pop() override { d_solver.pop_scope(); }
+
+   private:
+    BvBitblastSolver& d_solver;
+  };
+
+  /** Record the number of AIG nodes at the start of the new scope. */
+  void push_scope();
+  /** Garbage collect the AIG nodes only reachable from the popped scope. */
+  void pop_scope();
+  /**
+   * Delete all AIG nodes with an id greater than `num_nodes` from the
+   * bit-blaster, CNF encoder and SAT sweeper.
+   */
+  void garbage_collect(uint32_t num_nodes);
+
   /** Sat interface used for d_cnf_encoder. */
   class BitblastSatSolver;
+  /** Sat interface used for d_fraig. */
+  class FraigSatSolver;
 
   /** The current set of assertions. */
   backtrack::vector<Node> d_assertions;
@@ -69,9 +133,33 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   std::unique_ptr<sat::SatSolver> d_sat_solver;
   /** SAT solver interface for CNF encoder, which wraps `d_sat_solver`. */
   std::unique_ptr<BitblastSatSolver> d_bitblast_sat_solver;
+  /** `d_sat_solver` if it is a parallel portfolio, else nullptr. */
+  sat::Portfolio* d_sat_portfolio = nullptr;
+  /** The swept AIGs of the assumptions of the last solve() call. */
+  std::vector<bitblast::AigNode> d_assumption_aigs;
+  /** The inputs of all encoded assertions, the cube split candidates. */
+  std::vector<bitblast::AigNode> d_cube_inputs;
+  /** The ids of the AIG nodes visited while collecting `d_cube_inputs`. */
+  std::unordered_set<int64_t> d_cube_visited;
+
+  /** SAT solver used for proving equivalences during SAT sweeping. */
+  std::unique_ptr<sat::Cadical> d_fraig_sat_solver;
+  /** SAT solver interface for d_fraig, which wraps `d_fraig_sat_solver`. */
+  std::unique_ptr<FraigSatSolver> d_fraig_sat_interface;
+  /** SAT sweeper, only initialized if option fraig is enabled. */
+  std::unique_ptr<bitblast::AigFraig> d_fraig;
+
   /** Result of last solve() call. */
   Result d_last_result;
 
+  /** The number of AIG nodes at the time each scope was pushed. */
+  std::vector<uint32_t> d_scope_num_nodes;
+  /**
+   * AIG nodes with an id up to this number may be referenced by permanent
+   * (top-level) assertions and are never garbage collected.
+   */
+  uint32_t d_gc_num_nodes = 0;
+
   /** Option to print AIGER/CNF to file. */
   bool d_opt_print_aig;
   bitblast::aig::AigPrinter d_aig_printer;
@@ -82,13 +170,34 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
     util::TimerStatistic& time_sat;
     util::TimerStatistic& time_bitblast;
     util::TimerStatistic& time_encode;
+    util::TimerStatistic& time_fraig;
+    util::TimerStatistic& time_gc;
     uint64_t& num_aig_ands;
     uint64_t& num_aig_consts;
     uint64_t& num_aig_shared;
+    uint64_t& num_aig_deleted;
+    uint64_t& num_div_circuits;
+    uint64_t& num_div_reused;
+    uint64_t& num_div_saved_ands;
+    uint64_t& num_fraig_merged;
+    uint64_t& num_fraig_sat_checks;
+    uint64_t& num_fraig_cex;
+    uint64_t& num_fraig_unknown;
     uint64_t& num_cnf_vars;
     uint64_t& num_cnf_clauses;
     uint64_t& num_cnf_literals;
+    uint64_t& num_sat_exported;
+    uint64_t& num_sat_imported;
+    util::TimerStatistic& time_cube;
+    uint64_t& num_cubes;
+    uint64_t& num_cubes_unsat;
+    uint64_t& cube_max_time;
+    uint64_t& num_cube_depth_reduced;
+    util::HistogramStatistic& cube_time;
   } d_stats;
+
+  /** Backtrackable to be notified about push()/pop(). */
+  GcBacktrack d_gc_backtrack;
 };
 
 }  // namespace bzla::bv
@@ -55,8 +55,7 @@ BvPropSolver::BvPropSolver(Env& env,
 
   d_ls->d_options.prob_pick_ess_input =
       1000 - options.prop_prob_pick_random_input();
-
-  d_ls->init();
+  d_ls->d_options.num_move_candidates = options.prop_move_candidates();
 
   d_ls_backtrack.d_ls = d_ls.get();
 
@@ -68,6 +67,12 @@ BvPropSolver::~BvPropSolver() {}
 
 Result
 BvPropSolver::solve()
+{
+  return solve(1);
+}
+
+Result
+BvPropSolver::solve(uint64_t limit_factor)
 {
   util::Timer timer(d_stats.time_check);
 
@@ -76,8 +81,8 @@ BvPropSolver::solve()
   Result sat_result = Result::UNKNOWN;
 
   uint32_t verbosity = d_env.options().verbosity();
-  uint64_t nprops    = d_env.options().prop_nprops();
-  uint64_t nupdates  = d_env.options().prop_nupdates();
+  uint64_t nprops    = d_env.options().prop_nprops() * limit_factor;
+  uint64_t nupdates  = d_env.options().prop_nupdates() * limit_factor;
 
   uint32_t progress_steps     = 100;
   uint32_t progress_steps_inc = progress_steps * 10;
@@ -140,6 +145,45 @@ DONE:
   return sat_result;
 }
 
+void
+BvPropSolver::import_fixed_bits()
+{
+  for (const auto& [node, id] : d_node_map)
+  {
+    if (node.is_value() || !BvSolver::is_leaf(node))
+    {
+      continue;
+    }
+    BitVectorDomain fixed = d_bb_solver.fixed_bits(node);
+    if (!fixed.has_fixed_bits())
+    {
+      continue;
+    }
+    const BitVectorDomain& domain = d_ls->get_domain(id);
+    for (uint64_t i = 0, size = fixed.size(); i < size; ++i)
+    {
+      if (fixed.is_fixed_bit(i) && !domain.is_fixed_bit(i))
+      {
+        d_ls->fix_leaf_bit(id, i, fixed.is_fixed_bit_true(i));
+        d_stats.num_bits_imported += 1;
+      }
+    }
+  }
+}
+
+void
+BvPropSolver::export_phases()
+{
+  for (const auto& [node, id] : d_node_map)
+  {
+    if (node.is_value() || !BvSolver::is_leaf(node))
+    {
+      continue;
+    }
+    d_bb_solver.phase(node, d_ls->get_assignment(id));
+  }
+}
+
 void
 BvPropSolver::register_assertion(const Node& assertion,
                                  bool top_level,
@@ -469,6 +513,8 @@ BvPropSolver::Statistics::Statistics(util::Statistics& stats,
       num_assertions(stats.new_stat<uint64_t>(prefix + "num_assertions")),
       num_bits_fixed(stats.new_stat<uint64_t>(prefix + "num_bits_fixed")),
       num_bits_total(stats.new_stat<uint64_t>(prefix + "num_bits_total")),
+      num_bits_imported(
+          stats.new_stat<uint64_t>(prefix + "num_bits_imported")),
       time_mk_node(
           stats.new_stat<util::TimerStatistic>(prefix + "time_mk_node")),
       time_check(stats.new_stat<util::TimerStatistic>(prefix + "time_check"))
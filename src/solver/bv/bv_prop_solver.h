@@ -31,6 +31,29 @@ class BvPropSolver : public Solver, public BvSolverInterface
 
   Result solve() override;
 
+  /**
+   * Check satisfiability with the propagation and update limits configured
+   * via options multiplied by given factor.
+   * @param limit_factor The factor to scale the limits with.
+   * @return The result of the check, UNKNOWN if a limit was reached or the
+   *         check was terminated.
+   */
+  Result solve(uint64_t limit_factor);
+
+  /**
+   * Fix the bits of the inputs that are fixed by the SAT solver of the
+   * bit-blasting solver.
+   * @note Must not be called while solving.
+   */
+  void import_fixed_bits();
+
+  /**
+   * Use the current assignment of the inputs as phases of the SAT solver of
+   * the bit-blasting solver.
+   * @note Must not be called while solving.
+   */
+  void export_phases();
+
   void register_assertion(const Node& assertion,
                           bool top_level,
                           bool is_lemma) override;
@@ -93,6 +116,7 @@ class BvPropSolver : public Solver, public BvSolverInterface
     uint64_t& num_assertions;
     uint64_t& num_bits_fixed;
     uint64_t& num_bits_total;
+    uint64_t& num_bits_imported;
     util::TimerStatistic& time_mk_node;
     util::TimerStatistic& time_check;
   } d_stats;
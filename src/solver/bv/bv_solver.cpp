@@ -10,13 +10,65 @@
 
 #include "solver/bv/bv_solver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 #include "env.h"
 #include "solver/bv/bv_bitblast_solver.h"
+#include "terminator.h"
 
 namespace bzla::bv {
 
 using namespace bzla::node;
 
+namespace {
+
+/**
+ * Terminator used while local search and bit-blasting run concurrently.
+ * Terminates both if a solver stopped the current round, or if the
+ * terminator of the environment requests termination.
+ */
+class AsyncTerminator : public Terminator
+{
+ public:
+  AsyncTerminator(Terminator* terminator) : d_terminator(terminator) {}
+
+  bool terminate() override
+  {
+    if (d_stop.load(std::memory_order_relaxed))
+    {
+      return true;
+    }
+    if (d_terminator == nullptr)
+    {
+      return false;
+    }
+    // The terminator of the environment is not thread-safe.
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_terminator->terminate())
+    {
+      d_terminated = true;
+      d_stop       = true;
+    }
+    return d_stop;
+  }
+
+  /** True to stop the solvers of the current round. */
+  std::atomic<bool> d_stop = false;
+  /** True if the terminator of the environment requested termination. */
+  std::atomic<bool> d_terminated = false;
+
+ private:
+  /** The terminator of the environment. */
+  Terminator* d_terminator;
+  /** Serializes calls to `d_terminator`. */
+  std::mutex d_mutex;
+};
+
+}  // namespace
+
 /* --- BvSolver public ------------------------------------------------------ */
 
 bool
@@ -102,6 +154,11 @@ BvSolver::solve()
       d_sat_state = d_prop_solver->solve();
       break;
     case option::BvSolver::PREPROP:
+      if (d_env.options().prop_async())
+      {
+        d_sat_state = solve_async();
+        break;
+      }
       d_cur_solver = option::BvSolver::PROP;
       d_sat_state  = d_prop_solver->solve();
       if (d_sat_state == Result::UNKNOWN)
@@ -144,9 +201,69 @@ BvSolver::unsat_core(std::vector<Node>& core) const
 
 /* --- BvSolver private ----------------------------------------------------- */
 
+Result
+BvSolver::solve_async()
+{
+  Terminator* terminator = d_env.terminator();
+  AsyncTerminator async_terminator(terminator);
+  d_env.configure_terminator(&async_terminator);
+
+  bool phase_hints = d_env.options().prop_phase_hints();
+  Result res       = Result::UNKNOWN;
+  for (uint32_t round = 0;; ++round)
+  {
+    ++d_stats.num_async_rounds;
+    async_terminator.d_stop = false;
+
+    std::atomic<bool> prop_done = false;
+    Result prop_res             = Result::UNKNOWN;
+    std::thread prop_thread([&]() {
+      prop_res = d_prop_solver->solve(uint64_t(1) << std::min(round, 20u));
+      // Local search determined a result or reached its limits.
+      prop_done               = true;
+      async_terminator.d_stop = true;
+    });
+    Result bb_res = d_bitblast_solver.solve();
+    // The bit-blasting solver was not interrupted by local search.
+    bool bb_done            = !prop_done;
+    async_terminator.d_stop = true;
+    prop_thread.join();
+
+    if (bb_res != Result::UNKNOWN)
+    {
+      d_cur_solver = option::BvSolver::BITBLAST;
+      res          = bb_res;
+      break;
+    }
+    if (prop_res != Result::UNKNOWN)
+    {
+      ++d_stats.num_async_prop_wins;
+      d_cur_solver = option::BvSolver::PROP;
+      res          = prop_res;
+      break;
+    }
+    if (bb_done || async_terminator.d_terminated)
+    {
+      break;
+    }
+    d_prop_solver->import_fixed_bits();
+    if (phase_hints)
+    {
+      d_prop_solver->export_phases();
+    }
+  }
+
+  d_env.configure_terminator(terminator);
+  return res;
+}
+
 BvSolver::Statistics::Statistics(util::Statistics& stats)
     : num_checks(stats.new_stat<uint64_t>("solver::bv::num_checks")),
       num_assertions(stats.new_stat<uint64_t>("solver::bv::num_assertions")),
+      num_async_rounds(
+          stats.new_stat<uint64_t>("solver::bv::async::num_rounds")),
+      num_async_prop_wins(
+          stats.new_stat<uint64_t>("solver::bv::async::num_prop_wins")),
       time_check(stats.new_stat<util::TimerStatistic>("solver::bv::time_check"))
 {
 }
@@ -59,6 +59,18 @@ class BvSolver : public Solver, public BvSolverInterface
   option::BvSolver cur_solver() const { return d_cur_solver; }
 
  private:
+  /**
+   * Check satisfiability in preprop mode by running local search on a
+   * separate thread concurrently with the bit-blasting solver. The first
+   * definitive result terminates the other solver. Whenever local search
+   * reaches its limits, the bit-blasting solver is interrupted to import
+   * its fixed input bits into local search (and optionally export the
+   * local search assignment as phases), and both continue with local search
+   * limits doubled.
+   * @return The result of the check.
+   */
+  Result solve_async();
+
   /** Result of the last check() call. */
   Result d_sat_state = Result::UNKNOWN;
 
@@ -83,6 +95,8 @@ class BvSolver : public Solver, public BvSolverInterface
     Statistics(util::Statistics& stats);
     uint64_t& num_checks;
     uint64_t& num_assertions;
+    uint64_t& num_async_rounds;
+    uint64_t& num_async_prop_wins;
     util::TimerStatistic& time_check;
   } d_stats;
 };
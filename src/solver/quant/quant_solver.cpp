@@ -174,6 +174,13 @@ QuantSolver::substitute(const Node& n,
 
     if (inserted)
     {
+      // Only variables are substituted, skip subtrees without variables.
+      if (!cur.node_info().variable)
+      {
+        it->second = cur;
+        visit.pop_back();
+        continue;
+      }
       visit.insert(visit.end(), cur.begin(), cur.end());
       continue;
     }
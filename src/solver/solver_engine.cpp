@@ -163,6 +163,43 @@ SolverEngine::value(const Node& term)
   return _value(term);
 }
 
+std::vector<Node>
+SolverEngine::values(const std::vector<Node>& terms)
+{
+  assert(d_sat_state == Result::SAT);
+  assert(!d_in_solving_mode);
+
+  std::vector<Node> res;
+  res.reserve(terms.size());
+  try
+  {
+    node_ref_vector visit(terms.begin(), terms.end());
+    compute_values(visit);
+    for (const Node& term : terms)
+    {
+      res.push_back(cached_value(term));
+    }
+  }
+  catch (const ComputeValueException&)
+  {
+    // Compute the values term by term to determine which terms depend on
+    // unregistered quantifiers.
+    res.clear();
+    for (const Node& term : terms)
+    {
+      try
+      {
+        res.push_back(_value(term));
+      }
+      catch (const ComputeValueException&)
+      {
+        res.emplace_back();
+      }
+    }
+  }
+  return res;
+}
+
 void
 SolverEngine::unsat_core(std::vector<Node>& core) const
 {
@@ -388,10 +425,17 @@ SolverEngine::process_lemmas()
 Node
 SolverEngine::_value(const Node& term)
 {
-  NodeManager& nm = d_env.nm();
   node_ref_vector visit{term};
+  compute_values(visit);
+  return cached_value(term);
+}
 
-  do
+void
+SolverEngine::compute_values(node_ref_vector& visit)
+{
+  NodeManager& nm = d_env.nm();
+
+  while (!visit.empty())
   {
     const Node& cur = visit.back();
 
@@ -648,9 +692,7 @@ SolverEngine::_value(const Node& term)
       cache_value(cur, value);
     }
     visit.pop_back();
-  } while (!visit.empty());
-
-  return cached_value(term);
+  }
 }
 
 void
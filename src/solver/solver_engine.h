@@ -16,6 +16,8 @@
 #include "backtrack/pop_callback.h"
 #include "backtrack/unordered_set.h"
 #include "node/node.h"
+#include "node/node_map.h"
+#include "node/node_ref_vector.h"
 #include "rewrite/rewriter.h"
 #include "solver/array/array_solver.h"
 #include "solver/bv/bv_solver.h"
@@ -66,6 +68,20 @@ class SolverEngine
   /** Get value of given term. Queries corresponding solver for value. */
   Node value(const Node& term);
 
+  /**
+   * Get values of given terms.
+   *
+   * Computes the values of all terms in a single traversal. If a value
+   * cannot be computed since it depends on an unregistered quantifier, the
+   * remaining values are computed term by term.
+   *
+   * @note Only valid if last solve() call returned Result::SAT.
+   *
+   * @return The values of `terms`, a null node for terms whose value depends
+   *         on an unregistered quantifier (see value()).
+   */
+  std::vector<Node> values(const std::vector<Node>& terms);
+
   /** Get unsat core of last solve() call. */
   void unsat_core(std::vector<Node>& core) const;
 
@@ -113,6 +129,12 @@ class SolverEngine
   /** Compute value for given term. */
   Node _value(const Node& term);
 
+  /**
+   * Compute values for the terms on the given visit stack in a single
+   * traversal. Values are stored in the value cache.
+   */
+  void compute_values(node::node_ref_vector& visit);
+
   /** Cache value for given term. */
   void cache_value(const Node& term, const Node& value);
 
@@ -123,7 +145,7 @@ class SolverEngine
   uint64_t d_num_printed_stats = 0;
 
   /** Model value cache for _value(). */
-  std::unordered_map<Node, Node> d_value_cache;
+  node::NodeMap<Node> d_value_cache;
 
   /** Associated solving context. */
   SolvingContext& d_context;
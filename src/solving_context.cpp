@@ -10,13 +10,19 @@
 
 #include "solving_context.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <mutex>
+#include <thread>
 
 #include "check/check_model.h"
 #include "check/check_unsat_core.h"
 #include "node/node.h"
 #include "resource_terminator.h"
 #include "solver/fp/symfpu_nm.h"  // Temporary for setting SymFpuNM
+#include "terminator.h"
 #include "util/exceptions.h"
 #include "util/resources.h"
 
@@ -24,6 +30,127 @@ namespace bzla {
 
 using namespace node;
 
+namespace {
+
+/**
+ * The configurations of the solving contexts in portfolio mode, assigned
+ * round-robin. Each solving context additionally uses a different seed.
+ */
+enum class PortfolioConfig
+{
+  DEFAULT,      // the configuration of the main solving context
+  PROP,         // propagation-based local search
+  PREPROP,      // local search followed by bit-blasting
+  ABSTRACTION,  // abstraction module
+  NUM_CONFIGS,
+};
+
+std::ostream&
+operator<<(std::ostream& out, PortfolioConfig config)
+{
+  switch (config)
+  {
+    case PortfolioConfig::DEFAULT: out << "default"; break;
+    case PortfolioConfig::PROP: out << "prop"; break;
+    case PortfolioConfig::PREPROP: out << "preprop"; break;
+    case PortfolioConfig::ABSTRACTION: out << "abstraction"; break;
+    default: assert(false);
+  }
+  return out;
+}
+
+/** @return The configuration of the `idx`-th solving context. */
+PortfolioConfig
+portfolio_config(uint64_t idx)
+{
+  return static_cast<PortfolioConfig>(
+      idx % static_cast<uint64_t>(PortfolioConfig::NUM_CONFIGS));
+}
+
+/**
+ * @return The number of solving contexts to run in portfolio mode. More
+ *         solving contexts than hardware threads only compete for the same
+ *         cores.
+ */
+uint64_t
+portfolio_size(const option::Options& options)
+{
+  return std::min<uint64_t>(
+      options.portfolio(),
+      std::max<uint64_t>(std::thread::hardware_concurrency(), 1));
+}
+
+/**
+ * Configure the options of the `idx`-th solving context in portfolio mode.
+ * The assertions are already preprocessed by the main solving context and
+ * resource limits are enforced by the terminator of the main solving
+ * context.
+ */
+void
+configure_portfolio(option::Options& options, uint64_t idx)
+{
+  options.portfolio.set(0);
+  // Do not multiply the number of threads with a parallel SAT portfolio per
+  // solving context.
+  options.nthreads.set(1);
+  options.preprocess.set(false);
+  options.time_limit_per.set(0);
+  options.memory_limit.set(0);
+  options.seed.set(options.seed() + idx);
+  switch (portfolio_config(idx))
+  {
+    case PortfolioConfig::PROP:
+      options.set(option::Option::BV_SOLVER, std::string("prop"), true);
+      break;
+    case PortfolioConfig::PREPROP:
+      options.set(option::Option::BV_SOLVER, std::string("preprop"), true);
+      break;
+    case PortfolioConfig::ABSTRACTION: options.abstraction.set(true); break;
+    default: break;
+  }
+}
+
+/**
+ * Terminator shared by the solving contexts in portfolio mode. Terminates if
+ * a solving context already determined the result, or if the terminator of
+ * the main solving context requests termination.
+ */
+class PortfolioTerminator : public Terminator
+{
+ public:
+  PortfolioTerminator(Terminator* terminator) : d_terminator(terminator) {}
+
+  bool terminate() override
+  {
+    if (d_done.load(std::memory_order_relaxed))
+    {
+      return true;
+    }
+    if (d_terminator == nullptr)
+    {
+      return false;
+    }
+    // The terminator of the main solving context is not thread-safe.
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_terminator->terminate())
+    {
+      d_done = true;
+    }
+    return d_done;
+  }
+
+  /** True if all solving contexts should terminate. */
+  std::atomic<bool> d_done = false;
+
+ private:
+  /** The terminator of the main solving context. */
+  Terminator* d_terminator;
+  /** Serializes calls to `d_terminator`. */
+  std::mutex d_mutex;
+};
+
+}  // namespace
+
 /* --- SolvingContext public ----------------------------------------------- */
 
 SolvingContext::SolvingContext(NodeManager& nm,
@@ -41,6 +168,19 @@ SolvingContext::SolvingContext(NodeManager& nm,
       d_stats(d_env.statistics())
 {
   d_have_quantifiers = false;
+  Warn(!d_subsolver && d_env.options().portfolio() > 1
+       && !nm.is_thread_safe())
+      << "portfolio mode requires a thread-safe node manager, solving "
+         "sequentially";
+  option::SatSolver sat_solver = d_env.options().sat_solver();
+  Warn(!d_subsolver && d_env.options().nthreads() > 1
+       && sat_solver == option::SatSolver::KISSAT)
+      << "SAT solver Kissat does not support multiple threads, option "
+         "nthreads only applies to batch solving";
+  Warn(!d_subsolver && d_env.options().bv_cube_depth() > 0
+       && sat_solver != option::SatSolver::CADICAL)
+      << "cube-and-conquer is only supported with SAT solver CaDiCaL, "
+         "ignoring option bv-cube-depth";
 }
 
 SolvingContext::~SolvingContext() {}
@@ -50,6 +190,7 @@ SolvingContext::solve()
 {
   util::Timer timer(d_stats.time_solve);
   fp::SymFpuNM snm(d_env.nm());
+  d_portfolio_winner.reset();
   set_resource_limits();
 #ifndef NDEBUG
   check_no_free_variables();
@@ -60,7 +201,15 @@ SolvingContext::solve()
   {
     try
     {
-      d_sat_state = d_solver_engine.solve();
+      if (!d_subsolver && portfolio_size(d_env.options()) > 1
+          && d_env.nm().is_thread_safe())
+      {
+        d_sat_state = solve_portfolio();
+      }
+      else
+      {
+        d_sat_state = d_solver_engine.solve();
+      }
     }
     catch (const Unsupported& e)
     {
@@ -69,7 +218,9 @@ SolvingContext::solve()
     }
   }
 
+  // In portfolio mode, the winning solving context already ensured its model.
   if (d_sat_state == Result::SAT && d_have_quantifiers.get()
+      && !d_portfolio_winner
       && (options().produce_models() || options().dbg_check_model()))
   {
     ensure_model();
@@ -138,6 +289,10 @@ SolvingContext::get_value(const Node& term)
   fp::SymFpuNM snm(d_env.nm());
   try
   {
+    if (d_portfolio_winner)
+    {
+      return d_portfolio_winner->get_value(d_preprocessor.process(term));
+    }
     return d_solver_engine.value(d_preprocessor.process(term));
   }
   catch (const ComputeValueException& e)
@@ -151,6 +306,83 @@ SolvingContext::get_value(const Node& term)
   }
 }
 
+std::vector<Node>
+SolvingContext::get_values(const std::vector<Node>& terms)
+{
+  assert(d_sat_state == Result::SAT);
+  fp::SymFpuNM snm(d_env.nm());
+  std::vector<Node> processed;
+  processed.reserve(terms.size());
+  for (const Node& term : terms)
+  {
+    processed.push_back(d_preprocessor.process(term));
+  }
+  if (d_portfolio_winner)
+  {
+    return d_portfolio_winner->get_values(processed);
+  }
+  std::vector<Node> res = d_solver_engine.values(processed);
+  for (size_t i = 0, size = res.size(); i < size; ++i)
+  {
+    // Values that depend on unregistered quantifiers cannot be determined
+    // without calling solve() again, we instead return the original term
+    // (see get_value()).
+    if (res[i].is_null())
+    {
+      Log(2) << "encountered unregistered term while computing value: "
+             << terms[i];
+      res[i] = terms[i];
+    }
+  }
+  return res;
+}
+
+std::unique_ptr<SolvingContext>
+SolvingContext::clone()
+{
+  util::Timer timer(d_stats.time_clone);
+  fp::SymFpuNM snm(d_env.nm());
+  NodeManager& nm = d_env.nm();
+  d_portfolio_winner.reset();
+  d_sat_state = Result::UNKNOWN;
+  preprocess();
+
+  std::unique_ptr<SolvingContext> res(
+      new SolvingContext(nm, d_env.options(), "clone", d_subsolver));
+  uint64_t num_assertions = 0;
+  // Copy the preprocessed assertions level by level to preserve the
+  // assertion levels, the clone can pop to lower levels.
+  for (size_t level = 0, num_levels = d_backtrack_mgr.num_levels();
+       level <= num_levels;
+       ++level)
+  {
+    if (level > 0)
+    {
+      res->push();
+    }
+    for (size_t i = d_assertions.begin(level), end = d_assertions.end(level);
+         i < end;
+         ++i)
+    {
+      res->assert_formula(d_assertions[i]);
+      num_assertions += 1;
+    }
+    // Substituted variables do not occur in the preprocessed assertions and
+    // are determined by the copied substitutions. The substitution assertions
+    // are part of the clone's input, i.e., may occur in its unsat cores.
+    for (const Node& assertion :
+         res->d_preprocessor.copy_level(d_preprocessor, level))
+    {
+      res->d_original_assertions.push_back(assertion);
+    }
+  }
+  d_stats.num_clones += 1;
+  d_stats.num_cloned_assertions += num_assertions;
+  Log(1) << "cloned solving context with " << num_assertions
+         << " assertions";
+  return res;
+}
+
 std::vector<Node>
 SolvingContext::get_unsat_core()
 {
@@ -160,6 +392,12 @@ SolvingContext::get_unsat_core()
   {
     core.push_back(d_env.nm().mk_value(false));
   }
+  else if (d_portfolio_winner)
+  {
+    // The core of the winning solving context is in terms of its input
+    // assertions, i.e., the preprocessed assertions of this context.
+    core = d_portfolio_winner->get_unsat_core();
+  }
   else
   {
     d_solver_engine.unsat_core(core);
@@ -173,6 +411,154 @@ SolvingContext::get_unsat_core()
   return res;
 }
 
+std::vector<Result>
+SolvingContext::solve_batch(const std::vector<std::vector<Node>>& assumptions,
+                            const std::vector<Node>& terms,
+                            std::vector<std::vector<Node>>* values,
+                            std::vector<std::vector<Node>>* unsat_assumptions)
+{
+  size_t size = assumptions.size();
+  d_portfolio_winner.reset();
+  d_sat_state = Result::UNKNOWN;
+  d_stats.num_batch_checks += size;
+  if (values)
+  {
+    values->assign(size, {});
+  }
+  if (unsat_assumptions)
+  {
+    unsat_assumptions->assign(size, {});
+  }
+
+  uint64_t nthreads = std::min<uint64_t>(d_env.options().nthreads(), size);
+  Warn(!d_subsolver && nthreads > 1 && !d_env.nm().is_thread_safe())
+      << "parallel batch solving requires a thread-safe node manager, "
+         "solving sequentially";
+  if (d_subsolver || nthreads <= 1 || !d_env.nm().is_thread_safe())
+  {
+    return solve_batch_sequential(
+        assumptions, terms, values, unsat_assumptions);
+  }
+
+  util::Timer timer(d_stats.time_solve);
+  fp::SymFpuNM snm(d_env.nm());
+  std::vector<Result> results(size, Result::UNKNOWN);
+  set_resource_limits();
+  if (preprocess() == Result::UNSAT)
+  {
+    results.assign(size, Result::UNSAT);
+    return results;
+  }
+
+  // Assumptions and terms are processed with respect to the preprocessed
+  // assertions in this thread, the workers do not preprocess.
+  std::vector<Node> assertions;
+  for (size_t i = 0, n = d_assertions.size(); i < n; ++i)
+  {
+    assertions.push_back(d_assertions[i]);
+  }
+  std::vector<std::vector<Node>> processed(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (const Node& assumption : assumptions[i])
+    {
+      processed[i].push_back(d_preprocessor.process(assumption));
+    }
+  }
+  std::vector<Node> processed_terms;
+  if (values)
+  {
+    for (const Node& term : terms)
+    {
+      processed_terms.push_back(d_preprocessor.process(term));
+    }
+  }
+
+  // Resource limits are enforced per check by the workers, only a
+  // user-defined terminator terminates the whole batch.
+  Terminator* main_terminator = d_env.terminator();
+  if (d_resource_terminator && main_terminator == d_resource_terminator.get())
+  {
+    main_terminator = d_resource_terminator->terminator();
+  }
+  PortfolioTerminator terminator(main_terminator);
+  std::atomic<size_t> next = 0;
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::exception_ptr exception;
+
+  Log(1) << "solve batch of " << size << " checks with " << nthreads
+         << " worker solving contexts";
+  for (size_t w = 0; w < nthreads; ++w)
+  {
+    threads.emplace_back([&, w]() {
+      try
+      {
+        option::Options options(d_env.options());
+        options.portfolio.set(0);
+        options.preprocess.set(false);
+        options.nthreads.set(1);
+        SolvingContext ctx(
+            d_env.nm(), options, "batch-" + std::to_string(w), true);
+        ctx.env().configure_terminator(&terminator);
+        for (const Node& assertion : assertions)
+        {
+          ctx.assert_formula(assertion);
+        }
+        for (size_t i = next++; i < size && !terminator.d_done; i = next++)
+        {
+          ctx.push();
+          for (const Node& assumption : processed[i])
+          {
+            ctx.assert_formula(assumption);
+          }
+          results[i] = ctx.solve();
+          if (results[i] == Result::SAT && values)
+          {
+            for (const Node& term : processed_terms)
+            {
+              (*values)[i].push_back(ctx.get_value(term));
+            }
+          }
+          else if (results[i] == Result::UNSAT && unsat_assumptions)
+          {
+            // The core is in terms of the processed assumptions.
+            auto core = ctx.get_unsat_core();
+            std::unordered_set<Node> in_core(core.begin(), core.end());
+            for (size_t j = 0, n = assumptions[i].size(); j < n; ++j)
+            {
+              if (in_core.find(processed[i][j]) != in_core.end())
+              {
+                (*unsat_assumptions)[i].push_back(assumptions[i][j]);
+              }
+            }
+          }
+          ctx.pop();
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!exception)
+        {
+          exception         = std::current_exception();
+          terminator.d_done = true;
+        }
+      }
+    });
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+  d_stats.max_memory = util::maximum_memory_usage();
+  return results;
+}
+
 void
 SolvingContext::push()
 {
@@ -182,6 +568,7 @@ SolvingContext::push()
 void
 SolvingContext::pop()
 {
+  d_portfolio_winner.reset();
   d_backtrack_mgr.pop();
 }
 
@@ -234,6 +621,10 @@ SolvingContext::check_no_free_variables() const
   {
     std::unordered_map<Node, std::unordered_set<Node>> free_vars;
     const Node& assertion = d_assertions[i];
+    if (!assertion.node_info().variable)
+    {
+      continue;
+    }
     visit.push_back(assertion);
     do
     {
@@ -242,7 +633,14 @@ SolvingContext::check_no_free_variables() const
       auto [it, inserted] = cache.emplace(cur, false);
       if (inserted)
       {
-        visit.insert(visit.end(), cur.begin(), cur.end());
+        // Subtrees without variables do not contribute free variables.
+        for (const Node& c : cur)
+        {
+          if (c.node_info().variable)
+          {
+            visit.push_back(c);
+          }
+        }
         continue;
       }
       else if (!it->second)
@@ -349,6 +747,123 @@ SolvingContext::ensure_model()
   }
 }
 
+Result
+SolvingContext::solve_portfolio()
+{
+  uint64_t size = portfolio_size(d_env.options());
+  std::vector<Node> assertions;
+  for (size_t i = 0, n = d_assertions.size(); i < n; ++i)
+  {
+    assertions.push_back(d_assertions[i]);
+  }
+
+  PortfolioTerminator terminator(d_env.terminator());
+  std::vector<std::unique_ptr<SolvingContext>> ctxs(size);
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  Result result = Result::UNKNOWN;
+  size_t winner = 0;
+  std::exception_ptr exception;
+
+  Log(1) << "solve with portfolio of " << size << " solving contexts";
+  for (size_t i = 0; i < size; ++i)
+  {
+    threads.emplace_back([&, i]() {
+      try
+      {
+        option::Options options(d_env.options());
+        configure_portfolio(options, i);
+        ctxs[i].reset(new SolvingContext(
+            d_env.nm(), options, "portfolio-" + std::to_string(i), true));
+        ctxs[i]->env().configure_terminator(&terminator);
+        for (const Node& assertion : assertions)
+        {
+          ctxs[i]->assert_formula(assertion);
+        }
+        Result res = ctxs[i]->solve();
+        if (res != Result::UNKNOWN)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (result == Result::UNKNOWN)
+          {
+            result            = res;
+            winner            = i;
+            terminator.d_done = true;
+          }
+        }
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!exception)
+        {
+          exception = std::current_exception();
+        }
+      }
+    });
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+
+  if (result == Result::UNKNOWN)
+  {
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+    return result;
+  }
+  Log(1) << "portfolio solving context " << winner << " ("
+         << portfolio_config(winner) << ") determined result " << result;
+  d_stats.portfolio_winner << portfolio_config(winner);
+  d_portfolio_winner = std::move(ctxs[winner]);
+  d_portfolio_winner->env().configure_terminator(nullptr);
+  return result;
+}
+
+std::vector<Result>
+SolvingContext::solve_batch_sequential(
+    const std::vector<std::vector<Node>>& assumptions,
+    const std::vector<Node>& terms,
+    std::vector<std::vector<Node>>* values,
+    std::vector<std::vector<Node>>* unsat_assumptions)
+{
+  std::vector<Result> results;
+  for (size_t i = 0, size = assumptions.size(); i < size; ++i)
+  {
+    push();
+    for (const Node& assumption : assumptions[i])
+    {
+      assert_formula(assumption);
+    }
+    results.push_back(solve());
+    if (results[i] == Result::SAT && values)
+    {
+      for (const Node& term : terms)
+      {
+        (*values)[i].push_back(get_value(term));
+      }
+    }
+    else if (results[i] == Result::UNSAT && unsat_assumptions)
+    {
+      auto core = get_unsat_core();
+      std::unordered_set<Node> in_core(core.begin(), core.end());
+      for (const Node& assumption : assumptions[i])
+      {
+        if (in_core.find(assumption) != in_core.end())
+        {
+          (*unsat_assumptions)[i].push_back(assumption);
+        }
+      }
+    }
+    pop();
+  }
+  d_sat_state = Result::UNKNOWN;
+  return results;
+}
+
 void
 SolvingContext::set_resource_limits()
 {
@@ -385,7 +900,16 @@ SolvingContext::Statistics::Statistics(util::Statistics& stats)
       formula_kinds_pre(
           stats.new_stat<util::HistogramStatistic>("formula::pre::node")),
       formula_kinds_post(
-          stats.new_stat<util::HistogramStatistic>("formula::post::node"))
+          stats.new_stat<util::HistogramStatistic>("formula::post::node")),
+      portfolio_winner(stats.new_stat<util::HistogramStatistic>(
+          "solving_context::portfolio::winner")),
+      num_batch_checks(
+          stats.new_stat<uint64_t>("solving_context::batch::num_checks")),
+      num_clones(stats.new_stat<uint64_t>("solving_context::clone::num")),
+      num_cloned_assertions(stats.new_stat<uint64_t>(
+          "solving_context::clone::num_assertions")),
+      time_clone(stats.new_stat<util::TimerStatistic>(
+          "solving_context::clone::time"))
 {
 }
 
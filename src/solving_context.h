@@ -11,6 +11,7 @@
 #ifndef BZLA_SOLVING_CONTEXT_H_INCLUDED
 #define BZLA_SOLVING_CONTEXT_H_INCLUDED
 
+#include <memory>
 #include <vector>
 
 #include "backtrack/assertion_stack.h"
@@ -57,6 +58,63 @@ class SolvingContext
    */
   Node get_value(const Node& term);
 
+  /**
+   * Get the values of `terms`, computed in one pass over all terms.
+   *
+   * @note: Only valid if last solve() call returned Result::SAT.
+   *
+   * @param terms The terms to compute the values for.
+   * @return The values of `terms` in the current model. As for get_value(),
+   *         the term itself is returned if its value depends on an
+   *         unregistered quantifier.
+   */
+  std::vector<Node> get_values(const std::vector<Node>& terms);
+
+  /**
+   * Solve a batch of satisfiability checks under assumptions.
+   *
+   * The current set of assertions is preprocessed once and each set of
+   * assumptions is checked in combination with the preprocessed assertions.
+   * If the node manager is thread-safe and option nthreads is greater than
+   * 1, the checks are distributed among worker solving contexts on separate
+   * threads. Each worker incrementally solves its checks on top of the
+   * preprocessed assertions, i.e., the bit-blasted assertions are shared
+   * between the checks of a worker. Otherwise, the checks are solved
+   * sequentially in this context.
+   *
+   * @note Invalidates the result of the last solve() call.
+   *
+   * @param assumptions       The sets of assumptions.
+   * @param terms             The terms to query values for in each
+   *                          satisfiable check.
+   * @param values            If not null, filled with the values of `terms`
+   *                          per check, empty if the check was not SAT.
+   * @param unsat_assumptions If not null, filled with the unsat assumptions
+   *                          per check, empty if the check was not UNSAT.
+   * @return The results of the checks.
+   */
+  std::vector<Result> solve_batch(
+      const std::vector<std::vector<Node>>& assumptions,
+      const std::vector<Node>& terms,
+      std::vector<std::vector<Node>>* values,
+      std::vector<std::vector<Node>>* unsat_assumptions);
+
+  /**
+   * Create a copy of this solving context.
+   *
+   * The current set of assertions is preprocessed and the clone is
+   * initialized with the preprocessed assertions on their assertion levels
+   * and the active variable substitutions. The copied assertions are not
+   * preprocessed again in the clone. The bit-blasted assertions and the state
+   * of the SAT solver are not copied, the clone bit-blasts the copied
+   * assertions on its first solve() call. The clone shares the node manager
+   * with this context, hence using it on another thread requires a
+   * thread-safe node manager.
+   *
+   * @return The clone.
+   */
+  std::unique_ptr<SolvingContext> clone();
+
   /** @return Unsat core of previous check_sat() call. */
   std::vector<Node> get_unsat_core();
   // bool is_in_unsat_core(const Node& term) const;
@@ -92,6 +150,25 @@ class SolvingContext
 
   void ensure_model();
 
+  /**
+   * Solve the current set of preprocessed assertions with a portfolio of
+   * differently configured solving contexts on separate threads.
+   * The first definitive result terminates all other solving contexts.
+   * @return The result of the first solving context that determined a
+   *         result, UNKNOWN if no solving context determined a result.
+   */
+  Result solve_portfolio();
+
+  /**
+   * Solve a batch of satisfiability checks sequentially in this context.
+   * @see solve_batch()
+   */
+  std::vector<Result> solve_batch_sequential(
+      const std::vector<std::vector<Node>>& assumptions,
+      const std::vector<Node>& terms,
+      std::vector<std::vector<Node>>* values,
+      std::vector<std::vector<Node>>* unsat_assumptions);
+
   /** Set resource terminator. */
   void set_resource_limits();
 
@@ -127,6 +204,13 @@ class SolvingContext
   /** Indicates whether solving context is used as subsolver (e.g. MBQI). */
   bool d_subsolver;
 
+  /**
+   * The solving context that determined the result of the last solve() call
+   * in portfolio mode. Answers model and unsat core queries with respect to
+   * the preprocessed assertions.
+   */
+  std::unique_ptr<SolvingContext> d_portfolio_winner;
+
   struct Statistics
   {
     Statistics(util::Statistics& stats);
@@ -135,6 +219,11 @@ class SolvingContext
     uint64_t& max_memory;
     util::HistogramStatistic& formula_kinds_pre;
     util::HistogramStatistic& formula_kinds_post;
+    util::HistogramStatistic& portfolio_winner;
+    uint64_t& num_batch_checks;
+    uint64_t& num_clones;
+    uint64_t& num_cloned_assertions;
+    util::TimerStatistic& time_clone;
   } d_stats;
 };
 
@@ -86,26 +86,37 @@ TypeDataKeyEqual::operator()(const TypeData* d0, const TypeData* d1) const
 /* --- TypeData public ------------------------------------------------------*/
 
 TypeData::TypeData(TypeManager* mgr, Kind kind, const std::vector<Type>& types)
-    : d_mgr(mgr), d_kind(kind), d_data(types)
+    : d_mgr(mgr),
+      d_kind(kind),
+      d_concurrent(mgr->d_thread_safe),
+      d_data(types)
 {
 }
 
 TypeData::TypeData(TypeManager* mgr, uint64_t size)
-    : d_mgr(mgr), d_kind(Kind::BV), d_data(size)
+    : d_mgr(mgr),
+      d_kind(Kind::BV),
+      d_concurrent(mgr->d_thread_safe),
+      d_data(size)
 {
   assert(size);
 }
 
 TypeData::TypeData(TypeManager* mgr, uint64_t exp_size, uint64_t sig_size)
-    : d_mgr(mgr), d_kind(Kind::FP), d_data(std::make_pair(exp_size, sig_size))
-
+    : d_mgr(mgr),
+      d_kind(Kind::FP),
+      d_concurrent(mgr->d_thread_safe),
+      d_data(std::make_pair(exp_size, sig_size))
 {
   assert(exp_size);
   assert(sig_size);
 }
 
 TypeData::TypeData(TypeManager* mgr, const std::optional<std::string>& symbol)
-    : d_mgr(mgr), d_kind(Kind::UNINTERPRETED), d_data(symbol)
+    : d_mgr(mgr),
+      d_kind(Kind::UNINTERPRETED),
+      d_concurrent(mgr->d_thread_safe),
+      d_data(symbol)
 {
 }
 
@@ -161,15 +172,38 @@ TypeData::get_fp_sig_size() const
 void
 TypeData::inc_ref()
 {
-  ++d_refs;
+  if (d_concurrent)
+  {
+    d_refs.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  d_refs.store(d_refs.load(std::memory_order_relaxed) + 1,
+               std::memory_order_relaxed);
 }
 
 void
 TypeData::dec_ref()
 {
   assert(d_refs > 0);
-  --d_refs;
-  if (d_refs == 0)
+  if (d_concurrent)
+  {
+    // The last reference is released by the type manager while holding its
+    // lock, which synchronizes with lookups in the unique table.
+    uint32_t refs = d_refs.load(std::memory_order_relaxed);
+    while (refs > 1)
+    {
+      if (d_refs.compare_exchange_weak(
+              refs, refs - 1, std::memory_order_acq_rel))
+      {
+        return;
+      }
+    }
+    d_mgr->release(this);
+    return;
+  }
+  uint32_t refs = d_refs.load(std::memory_order_relaxed) - 1;
+  d_refs.store(refs, std::memory_order_relaxed);
+  if (refs == 0)
   {
     d_mgr->garbage_collect(this);
   }
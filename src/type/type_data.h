@@ -12,6 +12,7 @@
 #define BZLA_TYPE_TYPE_DATA_H_INCLUDED
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -116,8 +117,10 @@ class TypeData
   uint64_t d_id = 0;
   /** Type kind. */
   Kind d_kind;
+  /** True if reference counting needs to be thread-safe. */
+  bool d_concurrent;
   /** Reference count. */
-  uint32_t d_refs = 0;
+  std::atomic<uint32_t> d_refs = 0;
 
   /**
    * Variant that either stores the
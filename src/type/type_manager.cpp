@@ -19,6 +19,8 @@ namespace bzla::type {
 
 /* --- TypeManager public -------------------------------------------------- */
 
+TypeManager::TypeManager(bool thread_safe) : d_thread_safe(thread_safe) {}
+
 TypeManager::~TypeManager()
 {
   // Cleanup remaining types without triggering garbage_collect().
@@ -47,25 +49,25 @@ TypeManager::~TypeManager()
 Type
 TypeManager::mk_bool_type()
 {
-  return Type(find_or_create_type(TypeData::Kind::BOOL));
+  return find_or_create_type(TypeData::Kind::BOOL);
 }
 
 Type
 TypeManager::mk_bv_type(uint64_t size)
 {
-  return Type(find_or_create_bv_type(size));
+  return find_or_create_bv_type(size);
 }
 
 Type
 TypeManager::mk_fp_type(uint64_t exp_size, uint64_t sig_size)
 {
-  return Type(find_or_create_fp_type(exp_size, sig_size));
+  return find_or_create_fp_type(exp_size, sig_size);
 }
 
 Type
 TypeManager::mk_rm_type()
 {
-  return Type(find_or_create_type(TypeData::Kind::RM));
+  return find_or_create_type(TypeData::Kind::RM);
 }
 
 Type
@@ -73,7 +75,7 @@ TypeManager::mk_array_type(const Type& index, const Type& elem)
 {
   assert(index.tm() == this);
   assert(elem.tm() == this);
-  return Type(find_or_create_type(TypeData::Kind::ARRAY, {index, elem}));
+  return find_or_create_type(TypeData::Kind::ARRAY, {index, elem});
 }
 
 Type
@@ -81,13 +83,18 @@ TypeManager::mk_fun_type(const std::vector<Type>& types)
 {
   assert(std::all_of(
       types.begin(), types.end(), [this](auto& c) { return c.tm() == this; }));
-  return Type(find_or_create_type(TypeData::Kind::FUN, types));
+  return find_or_create_type(TypeData::Kind::FUN, types);
 }
 
 Type
 TypeManager::mk_uninterpreted_type(const std::optional<std::string>& symbol)
 {
   TypeData* data = new TypeData(this, symbol);
+  std::unique_lock<std::mutex> lock(d_mutex, std::defer_lock);
+  if (d_thread_safe)
+  {
+    lock.lock();
+  }
   init_id(data);
   return data;
 }
@@ -105,9 +112,15 @@ TypeManager::init_id(TypeData* data)
   data->d_id = d_type_id_counter++;
 }
 
-TypeData*
+Type
 TypeManager::find_or_create(TypeData* data)
 {
+  std::unique_lock<std::mutex> lock(d_mutex, std::defer_lock);
+  if (d_thread_safe)
+  {
+    lock.lock();
+  }
+
   auto [it, inserted] = d_unique_types.insert(data);
 
   if (!inserted)  // Type already exists
@@ -121,7 +134,7 @@ TypeManager::find_or_create(TypeData* data)
   return data;
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_type(TypeData::Kind kind,
                                  const std::vector<Type>& types)
 {
@@ -129,14 +142,14 @@ TypeManager::find_or_create_type(TypeData::Kind kind,
   return find_or_create(data);
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_bv_type(uint64_t size)
 {
   TypeData* data = new TypeData(this, size);
   return find_or_create(data);
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size)
 {
   TypeData* data = new TypeData(this, exp_size, sig_size);
@@ -190,4 +203,17 @@ TypeManager::garbage_collect(TypeData* data)
   d_in_gc_mode = false;
 }
 
+void
+TypeManager::release(TypeData* data)
+{
+  assert(d_thread_safe);
+  std::lock_guard<std::mutex> lock(d_mutex);
+  // The type may have been looked up in find_or_create() by another thread
+  // before we acquired the lock.
+  if (data->d_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+  {
+    garbage_collect(data);
+  }
+}
+
 }  // namespace bzla::type
@@ -12,6 +12,7 @@
 #define BZLA_TYPE_TYPE_MANAGER_H_INCLUDED
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_set>
 #include <vector>
@@ -29,6 +30,13 @@ class TypeManager
   friend TypeData;
 
  public:
+  /**
+   * Constructor.
+   *
+   * @param thread_safe True to allow creating types from multiple threads
+   *                    concurrently.
+   */
+  TypeManager(bool thread_safe = false);
   ~TypeManager();
 
   /**
@@ -88,18 +96,24 @@ class TypeManager
   /** Initialize type data. */
   void init_id(TypeData* d);
 
-  /** Helper function to check whether type data already exists. */
-  TypeData* find_or_create(TypeData* d);
+  /**
+   * Helper function to check whether type data already exists.
+   *
+   * @note The reference to the returned type is acquired while holding the
+   *       lock in thread-safe mode, before the type data can be garbage
+   *       collected by another thread.
+   */
+  Type find_or_create(TypeData* d);
 
   /** Find or create new boolean, rounding mode, array, or function type. */
-  TypeData* find_or_create_type(TypeData::Kind kind,
-                                const std::vector<Type>& types = {});
+  Type find_or_create_type(TypeData::Kind kind,
+                           const std::vector<Type>& types = {});
 
   /** Find or create new bit-vector type. */
-  TypeData* find_or_create_bv_type(uint64_t size);
+  Type find_or_create_bv_type(uint64_t size);
 
   /** Find or create new floating-point type. */
-  TypeData* find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size);
+  Type find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size);
 
   /**
    * Garbage collect type data.
@@ -111,6 +125,19 @@ class TypeManager
    */
   void garbage_collect(TypeData* d);
 
+  /**
+   * Release the last reference to type data in thread-safe mode and garbage
+   * collect it if it did not get referenced again in the meantime.
+   *
+   * @param d Type data to release.
+   */
+  void release(TypeData* d);
+
+  /** Indicates whether type manager is thread-safe. */
+  bool d_thread_safe;
+  /** Guards type creation and garbage collection in thread-safe mode. */
+  std::mutex d_mutex;
+
   /** Type id counter. */
   uint64_t d_type_id_counter = 1;
 
@@ -0,0 +1,85 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_SPAN_H_INCLUDED
+#define BZLA_UTIL_SPAN_H_INCLUDED
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+namespace bzla::util {
+
+/**
+ * Non-owning read-only view of a contiguous sequence of objects.
+ *
+ * Minimal replacement for std::span (C++20). Can be implicitly constructed
+ * from vectors, arrays and brace-enclosed initializer lists, which allows
+ * callers to pass a small number of elements without heap allocation.
+ *
+ * @note A span constructed from an initializer list is only valid until the
+ *       end of the full-expression it was created in.
+ */
+template <class T>
+class Span
+{
+ public:
+  using value_type = T;
+  using iterator   = const T*;
+
+  Span() = default;
+  Span(const T* data, size_t size) : d_data(data), d_size(size) {}
+  Span(const std::vector<T>& v) : d_data(v.data()), d_size(v.size()) {}
+// The underlying array of the initializer list intentionally outlives the span
+// only until the end of the full-expression (see note above).
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winit-list-lifetime"
+#endif
+  Span(std::initializer_list<T> l) : d_data(l.begin()), d_size(l.size()) {}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+  template <size_t N>
+  Span(const std::array<T, N>& a) : d_data(a.data()), d_size(N)
+  {
+  }
+
+  /** @return The number of elements. */
+  size_t size() const { return d_size; }
+  /** @return True if span has no elements. */
+  bool empty() const { return d_size == 0; }
+  /** @return Pointer to the first element. */
+  const T* data() const { return d_data; }
+
+  const T& operator[](size_t i) const
+  {
+    assert(i < d_size);
+    return d_data[i];
+  }
+
+  iterator begin() const { return d_data; }
+  iterator end() const { return d_data + d_size; }
+
+  /** @return The elements of this span as vector. */
+  std::vector<T> to_vector() const { return {begin(), end()}; }
+
+ private:
+  /** The first element. */
+  const T* d_data = nullptr;
+  /** The number of elements. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::util
+
+#endif
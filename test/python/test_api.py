@@ -8,6 +8,7 @@
 # information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
 ##
 
+import array
 import pytest
 import os
 import time
@@ -618,6 +619,73 @@ def test_check_sat(tm):
     bitwuzla.check_sat()
 
 
+def test_check_sat_batch():
+    tm = TermManager(True)
+    options = Options()
+    options.set(Option.NTHREADS, 2)
+    options.set(Option.PRODUCE_MODELS, True)
+    options.set(Option.PRODUCE_UNSAT_ASSUMPTIONS, True)
+    bitwuzla = Bitwuzla(tm, options)
+    a = tm.mk_const(tm.mk_bool_sort(), 'a')
+    b = tm.mk_const(tm.mk_bool_sort(), 'b')
+    bitwuzla.assert_formula(tm.mk_term(Kind.OR, [a, b]))
+    na = tm.mk_term(Kind.NOT, [a])
+    nb = tm.mk_term(Kind.NOT, [b])
+    results, values, unsat = bitwuzla.check_sat_batch(
+            [[na], [nb], [na, nb]], [a, b], True)
+    assert results == [Result.SAT, Result.SAT, Result.UNSAT]
+    assert values[0] == [tm.mk_false(), tm.mk_true()]
+    assert values[1] == [tm.mk_true(), tm.mk_false()]
+    assert values[2] == []
+    assert unsat[0] == [] and unsat[1] == []
+    assert set(unsat[2]) == {na, nb}
+    results, values, unsat = bitwuzla.check_sat_batch([[na], [na, nb]])
+    assert results == [Result.SAT, Result.UNSAT]
+    assert values is None and unsat is None
+
+
+def test_clone(tm):
+    options = Options()
+    options.set(Option.PRODUCE_MODELS, True)
+    bitwuzla = Bitwuzla(tm, options)
+    bv8 = tm.mk_bv_sort(8)
+    x = tm.mk_const(bv8, 'x')
+    y = tm.mk_const(bv8, 'y')
+    bitwuzla.assert_formula(tm.mk_term(Kind.EQUAL, [x, tm.mk_bv_one(bv8)]))
+    bitwuzla.assert_formula(tm.mk_term(Kind.BV_ULT, [x, y]))
+    clone = bitwuzla.clone()
+    clone.assert_formula(tm.mk_term(Kind.EQUAL, [y, tm.mk_bv_one(bv8)]))
+    assert clone.check_sat() == Result.UNSAT
+    assert bitwuzla.check_sat() == Result.SAT
+    assert bitwuzla.get_value(x) == tm.mk_bv_one(bv8)
+    assert bitwuzla.statistics()['solving_context::clone::num'] == '1'
+
+
+def test_get_values(tm):
+    options = Options()
+    options.set(Option.PRODUCE_MODELS, True)
+    bitwuzla = Bitwuzla(tm, options)
+    bv8 = tm.mk_bv_sort(8)
+    bv100 = tm.mk_bv_sort(100)
+    x = tm.mk_const(bv8, 'x')
+    y = tm.mk_const(bv100, 'y')
+    with pytest.raises(BitwuzlaException):
+        bitwuzla.get_values([x, y])
+    bitwuzla.assert_formula(
+            tm.mk_term(Kind.EQUAL, [x, tm.mk_bv_value(bv8, 3)]))
+    bitwuzla.assert_formula(
+            tm.mk_term(Kind.EQUAL, [y, tm.mk_bv_value(bv100, 2**70 + 5)]))
+    assert bitwuzla.check_sat() == Result.SAT
+    values = bitwuzla.get_values([x, y])
+    assert values == [bitwuzla.get_value(x), bitwuzla.get_value(y)]
+    assert bitwuzla.get_bv_values([x, y]) == [3, 2**70 + 5]
+    limbs = array.array('Q', [0] * 3)
+    assert bitwuzla.get_bv_values([x, y], limbs) is None
+    assert list(limbs) == [3, 5, 2**6]
+    with pytest.raises(BitwuzlaException):
+        bitwuzla.get_bv_values([x, y], array.array('Q', [0] * 2))
+
+
 def test_get_value(tm):
     bv8 = tm.mk_bv_sort(8)
     bvconst8 = tm.mk_const(bv8)
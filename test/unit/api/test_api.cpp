@@ -15,6 +15,7 @@
 #include <chrono>
 #include <fstream>
 #include <ostream>
+#include <thread>
 
 #include "test/unit/test.h"
 
@@ -3219,6 +3220,51 @@ TEST_F(TestApi, substitute2)
   ASSERT_EQ(terms, expected);
 }
 
+TEST_F(TestApi, snapshot)
+{
+  bitwuzla::Sort bv8   = d_tm.mk_bv_sort(8);
+  bitwuzla::Term x     = d_tm.mk_const(bv8, "x");
+  bitwuzla::Term one   = d_tm.mk_bv_one(bv8);
+  bitwuzla::Term addxo = d_tm.mk_term(bitwuzla::Kind::BV_ADD, {x, one});
+  bitwuzla::Term ult   = d_tm.mk_term(bitwuzla::Kind::BV_ULT, {addxo, x});
+
+  ASSERT_THROW(d_tm.save_snapshot("snapshot.bin", {bitwuzla::Term()}),
+               bitwuzla::Exception);
+  bitwuzla::TermManager tm;
+  ASSERT_THROW(tm.save_snapshot("snapshot.bin", {ult}), bitwuzla::Exception);
+  ASSERT_THROW(tm.load_snapshot("no_such_snapshot.bin"), bitwuzla::Exception);
+
+  std::stringstream ss;
+  d_tm.save_snapshot(ss, {ult, one});
+  auto terms = tm.load_snapshot(ss);
+  ASSERT_EQ(terms.size(), 2);
+  ASSERT_EQ(terms[0].kind(), bitwuzla::Kind::BV_ULT);
+  ASSERT_EQ(terms[0][1].symbol()->get(), "x");
+  ASSERT_EQ(terms[0][0][1], terms[1]);
+  ASSERT_EQ(terms[1].value<std::string>(), "00000001");
+
+  std::stringstream invalid("BZLASNAP");
+  ASSERT_THROW(tm.load_snapshot(invalid), bitwuzla::Exception);
+
+  // Bit-vector value of size 2^40 in a snapshot that only holds a few bytes.
+  std::stringstream ssone;
+  d_tm.save_snapshot(ssone, {one});
+  std::string data = ssone.str();
+  size_t pos       = 9;  // magic and version
+  while (static_cast<uint8_t>(data[pos++]) & 0x80)
+    ;  // number of kinds
+  // Replace size 8 of the only type table entry (number of types, BV tag).
+  ASSERT_EQ(data.substr(pos, 3), std::string({1, 1, 8}));
+  data.replace(pos + 2, 1, "\x80\x80\x80\x80\x80\x20");
+  std::stringstream malformed(data);
+  ASSERT_THROW(tm.load_snapshot(malformed), bitwuzla::Exception);
+
+  bitwuzla::Options options;
+  bitwuzla::Bitwuzla bitwuzla(tm, options);
+  bitwuzla.assert_formula(terms[0]);
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+}
+
 TEST_F(TestApi, term_print1)
 {
   bitwuzla::Term a = d_tm.mk_const(d_bv_sort1, "a");
@@ -4134,6 +4180,13 @@ TEST_F(TestApi, nthreads)
   smt2 << "(check-sat)" << std::endl;
   smt2.close();
 
+  {
+    bitwuzla::Options opts;
+    ASSERT_THROW(opts.set(bitwuzla::Option::NTHREADS, UINT64_C(0)),
+                 bitwuzla::Exception);
+    ASSERT_THROW(opts.set(bitwuzla::Option::NTHREADS, 257),
+                 bitwuzla::Exception);
+  }
   {
     bitwuzla::Options opts;
     opts.set(bitwuzla::Option::SAT_SOLVER, "cadical");
@@ -4159,6 +4212,300 @@ TEST_F(TestApi, nthreads)
 #endif
 }
 
+TEST_F(TestApi, portfolio)
+{
+  {
+    bitwuzla::Options opts;
+    ASSERT_THROW(opts.set(bitwuzla::Option::PORTFOLIO, 257),
+                 bitwuzla::Exception);
+  }
+  bitwuzla::TermManager tm(true);
+  bitwuzla::Options opts;
+  opts.set(bitwuzla::Option::PORTFOLIO, 4);
+  opts.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  opts.set(bitwuzla::Option::PRODUCE_UNSAT_ASSUMPTIONS, true);
+  bitwuzla::Bitwuzla bitwuzla(tm, opts);
+
+  bitwuzla::Sort bv8  = tm.mk_bv_sort(8);
+  bitwuzla::Term x    = tm.mk_const(bv8, "x");
+  bitwuzla::Term y    = tm.mk_const(bv8, "y");
+  bitwuzla::Term zero = tm.mk_bv_zero(bv8);
+  bitwuzla::Term mul  = tm.mk_term(bitwuzla::Kind::BV_MUL, {x, y});
+  bitwuzla.assert_formula(tm.mk_term(
+      bitwuzla::Kind::EQUAL, {mul, tm.mk_bv_value_uint64(bv8, 42)}));
+
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+  uint64_t vx = std::stoull(bitwuzla.get_value(x).value<std::string>(), 0, 2);
+  uint64_t vy = std::stoull(bitwuzla.get_value(y).value<std::string>(), 0, 2);
+  ASSERT_EQ((vx * vy) % 256, 42);
+
+  bitwuzla::Term x_zero = tm.mk_term(bitwuzla::Kind::EQUAL, {x, zero});
+  ASSERT_EQ(bitwuzla.check_sat({x_zero}), bitwuzla::Result::UNSAT);
+  ASSERT_TRUE(bitwuzla.is_unsat_assumption(x_zero));
+
+  auto stats = bitwuzla.statistics();
+  auto it    = stats.lower_bound("solving_context::portfolio::winner::");
+  ASSERT_TRUE(it != stats.end());
+  ASSERT_EQ(it->first.find("solving_context::portfolio::winner::"), 0);
+}
+
+TEST_F(TestApi, check_sat_batch)
+{
+  for (bool thread_safe : {false, true})
+  {
+    bitwuzla::TermManager tm(thread_safe);
+    bitwuzla::Options opts;
+    opts.set(bitwuzla::Option::NTHREADS, 3);
+    opts.set(bitwuzla::Option::PRODUCE_MODELS, true);
+    opts.set(bitwuzla::Option::PRODUCE_UNSAT_ASSUMPTIONS, true);
+    bitwuzla::Bitwuzla bitwuzla(tm, opts);
+
+    bitwuzla::Sort bv8 = tm.mk_bv_sort(8);
+    bitwuzla::Term x   = tm.mk_const(bv8, "x");
+    bitwuzla::Term y   = tm.mk_const(bv8, "y");
+    bitwuzla::Term mul = tm.mk_term(bitwuzla::Kind::BV_MUL, {x, y});
+    bitwuzla.assert_formula(tm.mk_term(
+        bitwuzla::Kind::EQUAL, {mul, tm.mk_bv_value_uint64(bv8, 42)}));
+
+    auto eq = [&](const bitwuzla::Term& t, uint64_t v) {
+      return tm.mk_term(bitwuzla::Kind::EQUAL,
+                        {t, tm.mk_bv_value_uint64(bv8, v)});
+    };
+    std::vector<std::vector<bitwuzla::Term>> assumptions = {
+        {eq(x, 0)},
+        {eq(x, 1)},
+        {eq(x, 2), eq(y, 21)},
+        {eq(x, 2), eq(y, 22)},
+        {},
+    };
+    std::vector<std::vector<bitwuzla::Term>> values, unsat_assumptions;
+    auto results = bitwuzla.check_sat_batch(
+        assumptions, {x, y}, &values, &unsat_assumptions);
+    ASSERT_EQ(results,
+              std::vector<bitwuzla::Result>({bitwuzla::Result::UNSAT,
+                                             bitwuzla::Result::SAT,
+                                             bitwuzla::Result::SAT,
+                                             bitwuzla::Result::UNSAT,
+                                             bitwuzla::Result::SAT}));
+    ASSERT_EQ(values.size(), assumptions.size());
+    ASSERT_EQ(unsat_assumptions.size(), assumptions.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      if (results[i] == bitwuzla::Result::SAT)
+      {
+        ASSERT_EQ(values[i].size(), 2);
+        uint64_t vx = std::stoull(values[i][0].value<std::string>(), 0, 2);
+        uint64_t vy = std::stoull(values[i][1].value<std::string>(), 0, 2);
+        ASSERT_EQ((vx * vy) % 256, 42);
+        ASSERT_TRUE(unsat_assumptions[i].empty());
+      }
+      else
+      {
+        ASSERT_TRUE(values[i].empty());
+      }
+    }
+    ASSERT_EQ(values[1][1].value<std::string>(10), "42");
+    ASSERT_EQ(unsat_assumptions[0], assumptions[0]);
+    ASSERT_EQ(unsat_assumptions[3].size(), 2);
+
+    // The results of batch checks can not be queried.
+    ASSERT_THROW(bitwuzla.get_value(x), bitwuzla::Exception);
+    ASSERT_EQ(bitwuzla.check_sat({eq(x, 1)}), bitwuzla::Result::SAT);
+    ASSERT_EQ(bitwuzla.get_value(y).value<std::string>(10), "42");
+
+    // An unsatisfiable formula is unsatisfiable under all assumptions.
+    bitwuzla.assert_formula(eq(x, 0));
+    results = bitwuzla.check_sat_batch(assumptions);
+    ASSERT_EQ(results,
+              std::vector<bitwuzla::Result>(assumptions.size(),
+                                            bitwuzla::Result::UNSAT));
+  }
+}
+
+TEST_F(TestApi, check_sat_batch_prop)
+{
+  // The local search configuration is per solving context, the concurrent
+  // workers must not interfere with each other.
+  bitwuzla::TermManager tm(true);
+  bitwuzla::Options opts;
+  opts.set(bitwuzla::Option::BV_SOLVER, "prop");
+  opts.set(bitwuzla::Option::NTHREADS, 4);
+  opts.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  bitwuzla::Bitwuzla bitwuzla(tm, opts);
+
+  bitwuzla::Sort bv8 = tm.mk_bv_sort(8);
+  bitwuzla::Term x   = tm.mk_const(bv8, "x");
+  bitwuzla::Term y   = tm.mk_const(bv8, "y");
+  bitwuzla::Term mul = tm.mk_term(bitwuzla::Kind::BV_MUL, {x, y});
+  bitwuzla.assert_formula(tm.mk_term(
+      bitwuzla::Kind::EQUAL, {mul, tm.mk_bv_value_uint64(bv8, 42)}));
+
+  // For odd x, y is uniquely determined.
+  std::vector<std::vector<bitwuzla::Term>> assumptions;
+  for (uint64_t v = 1; v < 32; v += 2)
+  {
+    assumptions.push_back({tm.mk_term(bitwuzla::Kind::EQUAL,
+                                      {x, tm.mk_bv_value_uint64(bv8, v)})});
+  }
+  std::vector<std::vector<bitwuzla::Term>> values;
+  auto results = bitwuzla.check_sat_batch(assumptions, {x, y}, &values);
+  ASSERT_EQ(results,
+            std::vector<bitwuzla::Result>(assumptions.size(),
+                                          bitwuzla::Result::SAT));
+  ASSERT_EQ(values.size(), assumptions.size());
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    ASSERT_EQ(values[i].size(), 2);
+    uint64_t vx = std::stoull(values[i][0].value<std::string>(), 0, 2);
+    uint64_t vy = std::stoull(values[i][1].value<std::string>(), 0, 2);
+    ASSERT_EQ(vx, 2 * i + 1);
+    ASSERT_EQ((vx * vy) % 256, 42);
+  }
+}
+
+TEST_F(TestApi, clone)
+{
+  bitwuzla::TermManager tm(true);
+  bitwuzla::Options opts;
+  opts.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  bitwuzla::Bitwuzla bitwuzla(tm, opts);
+
+  bitwuzla::Sort bv8 = tm.mk_bv_sort(8);
+  bitwuzla::Term x   = tm.mk_const(bv8, "x");
+  bitwuzla::Term y   = tm.mk_const(bv8, "y");
+  bitwuzla::Term z   = tm.mk_const(bv8, "z");
+  bitwuzla::Term one = tm.mk_bv_one(bv8);
+  // x is substituted away by preprocessing.
+  bitwuzla.assert_formula(
+      tm.mk_term(bitwuzla::Kind::EQUAL,
+                 {x, tm.mk_term(bitwuzla::Kind::BV_ADD, {y, one})}));
+  bitwuzla.assert_formula(tm.mk_term(bitwuzla::Kind::BV_ULT, {y, z}));
+  bitwuzla.push(1);
+  bitwuzla.assert_formula(tm.mk_term(bitwuzla::Kind::EQUAL, {z, one}));
+
+  std::unique_ptr<bitwuzla::Bitwuzla> clone = bitwuzla.clone();
+  ASSERT_EQ(bitwuzla.statistics().at("solving_context::clone::num"), "1");
+
+  // The clone is independent of the original instance and can be used on
+  // another thread.
+  bitwuzla::Result res;
+  std::string vx, vy;
+  std::thread t([&]() {
+    res = clone->check_sat();
+    vx  = clone->get_value(x).value<std::string>(10);
+    vy  = clone->get_value(y).value<std::string>(10);
+  });
+  bitwuzla.pop(1);
+  bitwuzla.assert_formula(tm.mk_term(bitwuzla::Kind::EQUAL, {z, y}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::UNSAT);
+  t.join();
+  ASSERT_EQ(res, bitwuzla::Result::SAT);
+  ASSERT_EQ(vx, "1");
+  ASSERT_EQ(vy, "0");
+
+  // The clone preserves the assertion levels.
+  clone->pop(1);
+  ASSERT_THROW(clone->pop(1), bitwuzla::Exception);
+  clone->push(1);
+  clone->assert_formula(tm.mk_term(bitwuzla::Kind::EQUAL, {z, y}));
+  ASSERT_EQ(clone->check_sat(), bitwuzla::Result::UNSAT);
+  clone->pop(1);
+  // The clone preserves the substitution of x.
+  clone->assert_formula(
+      tm.mk_term(bitwuzla::Kind::EQUAL, {y, tm.mk_bv_value_uint64(bv8, 2)}));
+  ASSERT_EQ(clone->check_sat(), bitwuzla::Result::SAT);
+  ASSERT_EQ(clone->get_value(x).value<std::string>(10), "3");
+}
+
+TEST_F(TestApi, clone_unsat_core)
+{
+  bitwuzla::Options opts;
+  opts.set(bitwuzla::Option::PRODUCE_UNSAT_CORES, true);
+  bitwuzla::Bitwuzla bitwuzla(d_tm, opts);
+
+  bitwuzla::Sort bv8  = d_tm.mk_bv_sort(8);
+  bitwuzla::Term x    = d_tm.mk_const(bv8, "x");
+  bitwuzla::Term y    = d_tm.mk_const(bv8, "y");
+  bitwuzla::Term zero = d_tm.mk_bv_zero(bv8);
+  // x is substituted away by preprocessing.
+  bitwuzla.assert_formula(d_tm.mk_term(
+      bitwuzla::Kind::EQUAL,
+      {x, d_tm.mk_term(bitwuzla::Kind::BV_ADD, {y, d_tm.mk_bv_one(bv8)})}));
+
+  std::unique_ptr<bitwuzla::Bitwuzla> clone = bitwuzla.clone();
+  bitwuzla::Term ax = d_tm.mk_term(bitwuzla::Kind::EQUAL, {x, zero});
+  bitwuzla::Term ay = d_tm.mk_term(bitwuzla::Kind::EQUAL, {y, zero});
+  clone->assert_formula(ax);
+  clone->assert_formula(ay);
+  ASSERT_EQ(clone->check_sat(), bitwuzla::Result::UNSAT);
+  // The unsat core contains the substitution assertion of x.
+  std::vector<bitwuzla::Term> core = clone->get_unsat_core();
+  ASSERT_EQ(core.size(), 3);
+  ASSERT_NE(std::find(core.begin(), core.end(), ax), core.end());
+  ASSERT_NE(std::find(core.begin(), core.end(), ay), core.end());
+}
+
+TEST_F(TestApi, get_values)
+{
+  bitwuzla::Options opts;
+  {
+    bitwuzla::Bitwuzla bitwuzla(d_tm, opts);
+    ASSERT_THROW(bitwuzla.get_values({d_bv_const8}), bitwuzla::Exception);
+  }
+  opts.set(bitwuzla::Option::PRODUCE_MODELS, true);
+  bitwuzla::Bitwuzla bitwuzla(d_tm, opts);
+  ASSERT_THROW(bitwuzla.get_values({d_bv_const8}), bitwuzla::Exception);
+
+  bitwuzla::Sort bv8   = d_tm.mk_bv_sort(8);
+  bitwuzla::Sort bv100 = d_tm.mk_bv_sort(100);
+  bitwuzla::Term x     = d_tm.mk_const(bv8, "x");
+  bitwuzla::Term y     = d_tm.mk_const(bv100, "y");
+  bitwuzla::Term add   = d_tm.mk_term(bitwuzla::Kind::BV_ADD, {x, x});
+  bitwuzla::Term yval  = d_tm.mk_bv_value(
+      bv100, "1" + std::string(70, '0') + "101", 2);
+  bitwuzla.assert_formula(d_tm.mk_term(bitwuzla::Kind::EQUAL,
+                                       {x, d_tm.mk_bv_value_uint64(bv8, 3)}));
+  bitwuzla.assert_formula(d_tm.mk_term(bitwuzla::Kind::EQUAL, {y, yval}));
+  ASSERT_EQ(bitwuzla.check_sat(), bitwuzla::Result::SAT);
+
+  std::vector<bitwuzla::Term> terms = {x, add, y, d_true, d_bool_const};
+  std::vector<bitwuzla::Term> values = bitwuzla.get_values(terms);
+  ASSERT_EQ(values.size(), terms.size());
+  for (size_t i = 0; i < terms.size(); ++i)
+  {
+    ASSERT_EQ(values[i], bitwuzla.get_value(terms[i]));
+  }
+  ASSERT_EQ(values[1], d_tm.mk_bv_value_uint64(bv8, 6));
+  ASSERT_EQ(values[2], yval);
+  ASSERT_TRUE(bitwuzla.get_values({}).empty());
+
+  // Values that depend on unregistered quantifiers fall back to the term
+  // itself, as for get_value().
+  bitwuzla::Term z = d_tm.mk_var(bv8, "z");
+  bitwuzla::Term q = d_tm.mk_term(
+      bitwuzla::Kind::FORALL,
+      {z, d_tm.mk_term(bitwuzla::Kind::BV_ULT, {z, x})});
+  bitwuzla::Term ite = d_tm.mk_term(bitwuzla::Kind::ITE, {q, x, add});
+  terms              = {x, ite, add};
+  values             = bitwuzla.get_values(terms);
+  ASSERT_EQ(values.size(), terms.size());
+  for (size_t i = 0; i < terms.size(); ++i)
+  {
+    ASSERT_EQ(values[i], bitwuzla.get_value(terms[i]));
+  }
+
+  std::vector<uint64_t> limbs(4, UINT64_MAX);
+  bitwuzla.get_bv_values({x, y, add}, limbs.data(), limbs.size());
+  ASSERT_EQ(limbs[0], 3);
+  ASSERT_EQ(limbs[1], 5);
+  ASSERT_EQ(limbs[2], UINT64_C(1) << (73 - 64));
+  ASSERT_EQ(limbs[3], 6);
+  ASSERT_THROW(bitwuzla.get_bv_values({x, y, add}, limbs.data(), 3),
+               bitwuzla::Exception);
+  ASSERT_THROW(bitwuzla.get_bv_values({d_bool_const}, limbs.data(), 4),
+               bitwuzla::Exception);
+}
+
 TEST_F(TestApi, fpexp)
 {
   bitwuzla::Term bv1  = d_tm.mk_bv_value(d_tm.mk_bv_sort(1), "1");
@@ -2720,6 +2720,68 @@ TEST_F(TestCApi, check_sat)
   }
 }
 
+TEST_F(TestCApi, clone)
+{
+  ASSERT_DEATH(bitwuzla_clone(nullptr), d_error_not_null);
+  {
+    Bitwuzla *bitwuzla = bitwuzla_new(d_tm, nullptr);
+    bitwuzla_assert(bitwuzla, d_bv_const1_true);
+    Bitwuzla *clone = bitwuzla_clone(bitwuzla);
+    bitwuzla_assert(clone, d_bv_const1_false);
+    ASSERT_EQ(bitwuzla_check_sat(clone), BITWUZLA_UNSAT);
+    ASSERT_EQ(bitwuzla_check_sat(bitwuzla), BITWUZLA_SAT);
+    bitwuzla_delete(bitwuzla);
+    ASSERT_EQ(bitwuzla_check_sat(clone), BITWUZLA_UNSAT);
+    bitwuzla_delete(clone);
+  }
+}
+
+TEST_F(TestCApi, check_sat_batch)
+{
+  std::vector<BitwuzlaTerm> a0{d_bv_const1_true};
+  std::vector<BitwuzlaTerm> a1{d_bv_const1_false};
+  std::vector<BitwuzlaTerm> a2{d_bv_const1_true, d_bv_const1_false};
+  std::vector<uint32_t> argcs{1, 1, 2};
+  std::vector<BitwuzlaTerm *> args{a0.data(), a1.data(), a2.data()};
+  ASSERT_DEATH(bitwuzla_check_sat_batch(nullptr,
+                                        args.size(),
+                                        argcs.data(),
+                                        args.data(),
+                                        0,
+                                        nullptr,
+                                        nullptr,
+                                        nullptr),
+               d_error_not_null);
+  {
+    BitwuzlaOptions *options = bitwuzla_options_new();
+    bitwuzla_set_option(options, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+    bitwuzla_set_option(options, BITWUZLA_OPT_PRODUCE_UNSAT_ASSUMPTIONS, 1);
+    Bitwuzla *bitwuzla = bitwuzla_new(d_tm, options);
+    const BitwuzlaTerm *values;
+    const bool *unsat_assumptions;
+    const BitwuzlaResult *results = bitwuzla_check_sat_batch(bitwuzla,
+                                                             args.size(),
+                                                             argcs.data(),
+                                                             args.data(),
+                                                             1,
+                                                             &d_bv_const1,
+                                                             &values,
+                                                             &unsat_assumptions);
+    ASSERT_EQ(results[0], BITWUZLA_SAT);
+    ASSERT_EQ(results[1], BITWUZLA_SAT);
+    ASSERT_EQ(results[2], BITWUZLA_UNSAT);
+    ASSERT_EQ(values[0], d_bv_one1);
+    ASSERT_EQ(values[1], d_bv_zero1);
+    ASSERT_EQ(values[2], nullptr);
+    ASSERT_FALSE(unsat_assumptions[0]);
+    ASSERT_FALSE(unsat_assumptions[1]);
+    ASSERT_TRUE(unsat_assumptions[2]);
+    ASSERT_TRUE(unsat_assumptions[3]);
+    bitwuzla_delete(bitwuzla);
+    bitwuzla_options_delete(options);
+  }
+}
+
 TEST_F(TestCApi, get_value)
 {
   {
@@ -2859,6 +2921,37 @@ TEST_F(TestCApi, get_rm_value)
 /* Printing                                                                   */
 /* -------------------------------------------------------------------------- */
 
+TEST_F(TestCApi, get_values)
+{
+  BitwuzlaOptions *options = bitwuzla_options_new();
+  bitwuzla_set_option(options, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+  Bitwuzla *bitwuzla = bitwuzla_new(d_tm, options);
+  std::vector<BitwuzlaTerm> terms{d_bv_const1, d_bv_const8};
+  ASSERT_DEATH(bitwuzla_get_values(nullptr, terms.size(), terms.data()),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_get_values(bitwuzla, terms.size(), terms.data()),
+               d_error_sat);
+  bitwuzla_assert(bitwuzla, d_bv_const1_true);
+  ASSERT_EQ(bitwuzla_check_sat(bitwuzla), BITWUZLA_SAT);
+  const BitwuzlaTerm *values =
+      bitwuzla_get_values(bitwuzla, terms.size(), terms.data());
+  ASSERT_EQ(values[0], d_bv_one1);
+  ASSERT_EQ(values[1], bitwuzla_get_value(bitwuzla, d_bv_const8));
+
+  std::vector<uint64_t> limbs(2);
+  bitwuzla_get_bv_values(
+      bitwuzla, terms.size(), terms.data(), limbs.data(), limbs.size());
+  ASSERT_EQ(limbs[0], 1);
+  ASSERT_EQ(limbs[1],
+            std::stoull(bitwuzla_term_value_get_str_fmt(values[1], 10)));
+  ASSERT_DEATH(
+      bitwuzla_get_bv_values(
+          bitwuzla, terms.size(), terms.data(), limbs.data(), 1),
+      "buffer of size 1 too small");
+  bitwuzla_delete(bitwuzla);
+  bitwuzla_options_delete(options);
+}
+
 TEST_F(TestCApi, print_formula)
 {
   ASSERT_DEATH(bitwuzla_print_formula(nullptr, "smt2", stdout, 2),
@@ -5351,6 +5444,41 @@ TEST_F(TestCApi, substitute2)
   }
 }
 
+TEST_F(TestCApi, snapshot)
+{
+  std::string filename = "snapshot.bin";
+  BitwuzlaSort bv8     = bitwuzla_mk_bv_sort(d_tm, 8);
+  BitwuzlaTerm x       = bitwuzla_mk_const(d_tm, bv8, "x");
+  BitwuzlaTerm one     = bitwuzla_mk_bv_one(d_tm, bv8);
+  BitwuzlaTerm addxo   = bitwuzla_mk_term2(d_tm, BITWUZLA_KIND_BV_ADD, x, one);
+  BitwuzlaTerm ult = bitwuzla_mk_term2(d_tm, BITWUZLA_KIND_BV_ULT, addxo, x);
+  std::vector<BitwuzlaTerm> terms = {ult, one};
+
+  size_t size;
+  ASSERT_DEATH(bitwuzla_term_manager_save_snapshot(
+                   nullptr, filename.c_str(), terms.size(), terms.data()),
+               d_error_not_null);
+  ASSERT_DEATH(bitwuzla_term_manager_load_snapshot(d_tm, nullptr, &size),
+               d_error_not_null);
+  ASSERT_DEATH(
+      bitwuzla_term_manager_load_snapshot(d_tm, "no_such_snapshot.bin", &size),
+      "failed to open");
+
+  bitwuzla_term_manager_save_snapshot(
+      d_tm, filename.c_str(), terms.size(), terms.data());
+  BitwuzlaTermManager *tm = bitwuzla_term_manager_new();
+  const BitwuzlaTerm *res =
+      bitwuzla_term_manager_load_snapshot(tm, filename.c_str(), &size);
+  unlink(filename.c_str());
+  ASSERT_EQ(size, 2);
+  ASSERT_EQ(bitwuzla_term_get_kind(res[0]), BITWUZLA_KIND_BV_ULT);
+  ASSERT_EQ(std::string(bitwuzla_term_get_symbol(bitwuzla_term_get_children(
+                res[0], &size)[1])),
+            "x");
+  ASSERT_TRUE(bitwuzla_term_is_bv_value_one(res[1]));
+  bitwuzla_term_manager_delete(tm);
+}
+
 TEST_F(TestCApi, term_copy_release)
 {
   BitwuzlaTermManager *tm = bitwuzla_term_manager_new();
@@ -414,6 +414,51 @@ TEST_F(TestAigBitblaster, bv_mul4) { TEST_BIN_OP(4, "bvmul", bv_mul); }
 
 TEST_F(TestAigBitblaster, bv_mul8) { TEST_BIN_OP(8, "bvmul", bv_mul); }
 
+#define TEST_MUL_ENCODING(size, enc) \
+  {                                  \
+    bitblast::AigBitblaster bb;      \
+    bb.set_mul_encoding(enc);        \
+    auto a   = bb.bv_constant(size); \
+    auto b   = bb.bv_constant(size); \
+    auto res = bb.bv_mul(a, b);      \
+    test_binary("bvmul", res, a, b); \
+  }
+
+TEST_F(TestAigBitblaster, bv_mul_wallace)
+{
+  for (size_t i = 1; i < 17; ++i)
+  {
+    TEST_MUL_ENCODING(i, bitblast::MulEncoding::WALLACE);
+  }
+}
+
+TEST_F(TestAigBitblaster, bv_mul_dadda)
+{
+  for (size_t i = 1; i < 17; ++i)
+  {
+    TEST_MUL_ENCODING(i, bitblast::MulEncoding::DADDA);
+  }
+}
+
+TEST_F(TestAigBitblaster, bv_mul_value)
+{
+  for (auto enc : {bitblast::MulEncoding::ARRAY,
+                   bitblast::MulEncoding::WALLACE,
+                   bitblast::MulEncoding::DADDA})
+  {
+    for (uint64_t c : {UINT64_C(0), UINT64_C(1), UINT64_C(0x5b5),
+                       UINT64_C(0xfffffff7), UINT64_C(0x80000000)})
+    {
+      bitblast::AigBitblaster bb;
+      bb.set_mul_encoding(enc);
+      auto a   = bb.bv_constant(32);
+      auto b   = bb.bv_value(BitVector::from_ui(32, c));
+      auto res = bb.bv_mul(a, b);
+      test_binary("bvmul", res, a, b);
+    }
+  }
+}
+
 TEST_F(TestAigBitblaster, bv_mul_square)
 {
   for (size_t i = 1; i < 17; ++i)
@@ -469,6 +514,30 @@ TEST_F(TestAigBitblaster, bv_urem9) { TEST_BIN_OP(9, "bvurem", bv_urem); }
 
 TEST_F(TestAigBitblaster, bv_urem10) { TEST_BIN_OP(10, "bvurem", bv_urem); }
 
+TEST_F(TestAigBitblaster, bv_udiv_urem_shared)
+{
+  bitblast::AigBitblaster bb;
+  auto a        = bb.bv_constant(32);
+  auto b        = bb.bv_constant(32);
+  auto bb_udiv  = bb.bv_udiv(a, b);
+  uint64_t ands = bb.num_aig_ands();
+  ASSERT_EQ(bb.statistics().num_div_circuits, 1);
+
+  // The remainder is taken from the same divider circuit.
+  auto bb_urem = bb.bv_urem(a, b);
+  ASSERT_EQ(bb.num_aig_ands(), ands);
+  ASSERT_EQ(bb.statistics().num_div_circuits, 1);
+  ASSERT_EQ(bb.statistics().num_div_reused, 1);
+  ASSERT_GE(bb.statistics().num_div_saved, ands);
+  ASSERT_EQ(bb_udiv, bb.bv_udiv(a, b));
+  ASSERT_EQ(bb_urem, bb.bv_urem(a, b));
+
+  // Different operands require a new circuit.
+  bb.bv_urem(b, a);
+  ASSERT_EQ(bb.statistics().num_div_circuits, 2);
+  ASSERT_GT(bb.num_aig_ands(), ands);
+}
+
 TEST_F(TestAigBitblaster, bv_ite) {
   bitblast::AigBitblaster bb;
   auto a      = bb.bv_constant(32);
@@ -9,6 +9,7 @@
  */
 
 #include <iostream>
+#include <unordered_set>
 
 #include "bitblast/aig/aig_cnf.h"
 #include "bitblast/aig_bitblaster.h"
@@ -50,12 +51,27 @@ class DummySatSolver : public bitblast::SatInterface
     add(0);
   }
 
+  void add_clauses(const std::vector<int32_t>& clauses) override
+  {
+    ++d_num_batches;
+    for (auto lit : clauses)
+    {
+      add(lit);
+    }
+  }
+
   bool value(int64_t lit) override
   {
     (void) lit;
     return false;
   }
 
+  void freeze(int64_t lit) override { d_frozen.insert(std::abs(lit)); }
+
+  void melt(int64_t lit) override { d_frozen.erase(std::abs(lit)); }
+
+  const std::unordered_set<int64_t>& frozen() const { return d_frozen; }
+
   std::string to_dimacs() const
   {
     std::stringstream ss;
@@ -76,10 +92,14 @@ class DummySatSolver : public bitblast::SatInterface
 
   std::vector<std::vector<int64_t>>& get_clauses() { return d_clauses; }
 
+  uint64_t num_batches() const { return d_num_batches; }
+
  private:
-  int64_t d_max_var = 0;
+  int64_t d_max_var      = 0;
+  uint64_t d_num_batches = 0;
   std::vector<int64_t> d_clause;
   ClauseList d_clauses;
+  std::unordered_set<int64_t> d_frozen;
 };
 
 class TestAigCnf : public TestCommon
@@ -307,6 +327,203 @@ TEST_F(TestAigCnf, enc_or)
                         {or_id, a.get_id(), b.get_id()}}));
 }
 
+TEST_F(TestAigCnf, enc_and_pol)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver, true);
+
+  bitblast::AigNode a       = aigmgr.mk_bit();
+  bitblast::AigNode b       = aigmgr.mk_bit();
+  bitblast::AigNode and_aig = aigmgr.mk_and(a, b);
+  enc.encode(and_aig, bitblast::AigCnfEncoder::POSITIVE);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-and_aig.get_id(), a.get_id()},
+                        {-and_aig.get_id(), b.get_id()}}));
+  // Encoding again in the same polarity does not add clauses.
+  enc.encode(and_aig, bitblast::AigCnfEncoder::POSITIVE);
+  ASSERT_EQ(solver.get_clauses().size(), 2);
+  // Upgrade to both polarities.
+  enc.encode(aigmgr.mk_not(and_aig), bitblast::AigCnfEncoder::POSITIVE);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-and_aig.get_id(), a.get_id()},
+                        {-and_aig.get_id(), b.get_id()},
+                        {and_aig.get_id(), -a.get_id(), -b.get_id()}}));
+  enc.encode(and_aig);
+  ASSERT_EQ(solver.get_clauses().size(), 3);
+  ASSERT_EQ(enc.statistics().num_vars, 3);
+}
+
+TEST_F(TestAigCnf, enc_or_top_pol)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver, true);
+
+  bitblast::AigNode a      = aigmgr.mk_bit();
+  bitblast::AigNode b      = aigmgr.mk_bit();
+  bitblast::AigNode or_aig = aigmgr.mk_or(a, b);
+  auto or_id               = std::abs(or_aig.get_id());
+  enc.encode(or_aig, true);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{or_id, a.get_id(), b.get_id()}, {-or_id}}));
+}
+
+TEST_F(TestAigCnf, enc_pol_equisat)
+{
+  // Check that for every assignment of the inputs, the polarity-aware
+  // encoding of a formula is satisfiable if and only if the formula is true.
+  bitblast::AigBitblaster bb;
+
+  auto a   = bb.bv_constant(2);
+  auto b   = bb.bv_constant(2);
+  auto c   = bb.bv_constant(1);
+  auto ite = bb.bv_ite(c[0], bb.bv_add(a, b), bb.bv_not(a));
+  auto f   = bb.bv_ult(ite, b);
+
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver, true);
+  enc.encode(f[0], true);
+
+  const ClauseList& clauses = solver.get_clauses();
+  std::vector<int64_t> inputs;
+  for (const auto& bits : {a, b, c})
+  {
+    for (const auto& bit : bits)
+    {
+      inputs.push_back(bit.get_id());
+    }
+  }
+  // Collect gate variables.
+  std::vector<int64_t> gates;
+  for (const auto& clause : clauses)
+  {
+    for (int64_t lit : clause)
+    {
+      int64_t var = std::abs(lit);
+      if (std::find(inputs.begin(), inputs.end(), var) == inputs.end()
+          && std::find(gates.begin(), gates.end(), var) == gates.end())
+      {
+        gates.push_back(var);
+      }
+    }
+  }
+  ASSERT_LE(gates.size(), 16);
+
+  for (uint64_t in = 0; in < (1u << inputs.size()); ++in)
+  {
+    // Bits are stored MSB first.
+    BitVector va   = BitVector::from_ui(2, in & 3);
+    BitVector vb   = BitVector::from_ui(2, (in >> 2) & 3);
+    bool vc        = (in >> 4) & 1;
+    BitVector vite = vc ? va.bvadd(vb) : va.bvnot();
+    bool expected  = vite.compare(vb) < 0;
+
+    std::unordered_map<int64_t, bool> values;
+    values[inputs[0]] = va.bit(1);
+    values[inputs[1]] = va.bit(0);
+    values[inputs[2]] = vb.bit(1);
+    values[inputs[3]] = vb.bit(0);
+    values[inputs[4]] = vc;
+
+    // Brute-force search for a satisfying assignment of the clauses
+    // extending the input assignment.
+    bool sat = false;
+    for (uint64_t m = 0; m < (UINT64_C(1) << gates.size()) && !sat; ++m)
+    {
+      for (size_t i = 0; i < gates.size(); ++i)
+      {
+        values[gates[i]] = (m >> i) & 1;
+      }
+      sat = true;
+      for (const auto& clause : clauses)
+      {
+        bool clause_sat = false;
+        for (int64_t lit : clause)
+        {
+          clause_sat = clause_sat || (values.at(std::abs(lit)) == (lit > 0));
+        }
+        if (!clause_sat)
+        {
+          sat = false;
+          break;
+        }
+      }
+    }
+    ASSERT_EQ(sat, expected);
+  }
+}
+
+TEST_F(TestAigCnf, garbage_collect)
+{
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder cnf(solver);
+  bitblast::AigManager aigmgr;
+
+  auto a      = aigmgr.mk_const();
+  auto b      = aigmgr.mk_const();
+  auto and_ab = aigmgr.mk_and(a, b);
+  cnf.encode(and_ab);
+  ASSERT_EQ(cnf.literal(and_ab), and_ab.get_id());
+  uint32_t num_nodes = aigmgr.num_nodes();
+
+  // Variables of nodes encoded while freezing is enabled are frozen.
+  cnf.set_freeze(true);
+  auto c       = aigmgr.mk_const();
+  auto and_abc = aigmgr.mk_and(and_ab, aigmgr.mk_not(c));
+  cnf.encode(and_abc);
+  ASSERT_EQ(solver.frozen(),
+            std::unordered_set<int64_t>({c.get_id(), and_abc.get_id()}));
+
+  // Deleted nodes are melted, new nodes with reused ids get fresh variables.
+  cnf.garbage_collect(num_nodes);
+  aigmgr.garbage_collect(num_nodes);
+  ASSERT_TRUE(solver.frozen().empty());
+  cnf.set_freeze(false);
+
+  auto d      = aigmgr.mk_const();
+  auto and_ad = aigmgr.mk_and(a, d);
+  ASSERT_EQ(d.get_id(), c.get_id());
+  ASSERT_EQ(and_ad.get_id(), and_abc.get_id());
+  solver.get_clauses().clear();
+  cnf.encode(and_ad);
+  int64_t var_d  = cnf.literal(d);
+  int64_t var_ad = cnf.literal(and_ad);
+  ASSERT_GT(var_d, and_abc.get_id());
+  ASSERT_GT(var_ad, and_abc.get_id());
+  ASSERT_NE(var_d, var_ad);
+  ASSERT_EQ(cnf.literal(aigmgr.mk_not(d)), -var_d);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-var_ad, a.get_id()},
+                        {-var_ad, var_d},
+                        {var_ad, -a.get_id(), -var_d}}));
+  // Remaining nodes keep their variables.
+  ASSERT_EQ(cnf.literal(and_ab), and_ab.get_id());
+}
+
+TEST_F(TestAigCnf, clause_batch)
+{
+  bitblast::AigBitblaster bb;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  auto a   = bb.bv_constant(16);
+  auto b   = bb.bv_constant(16);
+  auto mul = bb.bv_mul(a, b);
+  auto ult = bb.bv_ult(mul, a);
+
+  // All clauses of one encode call are passed to the solver in one batch.
+  for (const auto& bit : mul)
+  {
+    enc.encode(bit);
+  }
+  ASSERT_EQ(solver.num_batches(), mul.size());
+  ASSERT_EQ(solver.get_clauses().size(), enc.statistics().num_clauses);
+  enc.encode(ult[0], true);
+  ASSERT_EQ(solver.num_batches(), mul.size() + 1);
+  ASSERT_EQ(solver.get_clauses().size(), enc.statistics().num_clauses);
+}
+
 #if 0
 TEST_F(TestAigCnf, enc_or_top)
 {
@@ -0,0 +1,416 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "bitblast/aig/aig_fraig.h"
+#include "bitblast/aig_bitblaster.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+/** Simple DPLL solver used to prove equivalences in tests. */
+class DpllSatSolver : public bitblast::FraigSatInterface
+{
+ public:
+  void add(int64_t lit) override
+  {
+    if (lit == 0)
+    {
+      d_clauses.emplace_back(d_clause);
+      d_clause.clear();
+    }
+    else
+    {
+      d_clause.push_back(lit);
+      d_max_var = std::max(d_max_var, std::abs(lit));
+    }
+  }
+
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    for (auto lit : literals)
+    {
+      add(lit);
+    }
+    add(0);
+  }
+
+  bool value(int64_t lit) override
+  {
+    assert(static_cast<size_t>(std::abs(lit)) < d_model.size());
+    int8_t val = d_model[std::abs(lit)];
+    return lit < 0 ? val < 0 : val > 0;
+  }
+
+  void assume(int64_t lit) override { d_assumptions.push_back(lit); }
+
+  Result solve(uint64_t conflict_limit) override
+  {
+    ++d_num_solve_calls;
+    d_conflicts = 0;
+    d_limit     = conflict_limit;
+    std::vector<int8_t> assignment(d_max_var + 1, 0);
+    bool ok = true;
+    for (int64_t lit : d_assumptions)
+    {
+      if (static_cast<size_t>(std::abs(lit)) >= assignment.size())
+      {
+        continue;
+      }
+      int8_t val = lit < 0 ? -1 : 1;
+      if (assignment[std::abs(lit)] == -val)
+      {
+        ok = false;
+      }
+      assignment[std::abs(lit)] = val;
+    }
+    d_assumptions.clear();
+    if (!ok)
+    {
+      return Result::UNSAT;
+    }
+    int32_t res = dpll(assignment);
+    if (res > 0)
+    {
+      d_model = assignment;
+      return Result::SAT;
+    }
+    return res < 0 ? Result::UNSAT : Result::UNKNOWN;
+  }
+
+  uint64_t d_num_solve_calls = 0;
+
+ private:
+  /** @return 1 if sat, -1 if unsat, 0 if the conflict limit is reached. */
+  int32_t dpll(std::vector<int8_t>& assignment)
+  {
+    // Unit propagation
+    bool changed;
+    do
+    {
+      changed = false;
+      for (const auto& clause : d_clauses)
+      {
+        int64_t unassigned = 0;
+        size_t num_unassigned = 0;
+        bool sat              = false;
+        for (int64_t lit : clause)
+        {
+          int8_t val = assignment[std::abs(lit)];
+          if (val == 0)
+          {
+            unassigned = lit;
+            ++num_unassigned;
+          }
+          else if ((val > 0) == (lit > 0))
+          {
+            sat = true;
+            break;
+          }
+        }
+        if (sat)
+        {
+          continue;
+        }
+        if (num_unassigned == 0)
+        {
+          return ++d_conflicts > d_limit ? 0 : -1;
+        }
+        if (num_unassigned == 1)
+        {
+          assignment[std::abs(unassigned)] = unassigned < 0 ? -1 : 1;
+          changed                          = true;
+        }
+      }
+    } while (changed);
+
+    for (size_t var = 1; var < assignment.size(); ++var)
+    {
+      if (assignment[var] == 0)
+      {
+        for (int8_t val : {1, -1})
+        {
+          std::vector<int8_t> a = assignment;
+          a[var]                = val;
+          int32_t res           = dpll(a);
+          if (res >= 0)
+          {
+            if (res > 0)
+            {
+              assignment = a;
+            }
+            return res;
+          }
+        }
+        return -1;
+      }
+    }
+    return 1;
+  }
+
+  std::vector<std::vector<int64_t>> d_clauses;
+  std::vector<int64_t> d_clause;
+  std::vector<int64_t> d_assumptions;
+  std::vector<int8_t> d_model;
+  int64_t d_max_var    = 0;
+  uint64_t d_conflicts = 0;
+  uint64_t d_limit     = 0;
+};
+
+class TestAigFraig : public TestCommon
+{
+ protected:
+  /** Evaluate `aig` under the given assignment of its inputs. */
+  bool eval(const bitblast::AigNode& aig,
+            const std::unordered_map<int64_t, bool>& assignment)
+  {
+    bool res;
+    if (aig.is_true() || aig.is_false())
+    {
+      return aig.is_true();
+    }
+    if (aig.is_and())
+    {
+      res = eval(aig[0], assignment) && eval(aig[1], assignment);
+    }
+    else
+    {
+      res = assignment.at(std::abs(aig.get_id()));
+    }
+    return aig.is_negated() ? !res : res;
+  }
+
+  /** Check that `a` and `b` agree on all assignments of `inputs`. */
+  void check_equiv(const bitblast::AigNode& a,
+                   const bitblast::AigNode& b,
+                   const std::vector<bitblast::AigNode>& inputs)
+  {
+    for (uint64_t i = 0; i < (UINT64_C(1) << inputs.size()); ++i)
+    {
+      std::unordered_map<int64_t, bool> assignment;
+      for (size_t j = 0; j < inputs.size(); ++j)
+      {
+        assignment.emplace(inputs[j].get_id(), (i >> j) & 1);
+      }
+      ASSERT_EQ(eval(a, assignment), eval(b, assignment));
+    }
+  }
+
+  /** @return The number of AND gates in the cone of `aig`. */
+  size_t num_ands(const bitblast::AigNode& aig)
+  {
+    std::unordered_set<int64_t> cache;
+    std::vector<bitblast::AigNode> visit{aig};
+    do
+    {
+      bitblast::AigNode cur = visit.back();
+      visit.pop_back();
+      if (cur.is_and() && cache.insert(std::abs(cur.get_id())).second)
+      {
+        visit.push_back(cur[0]);
+        visit.push_back(cur[1]);
+      }
+    } while (!visit.empty());
+    return cache.size();
+  }
+
+  bitblast::AigManager d_amgr;
+  DpllSatSolver d_sat_solver;
+};
+
+TEST_F(TestAigFraig, distributive)
+{
+  auto a = d_amgr.mk_const();
+  auto b = d_amgr.mk_const();
+  auto c = d_amgr.mk_const();
+
+  // a & (b | c)
+  auto lhs = d_amgr.mk_and(
+      a, d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(b), d_amgr.mk_not(c))));
+  // (a & b) | (a & c)
+  auto rhs = d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, b)),
+                                         d_amgr.mk_not(d_amgr.mk_and(a, c))));
+  ASSERT_FALSE(lhs == rhs);
+
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver);
+  auto swept = fraig.sweep({lhs, rhs});
+  ASSERT_EQ(swept[0], swept[1]);
+  ASSERT_EQ(fraig.statistics().num_merged, 1);
+  check_equiv(lhs, swept[0], {a, b, c});
+}
+
+TEST_F(TestAigFraig, merge_smaller_id)
+{
+  auto a      = d_amgr.mk_const();
+  auto b      = d_amgr.mk_const();
+  auto and_ab = d_amgr.mk_and(a, b);
+
+  // a | b
+  auto lhs = d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(a), d_amgr.mk_not(b)));
+  // (a <-> b) & (a | b) is a & b
+  auto iff = d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, d_amgr.mk_not(b))),
+                           d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(a), b)));
+  auto rhs = d_amgr.mk_and(iff, lhs);
+
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver);
+  auto swept = fraig.sweep({lhs, rhs, and_ab});
+  ASSERT_EQ(swept[0], lhs);
+  ASSERT_EQ(swept[1], and_ab);
+  ASSERT_EQ(swept[2], and_ab);
+  check_equiv(lhs, swept[0], {a, b});
+  check_equiv(rhs, swept[1], {a, b});
+}
+
+TEST_F(TestAigFraig, constant)
+{
+  auto a = d_amgr.mk_const();
+  auto b = d_amgr.mk_const();
+
+  // (a xor b) & (a <-> b) is false, but not detected by two-level rewriting
+  auto xor_ab =
+      d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, b)),
+                    d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(a), d_amgr.mk_not(b))));
+  auto iff_ab =
+      d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, d_amgr.mk_not(b))),
+                    d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(a), b)));
+  auto res = d_amgr.mk_and(xor_ab, iff_ab);
+  ASSERT_FALSE(res.is_false());
+
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver);
+  auto swept = fraig.sweep({res, d_amgr.mk_not(res)});
+  ASSERT_TRUE(swept[0].is_false());
+  ASSERT_TRUE(swept[1].is_true());
+}
+
+TEST_F(TestAigFraig, bv_add_sub)
+{
+  bitblast::AigBitblaster bb;
+  auto a = bb.bv_constant(4);
+  auto b = bb.bv_constant(4);
+  // a + b vs. (a + 1) + (b - 1)
+  auto one  = bb.bv_value(BitVector::from_ui(4, 1));
+  auto ones = bb.bv_value(BitVector::mk_ones(4));
+  auto lhs  = bb.bv_add(a, b);
+  auto rhs  = bb.bv_add(bb.bv_add(a, one), bb.bv_add(b, ones));
+  auto eq   = bb.bv_eq(lhs, rhs);
+  ASSERT_FALSE(eq[0].is_true());
+
+  bitblast::AigFraig fraig(bb.aig_manager(), d_sat_solver);
+  auto swept = fraig.sweep({eq[0]});
+  ASSERT_TRUE(swept[0].is_true());
+  ASSERT_GT(fraig.statistics().num_merged, 0);
+  ASSERT_LT(num_ands(swept[0]), num_ands(eq[0]));
+}
+
+TEST_F(TestAigFraig, bv_non_equiv)
+{
+  bitblast::AigBitblaster bb;
+  auto a = bb.bv_constant(3);
+  auto b = bb.bv_constant(3);
+  auto c = bb.bv_constant(3);
+  // a * (b + c) vs. a * b + c, not equivalent
+  auto lhs = bb.bv_mul(a, bb.bv_add(b, c));
+  auto rhs = bb.bv_add(bb.bv_mul(a, b), c);
+  auto ult = bb.bv_ult(lhs, rhs);
+
+  std::vector<bitblast::AigNode> inputs(a.begin(), a.end());
+  inputs.insert(inputs.end(), b.begin(), b.end());
+  inputs.insert(inputs.end(), c.begin(), c.end());
+
+  bitblast::AigFraig fraig(bb.aig_manager(), d_sat_solver);
+  std::vector<bitblast::AigNode> roots(lhs.begin(), lhs.end());
+  roots.insert(roots.end(), rhs.begin(), rhs.end());
+  roots.push_back(ult[0]);
+  auto swept = fraig.sweep(roots);
+  ASSERT_EQ(swept.size(), roots.size());
+  for (size_t i = 0; i < roots.size(); ++i)
+  {
+    check_equiv(roots[i], swept[i], inputs);
+  }
+
+  // Sweeping again is a no-op.
+  uint64_t num_calls = d_sat_solver.d_num_solve_calls;
+  auto swept2        = fraig.sweep(roots);
+  ASSERT_EQ(swept, swept2);
+  ASSERT_EQ(d_sat_solver.d_num_solve_calls, num_calls);
+}
+
+TEST_F(TestAigFraig, incremental)
+{
+  auto a = d_amgr.mk_const();
+  auto b = d_amgr.mk_const();
+  auto c = d_amgr.mk_const();
+
+  auto lhs = d_amgr.mk_and(
+      a, d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(b), d_amgr.mk_not(c))));
+  auto rhs = d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, b)),
+                                         d_amgr.mk_not(d_amgr.mk_and(a, c))));
+
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver);
+  auto swept1 = fraig.sweep({lhs});
+  // rhs is merged into the node of the previous sweep
+  auto swept2 = fraig.sweep({rhs});
+  ASSERT_EQ(swept1[0], swept2[0]);
+}
+
+TEST_F(TestAigFraig, garbage_collect)
+{
+  auto a = d_amgr.mk_const();
+  auto b = d_amgr.mk_const();
+  auto c = d_amgr.mk_const();
+
+  auto lhs = d_amgr.mk_and(
+      a, d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(b), d_amgr.mk_not(c))));
+  auto mk_rhs = [&]() {
+    return d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, b)),
+                                       d_amgr.mk_not(d_amgr.mk_and(a, c))));
+  };
+
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver);
+  auto swept1        = fraig.sweep({lhs});
+  uint32_t num_nodes = d_amgr.num_nodes();
+
+  auto d      = d_amgr.mk_const();
+  auto swept2 = fraig.sweep({d_amgr.mk_and(mk_rhs(), d)});
+  fraig.garbage_collect(num_nodes);
+  d_amgr.garbage_collect(num_nodes);
+
+  // Recreated nodes reuse the deleted ids and are merged again.
+  auto rhs    = mk_rhs();
+  auto swept3 = fraig.sweep({rhs, lhs});
+  ASSERT_EQ(swept3[0], swept1[0]);
+  ASSERT_EQ(swept3[1], swept1[0]);
+  check_equiv(rhs, swept3[0], {a, b, c});
+}
+
+TEST_F(TestAigFraig, conflict_limit)
+{
+  auto a = d_amgr.mk_const();
+  auto b = d_amgr.mk_const();
+  auto c = d_amgr.mk_const();
+
+  auto lhs = d_amgr.mk_and(
+      a, d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(b), d_amgr.mk_not(c))));
+  auto rhs = d_amgr.mk_not(d_amgr.mk_and(d_amgr.mk_not(d_amgr.mk_and(a, b)),
+                                         d_amgr.mk_not(d_amgr.mk_and(a, c))));
+
+  // No conflicts allowed, nothing can be proved.
+  bitblast::AigFraig fraig(d_amgr, d_sat_solver, 0);
+  auto swept = fraig.sweep({lhs, rhs});
+  ASSERT_FALSE(swept[0] == swept[1]);
+  ASSERT_EQ(fraig.statistics().num_merged, 0);
+  ASSERT_GT(fraig.statistics().num_unknown, 0);
+  check_equiv(lhs, swept[0], {a, b, c});
+  check_equiv(rhs, swept[1], {a, b, c});
+}
+
+}  // namespace bzla::test
@@ -98,6 +98,87 @@ TEST_F(TestAigMgr, and_unique_aig)
   ASSERT_EQ(and_aig, aigmgr.mk_and(right, left));
 }
 
+TEST_F(TestAigMgr, and_unique_resize)
+{
+  bitblast::AigManager aigmgr;
+
+  std::vector<bitblast::AigNode> consts, ands;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    consts.push_back(aigmgr.mk_const());
+  }
+  for (size_t i = 0; i < consts.size(); ++i)
+  {
+    for (size_t j = i + 1; j < consts.size(); ++j)
+    {
+      ands.push_back(aigmgr.mk_and(consts[i], aigmgr.mk_not(consts[j])));
+    }
+  }
+  ASSERT_EQ(aigmgr.statistics().num_ands, ands.size());
+  ASSERT_EQ(aigmgr.statistics().num_shared, 0);
+
+  for (size_t i = 0, k = 0; i < consts.size(); ++i)
+  {
+    for (size_t j = i + 1; j < consts.size(); ++j, ++k)
+    {
+      auto and_aig = aigmgr.mk_and(aigmgr.mk_not(consts[j]), consts[i]);
+      ASSERT_EQ(and_aig, ands[k]);
+      ASSERT_EQ(and_aig[0], consts[i]);
+      ASSERT_EQ(and_aig[1], aigmgr.mk_not(consts[j]));
+    }
+  }
+  ASSERT_EQ(aigmgr.statistics().num_ands, ands.size());
+  ASSERT_EQ(aigmgr.statistics().num_shared, ands.size());
+}
+
+TEST_F(TestAigMgr, garbage_collect)
+{
+  bitblast::AigManager aigmgr;
+
+  std::vector<bitblast::AigNode> consts, ands;
+  for (size_t i = 0; i < 20; ++i)
+  {
+    consts.push_back(aigmgr.mk_const());
+  }
+  for (size_t i = 0; i + 1 < consts.size(); ++i)
+  {
+    ands.push_back(aigmgr.mk_and(consts[i], consts[i + 1]));
+  }
+  uint32_t num_nodes = aigmgr.num_nodes();
+  uint64_t num_ands  = aigmgr.statistics().num_ands;
+
+  // Nodes created after num_nodes are deleted.
+  std::vector<bitblast::AigNode> tmp;
+  for (size_t i = 0; i + 2 < consts.size(); ++i)
+  {
+    tmp.push_back(aigmgr.mk_and(ands[i], aigmgr.mk_not(consts[i + 2])));
+  }
+  tmp.push_back(aigmgr.mk_const());
+  tmp.push_back(aigmgr.mk_and(tmp.back(), tmp[0]));
+  aigmgr.garbage_collect(num_nodes);
+  ASSERT_EQ(aigmgr.num_nodes(), num_nodes);
+  ASSERT_EQ(aigmgr.statistics().num_ands, num_ands);
+  ASSERT_EQ(aigmgr.statistics().num_consts, consts.size());
+  ASSERT_EQ(aigmgr.statistics().num_deleted, tmp.size());
+  for (const auto& a : ands)
+  {
+    ASSERT_EQ(a.parents(), 0);
+  }
+
+  // Remaining nodes are still found, deleted ids are reused.
+  uint64_t num_shared = aigmgr.statistics().num_shared;
+  for (size_t i = 0; i + 1 < consts.size(); ++i)
+  {
+    ASSERT_EQ(aigmgr.mk_and(consts[i + 1], consts[i]), ands[i]);
+  }
+  ASSERT_EQ(aigmgr.statistics().num_shared, num_shared + ands.size());
+  auto and_aig = aigmgr.mk_and(ands[1], consts[0]);
+  ASSERT_EQ(and_aig.get_id(), num_nodes + 1);
+  ASSERT_EQ(and_aig[0], consts[0]);
+  ASSERT_EQ(and_aig[1], ands[1]);
+  ASSERT_EQ(aigmgr.mk_and(consts[0], ands[1]), and_aig);
+}
+
 TEST_F(TestAigMgr, or_aig)
 {
   bitblast::BitInterface<bitblast::AigNode> aigmgr;
@@ -468,7 +549,6 @@ TEST_F(TestAigMgr, idempotence4_3)
   auto a = mgr.mk_const();
   auto b = mgr.mk_const();
   auto c = mgr.mk_const();
-  auto d = mgr.mk_const();
 
   {
     auto d = a;
@@ -0,0 +1,268 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <chrono>
+#include <functional>
+
+#include "bitblast/aig/aig_simulator.h"
+#include "bitblast/aig_bitblaster.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestAigSimulator : public TestCommon
+{
+ protected:
+  /** @return The value of `bits` in pattern `i`. */
+  static BitVector pattern(const bitblast::AigSimulator& sim,
+                           const bitblast::AigBitblaster::Bits& bits,
+                           uint32_t i)
+  {
+    BitVector res(bits.size());
+    for (size_t j = 0, size = bits.size(); j < size; ++j)
+    {
+      res.set_bit(size - 1 - j, (sim.value(bits[j], i / 64) >> (i % 64)) & 1);
+    }
+    return res;
+  }
+
+  /** Check that `res` matches `op(a, b)` on all patterns. */
+  void check_binary(
+      const bitblast::AigSimulator& sim,
+      const bitblast::AigBitblaster::Bits& a,
+      const bitblast::AigBitblaster::Bits& b,
+      const bitblast::AigBitblaster::Bits& res,
+      std::function<BitVector(const BitVector&, const BitVector&)> op)
+  {
+    for (uint32_t i = 0; i < 64 * sim.num_words(); ++i)
+    {
+      ASSERT_EQ(pattern(sim, res, i),
+                op(pattern(sim, a, i), pattern(sim, b, i)));
+    }
+  }
+};
+
+TEST_F(TestAigSimulator, ctor_dtor)
+{
+  bitblast::AigManager amgr;
+  bitblast::AigSimulator sim(amgr);
+}
+
+TEST_F(TestAigSimulator, and_not)
+{
+  bitblast::AigManager amgr;
+  auto a      = amgr.mk_const();
+  auto b      = amgr.mk_const();
+  auto and_ab = amgr.mk_and(a, amgr.mk_not(b));
+
+  bitblast::AigSimulator sim(amgr, 2);
+  sim.simulate();
+  for (uint32_t w = 0; w < sim.num_words(); ++w)
+  {
+    ASSERT_EQ(sim.value(amgr.mk_true(), w), ~UINT64_C(0));
+    ASSERT_EQ(sim.value(amgr.mk_false(), w), 0);
+    ASSERT_EQ(sim.value(and_ab, w), sim.value(a, w) & ~sim.value(b, w));
+    ASSERT_EQ(sim.value(amgr.mk_not(and_ab), w),
+              ~(sim.value(a, w) & ~sim.value(b, w)));
+  }
+  ASSERT_EQ(sim.statistics().num_simulated, 1);
+
+  auto sig = sim.signature(amgr.mk_not(and_ab));
+  ASSERT_EQ(sig.size(), 2);
+  ASSERT_EQ(sig[0], sim.value(amgr.mk_not(and_ab), 0));
+  ASSERT_EQ(sig[1], sim.value(amgr.mk_not(and_ab), 1));
+}
+
+TEST_F(TestAigSimulator, set_input)
+{
+  bitblast::AigManager amgr;
+  auto a       = amgr.mk_const();
+  auto b       = amgr.mk_const();
+  auto c       = amgr.mk_const();
+  auto and_ab  = amgr.mk_and(a, b);
+  auto and_abc = amgr.mk_and(and_ab, amgr.mk_not(c));
+  auto and_c   = amgr.mk_and(c, amgr.mk_not(a));
+
+  bitblast::AigSimulator sim(amgr);
+  sim.simulate();
+  sim.set_input(a, 0, 0b1100);
+  sim.set_input(b, 0, 0b1010);
+  sim.set_input(c, 0, 0b0110);
+  sim.resimulate();
+  ASSERT_EQ(sim.value(and_ab, 0), 0b1000);
+  ASSERT_EQ(sim.value(and_abc, 0), 0b1000);
+  ASSERT_EQ(sim.value(and_c, 0), 0b0010);
+
+  // Only the fan-out cone of b is resimulated.
+  uint64_t num_resimulated = sim.statistics().num_resimulated;
+  sim.set_input(b, 0, 0b0110);
+  sim.resimulate();
+  ASSERT_EQ(sim.value(and_ab, 0), 0b0100);
+  ASSERT_EQ(sim.value(and_abc, 0), 0);
+  ASSERT_EQ(sim.value(and_c, 0), 0b0010);
+  ASSERT_EQ(sim.statistics().num_resimulated, num_resimulated + 2);
+
+  // Setting the same value does not trigger resimulation.
+  sim.set_input(b, 0, 0b0110);
+  sim.resimulate();
+  ASSERT_EQ(sim.statistics().num_resimulated, num_resimulated + 2);
+}
+
+TEST_F(TestAigSimulator, incremental_nodes)
+{
+  bitblast::AigManager amgr;
+  auto a = amgr.mk_const();
+  auto b = amgr.mk_const();
+
+  bitblast::AigSimulator sim(amgr);
+  sim.simulate();
+  uint64_t val_a = sim.value(a, 0);
+
+  // Nodes created after simulate() are simulated on the next call.
+  auto c      = amgr.mk_const();
+  auto and_bc = amgr.mk_and(b, c);
+  sim.simulate();
+  ASSERT_EQ(sim.value(a, 0), val_a);
+  ASSERT_EQ(sim.value(and_bc, 0), sim.value(b, 0) & sim.value(c, 0));
+}
+
+TEST_F(TestAigSimulator, garbage_collect)
+{
+  bitblast::AigManager amgr;
+  auto a      = amgr.mk_const();
+  auto b      = amgr.mk_const();
+  auto and_ab = amgr.mk_and(a, b);
+
+  bitblast::AigSimulator sim(amgr);
+  sim.simulate();
+  uint32_t num_nodes = amgr.num_nodes();
+
+  auto c       = amgr.mk_const();
+  auto and_abc = amgr.mk_and(and_ab, c);
+  sim.simulate();
+  sim.randomize_input(c);
+  sim.garbage_collect(num_nodes);
+  amgr.garbage_collect(num_nodes);
+
+  // Changes of deleted inputs are dropped.
+  sim.resimulate();
+
+  // New nodes reuse the deleted ids and are simulated from scratch.
+  auto d        = amgr.mk_const();
+  auto and_nabd = amgr.mk_and(amgr.mk_not(and_ab), d);
+  ASSERT_EQ(d.get_id(), c.get_id());
+  ASSERT_EQ(and_nabd.get_id(), and_abc.get_id());
+  sim.simulate();
+  ASSERT_EQ(sim.value(and_nabd, 0), ~sim.value(and_ab, 0) & sim.value(d, 0));
+
+  sim.set_input(d, 0, ~sim.value(d, 0));
+  sim.resimulate();
+  ASSERT_EQ(sim.value(and_nabd, 0), ~sim.value(and_ab, 0) & sim.value(d, 0));
+}
+
+TEST_F(TestAigSimulator, bv_ops)
+{
+  bitblast::AigBitblaster bb;
+  auto a   = bb.bv_constant(8);
+  auto b   = bb.bv_constant(8);
+  auto add = bb.bv_add(a, b);
+  auto mul = bb.bv_mul(a, b);
+  auto ult = bb.bv_ult(a, b);
+
+  bitblast::AigSimulator sim(bb.aig_manager(), 4);
+  sim.simulate();
+  check_binary(sim, a, b, add, [](const auto& x, const auto& y) {
+    return x.bvadd(y);
+  });
+  check_binary(sim, a, b, mul, [](const auto& x, const auto& y) {
+    return x.bvmul(y);
+  });
+  check_binary(sim, a, b, ult, [](const auto& x, const auto& y) {
+    return x.bvult(y);
+  });
+
+  // Resimulation yields the same result as simulating from scratch.
+  for (const auto& bit : a)
+  {
+    sim.randomize_input(bit);
+  }
+  sim.resimulate();
+  check_binary(sim, a, b, mul, [](const auto& x, const auto& y) {
+    return x.bvmul(y);
+  });
+}
+
+TEST_F(TestAigSimulator, mul_encodings)
+{
+  for (auto enc : {bitblast::MulEncoding::ARRAY,
+                   bitblast::MulEncoding::WALLACE,
+                   bitblast::MulEncoding::DADDA})
+  {
+    for (uint64_t size : {1, 3, 8, 13})
+    {
+      bitblast::AigBitblaster bb;
+      bb.set_mul_encoding(enc);
+      auto a    = bb.bv_constant(size);
+      auto b    = bb.bv_constant(size);
+      auto c    = bb.bv_value(BitVector::from_ui(size, 0x5b5, true));
+      auto mul  = bb.bv_mul(a, b);
+      auto cmul = bb.bv_mul(a, c);
+
+      bitblast::AigSimulator sim(bb.aig_manager(), 4);
+      sim.simulate();
+      check_binary(sim, a, b, mul, [](const auto& x, const auto& y) {
+        return x.bvmul(y);
+      });
+      check_binary(sim, a, c, cmul, [](const auto& x, const auto& y) {
+        return x.bvmul(y);
+      });
+    }
+  }
+}
+
+#if 0
+TEST_F(TestAigSimulator, perf_mul64)
+{
+  bitblast::AigBitblaster bb;
+  auto a   = bb.bv_constant(64);
+  auto b   = bb.bv_constant(64);
+  auto mul = bb.bv_mul(a, b);
+
+  for (uint32_t num_words : {1, 4, 16})
+  {
+    bitblast::AigSimulator sim(bb.aig_manager(), num_words);
+    auto start = std::chrono::high_resolution_clock::now();
+    sim.simulate();
+    auto stop = std::chrono::high_resolution_clock::now();
+    std::cout << "simulate " << bb.num_aig_ands() << " ands, "
+              << 64 * num_words << " patterns: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(stop
+                                                                       - start)
+                     .count()
+              << "us" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < 100; ++i)
+    {
+      sim.randomize_input(a[i % 64]);
+      sim.resimulate();
+    }
+    stop = std::chrono::high_resolution_clock::now();
+    std::cout << "resimulate 100 single input changes: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(stop
+                                                                       - start)
+                     .count()
+              << "us (" << sim.statistics().num_resimulated
+              << " ands resimulated)" << std::endl;
+  }
+}
+#endif
+
+}  // namespace bzla::test
@@ -5045,6 +5045,31 @@ TEST_F(TestBitVector, to_uint64)
   ASSERT_DEATH_DEBUG(BitVector(128).ibvnot().to_uint64(), "fits_in_size");
 }
 
+TEST_F(TestBitVector, to_limbs)
+{
+  for (uint64_t size : {1, 63, 64, 65, 128, 200, 256, 257, 300})
+  {
+    for (uint64_t i = 0; i < N_TESTS; ++i)
+    {
+      BitVector bv(size, *d_rng);
+      std::vector<uint64_t> limbs(bv.num_limbs(), 1);
+      bv.to_limbs(limbs.data());
+      for (uint64_t j = 0; j < size; ++j)
+      {
+        ASSERT_EQ(bv.bit(j), ((limbs[j / 64] >> (j % 64)) & 1) == 1);
+      }
+      // Bits beyond the size are zero.
+      if (size % 64)
+      {
+        ASSERT_EQ(limbs.back() >> (size % 64), 0);
+      }
+    }
+  }
+  uint64_t limb;
+  BitVector::from_ui(16, 1234).to_limbs(&limb);
+  ASSERT_EQ(limb, 1234);
+}
+
 TEST_F(TestBitVector, compare)
 {
   for (uint64_t i = 0; i < 15; ++i)
@@ -6581,6 +6606,89 @@ TEST_F(TestBitVector, udivurem)
   test_udivurem(127);
 }
 
+TEST_F(TestBitVector, limbs)
+{
+  /* Compare operations on limb-based bit-vectors against the same operations
+   * on zero-extended GMP-based bit-vectors. */
+  for (uint64_t size : {65, 100, 128, 192, 255, 256})
+  {
+    uint64_t gsize = BitVector::s_limbs_size + 1;
+    uint64_t n     = gsize - size;
+    for (uint32_t i = 0; i < N_TESTS; ++i)
+    {
+      BitVector a(size, *d_rng);
+      BitVector b(size, *d_rng);
+      if (i % 4 == 1)
+      {
+        b = BitVector(size, *d_rng, d_rng->pick<uint64_t>(0, size - 1), 0);
+      }
+      else if (i % 4 == 2)
+      {
+        a = BitVector(size, *d_rng, d_rng->pick<uint64_t>(0, size - 1), 0);
+      }
+      BitVector ga = a.bvzext(n);
+      BitVector gb = b.bvzext(n);
+      uint64_t shift = d_rng->pick<uint64_t>(0, size);
+
+      ASSERT_EQ(BitVector(gsize, ga.str()), ga);
+      ASSERT_EQ(BitVector(size, a.str()), a);
+      ASSERT_EQ(BitVector(size, a.str(10), 10), a);
+      ASSERT_EQ(BitVector(size, a.str(16), 16), a);
+      ASSERT_EQ(a.str(10), ga.str(10));
+      ASSERT_EQ(a.str(16), ga.str(16));
+      ASSERT_EQ(a.hash(), BitVector(a).hash());
+      ASSERT_EQ(a.compare(b), ga.compare(gb));
+      ASSERT_EQ(a.signed_compare(b), a.bvsext(n).signed_compare(b.bvsext(n)));
+      ASSERT_EQ(a.count_leading_zeros() + n, ga.count_leading_zeros());
+      ASSERT_EQ(a.count_trailing_zeros(),
+                std::min(size, ga.count_trailing_zeros()));
+      ASSERT_EQ(a.bvsext(n).count_leading_ones(),
+                a.msb() ? a.count_leading_ones() + n : 0);
+
+      ASSERT_EQ(a.bvadd(b), ga.bvadd(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvsub(b), ga.bvsub(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvmul(b), ga.bvmul(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvneg(), ga.bvneg().bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvnot(), ga.bvnot().bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvinc(), ga.bvinc().bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvdec(), ga.bvdec().bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvand(b), ga.bvand(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvor(b), ga.bvor(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvxor(b), ga.bvxor(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvudiv(b), ga.bvudiv(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvurem(b), ga.bvurem(gb).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvult(b), ga.bvult(gb));
+      ASSERT_EQ(a.bvslt(b), a.bvsext(n).bvslt(b.bvsext(n)));
+      ASSERT_EQ(a.bvshl(shift), ga.bvshl(shift).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvshr(shift), ga.bvshr(shift).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvashr(shift),
+                a.bvsext(n).bvashr(shift).bvextract(size - 1, 0));
+      ASSERT_EQ(a.bvroli(shift).bvrori(shift), a);
+      ASSERT_EQ(a.bvroli(shift),
+                a.bvshl(shift % size).bvor(a.bvshr(size - shift % size)));
+      ASSERT_EQ(a.bvconcat(b).bvextract(2 * size - 1, size), a);
+      ASSERT_EQ(a.bvconcat(b).bvextract(size - 1, 0), b);
+      ASSERT_EQ(a.bvextract(size - 1, size - shift / 2 - 1),
+                ga.bvextract(size - 1, size - shift / 2 - 1));
+      ASSERT_EQ(a.bvrepeat(2), a.bvconcat(a));
+      ASSERT_EQ(a.bvsext(n).bvextract(size - 1, 0), a);
+      ASSERT_EQ(a.bvsext(n).bit(gsize - 1), a.msb());
+      ASSERT_EQ(BitVector::bvite(a.bvextract(0, 0), a, b),
+                BitVector::bvite(a.bvextract(0, 0), ga, gb)
+                    .bvextract(size - 1, 0));
+
+      BitVector q, r;
+      a.bvudivurem(b, &q, &r);
+      ASSERT_EQ(q, a.bvudiv(b));
+      ASSERT_EQ(r, a.bvurem(b));
+      if (a.lsb())
+      {
+        ASSERT_TRUE(a.bvmodinv().bvmul(a).is_one());
+      }
+    }
+  }
+}
+
 /* -------------------------------------------------------------------------- */
 
 }  // namespace bzla::test
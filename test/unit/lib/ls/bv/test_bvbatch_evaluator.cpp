@@ -0,0 +1,203 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include "ls/bv/bitvector_batch_evaluator.h"
+#include "ls/ls_bv.h"
+#include "test_bvnode.h"
+
+namespace bzla::ls::test {
+
+class TestBvBatchEvaluator : public TestBvNodeCommon
+{
+ protected:
+  static constexpr size_t NUM_LANES = 16;
+
+  /**
+   * Create nodes of all kinds with operands of given bit-width and check
+   * the results of the batch evaluator against BitVectorNode::evaluate().
+   */
+  void test_evaluate(uint64_t size);
+};
+
+void
+TestBvBatchEvaluator::test_evaluate(uint64_t size)
+{
+  LocalSearchBV ls(100, 100);
+
+  uint64_t c = ls.mk_node(BitVector::from_ui(size, 3), BitVectorDomain(size));
+  uint64_t x = ls.mk_node(NodeKind::CONST, size);
+  uint64_t y = ls.mk_node(NodeKind::CONST, size);
+  uint64_t b = ls.mk_node(NodeKind::CONST, 1);
+
+  std::vector<uint64_t> ops = {
+      ls.mk_node(NodeKind::BV_ADD, size, {x, y}),
+      ls.mk_node(NodeKind::BV_AND, size, {x, y}),
+      ls.mk_node(NodeKind::BV_MUL, size, {x, c}),
+      ls.mk_node(NodeKind::BV_SHL, size, {x, y}),
+      ls.mk_node(NodeKind::BV_SHR, size, {x, c}),
+      ls.mk_node(NodeKind::BV_ASHR, size, {x, y}),
+      ls.mk_node(NodeKind::BV_UDIV, size, {x, y}),
+      ls.mk_node(NodeKind::BV_UREM, size, {x, y}),
+      ls.mk_node(NodeKind::BV_XOR, size, {x, y}),
+      ls.mk_node(NodeKind::BV_NOT, size, {x}),
+      ls.mk_node(NodeKind::ITE, size, {b, x, y}),
+      ls.mk_node(NodeKind::EQ, 1, {x, y}),
+      ls.mk_node(NodeKind::BV_ULT, 1, {x, y}),
+      ls.mk_node(NodeKind::BV_SLT, 1, {x, y}),
+      ls.mk_node(NodeKind::BV_EXTRACT, 1, {x}, {size - 1, size - 1}),
+  };
+  uint64_t half = size / 2;
+  uint64_t lo   = ls.mk_node(NodeKind::BV_EXTRACT, half, {y}, {half - 1, 0});
+  ops.push_back(lo);
+  ops.push_back(ls.mk_node(NodeKind::BV_CONCAT, 2 * half, {lo, lo}));
+  ops.push_back(ls.mk_node(NodeKind::BV_SEXT, size, {lo}, {size - half}));
+  ops.push_back(ls.mk_node(NodeKind::BV_SHR, size, {x, x}));
+
+  BitVectorBatchEvaluator eval(NUM_LANES);
+  for (uint64_t id = 0, n = ls.d_nodes.size(); id < n; ++id)
+  {
+    ASSERT_TRUE(eval.add(ls.get_node(id)));
+  }
+  ASSERT_EQ(eval.num_nodes(), ls.d_nodes.size());
+  ASSERT_EQ(eval.inputs(), std::vector<uint64_t>({c, x, y, b}));
+
+  std::vector<std::vector<BitVector>> values(NUM_LANES);
+  for (size_t lane = 0; lane < NUM_LANES; ++lane)
+  {
+    for (uint64_t id : {x, y, b})
+    {
+      // Include small values to cover shifts by less than the bit-width and
+      // division by zero.
+      BitVector val = d_rng->flip_coin()
+                          ? BitVector(ls.get_node(id)->size(), *d_rng)
+                          : BitVector::from_ui(ls.get_node(id)->size(),
+                                               d_rng->pick<uint64_t>(0, 1));
+      values[lane].push_back(val);
+      eval.set(id, lane, val.to_uint64());
+    }
+  }
+  eval.evaluate();
+
+  for (size_t lane = 0; lane < NUM_LANES; ++lane)
+  {
+    ls.get_node(x)->set_assignment(values[lane][0]);
+    ls.get_node(y)->set_assignment(values[lane][1]);
+    ls.get_node(b)->set_assignment(values[lane][2]);
+    for (uint64_t id = 0, n = ls.d_nodes.size(); id < n; ++id)
+    {
+      BitVectorNode* node = ls.get_node(id);
+      node->evaluate();
+      ASSERT_EQ(eval.get(id, lane), node->assignment().to_uint64())
+          << "lane " << lane << ": " << *node;
+      ASSERT_EQ(eval.lanes(id)[lane], eval.get(id, lane));
+    }
+  }
+}
+
+TEST_F(TestBvBatchEvaluator, evaluate)
+{
+  test_evaluate(7);
+  test_evaluate(32);
+  test_evaluate(64);
+}
+
+TEST_F(TestBvBatchEvaluator, set)
+{
+  LocalSearchBV ls(100, 100);
+  uint64_t x  = ls.mk_node(NodeKind::CONST, 8);
+  uint64_t y  = ls.mk_node(NodeKind::CONST, 8);
+  uint64_t xy = ls.mk_node(NodeKind::BV_ADD, 8, {x, y});
+  ls.set_assignment(x, BitVector::from_ui(8, 5));
+
+  BitVectorBatchEvaluator eval(4);
+  for (uint64_t id = 0; id < 3; ++id)
+  {
+    ASSERT_TRUE(eval.add(ls.get_node(id)));
+  }
+  // Lanes are initialized with the current assignment of the leaf nodes.
+  eval.evaluate();
+  for (size_t lane = 0; lane < 4; ++lane)
+  {
+    ASSERT_EQ(eval.get(xy, lane), 5);
+  }
+  eval.set(y, 255);
+  eval.set(y, 2, 1);
+  eval.evaluate();
+  ASSERT_EQ(eval.get(xy, 0), 4);
+  ASSERT_EQ(eval.get(xy, 1), 4);
+  ASSERT_EQ(eval.get(xy, 2), 6);
+  ASSERT_EQ(eval.get(xy, 3), 4);
+}
+
+TEST_F(TestBvBatchEvaluator, max_size)
+{
+  LocalSearchBV ls(100, 100);
+  uint64_t x = ls.mk_node(NodeKind::CONST, 64);
+  uint64_t y = ls.mk_node(NodeKind::CONST, 65);
+
+  BitVectorBatchEvaluator eval(1);
+  ASSERT_TRUE(eval.add(ls.get_node(x)));
+  ASSERT_FALSE(eval.add(ls.get_node(y)));
+  ASSERT_EQ(eval.num_nodes(), 1);
+}
+
+#if 0
+TEST_F(TestBvBatchEvaluator, perf_add_mul)
+{
+  const uint64_t size   = 32;
+  const size_t nrounds  = 100000;
+  LocalSearchBV ls(100, 100);
+  uint64_t x   = ls.mk_node(NodeKind::CONST, size);
+  uint64_t y   = ls.mk_node(NodeKind::CONST, size);
+  uint64_t xpy = ls.mk_node(NodeKind::BV_ADD, size, {x, y});
+  (void) ls.mk_node(NodeKind::BV_MUL, size, {xpy, x});
+
+  for (size_t num_lanes : {1, 8, 64})
+  {
+    BitVectorBatchEvaluator eval(num_lanes);
+    for (uint64_t id = 0, n = ls.d_nodes.size(); id < n; ++id)
+    {
+      eval.add(ls.get_node(id));
+    }
+    for (size_t lane = 0; lane < num_lanes; ++lane)
+    {
+      eval.set(x, lane, BitVector(size, *d_rng).to_uint64());
+      eval.set(y, lane, BitVector(size, *d_rng).to_uint64());
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < nrounds; ++i)
+    {
+      eval.evaluate();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    std::cout << "batch (" << num_lanes
+              << " lanes): " << nrounds * num_lanes / elapsed.count()
+              << " assignments/s" << std::endl;
+  }
+
+  BitVector xval(size, *d_rng), yval(size, *d_rng), res(size);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < nrounds; ++i)
+  {
+    res.ibvadd(xval, yval);
+    res.ibvmul(xval);
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::cout << "BitVector: " << nrounds / elapsed.count() << " assignments/s"
+            << std::endl;
+}
+#endif
+
+}  // namespace bzla::ls::test
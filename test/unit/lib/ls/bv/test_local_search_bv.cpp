@@ -10,6 +10,7 @@
 
 #include <map>
 
+#include "ls/internal.h"
 #include "ls/ls_bv.h"
 #include "test_bvnode.h"
 
@@ -829,6 +830,56 @@ TEST_F(TestLsBv, update_cone)
   }
 }
 
+TEST_F(TestLsBv, fix_leaf_bit)
+{
+  d_ls->register_root(d_root1);
+  d_ls->register_root(d_root2);
+  d_ls->compute_initial_assignment();
+  ASSERT_EQ(d_ls->get_assignment(d_v1).compare(d_zero4), 0);
+
+  /* v1[0] -> 1: assignment does not match, cone is updated */
+  d_ls->fix_leaf_bit(d_v1, 0, true);
+  ASSERT_TRUE(d_ls->get_domain(d_v1).is_fixed_bit_true(0));
+  ASSERT_EQ(d_ls->get_assignment(d_v1).compare(d_one4), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v1pc1).compare(d_ele4), 0);
+  ASSERT_EQ(d_ls->get_assignment(d_v3sc1pv3pv1).compare(d_sev4), 0);
+
+  /* v1[3] -> 0: assignment matches */
+  d_ls->fix_leaf_bit(d_v1, 3, false);
+  ASSERT_TRUE(d_ls->get_domain(d_v1).is_fixed_bit_false(3));
+  ASSERT_EQ(d_ls->get_assignment(d_v1).compare(d_one4), 0);
+}
+
+TEST_F(TestLsBv, move_candidates)
+{
+  LocalSearchBV ls(0, 0, 1234);
+  ls.d_options.num_move_candidates = 4;
+
+  uint64_t x = ls.mk_node(NodeKind::CONST, 16);
+  uint64_t y = ls.mk_node(NodeKind::CONST, 16);
+  uint64_t c = ls.mk_node(BitVector::from_ui(16, 1000), BitVectorDomain(16));
+  uint64_t xpy = ls.mk_node(NodeKind::BV_ADD, 16, {x, y});
+  // x + y = 1000
+  ls.register_root(ls.mk_node(NodeKind::EQ, 1, {xpy, c}));
+  // x < y
+  ls.register_root(ls.mk_node(NodeKind::BV_ULT, 1, {x, y}));
+  // x[0:0]
+  ls.register_root(ls.mk_node(NodeKind::BV_EXTRACT, 1, {x}, {0, 0}));
+
+  Result res = Result::UNKNOWN;
+  for (uint32_t i = 0; i < 1000 && res != Result::SAT; ++i)
+  {
+    res = ls.move();
+  }
+  ASSERT_EQ(res, Result::SAT);
+  ASSERT_GT(ls.d_internal->d_stats.num_move_candidates, 0);
+  BitVector xval = ls.get_assignment(x);
+  BitVector yval = ls.get_assignment(y);
+  ASSERT_EQ(xval.bvadd(yval).to_uint64(), 1000);
+  ASSERT_TRUE(xval.bvult(yval).is_true());
+  ASSERT_TRUE(xval.bit(0));
+}
+
 TEST_F(TestLsBv, move_add)
 {
   test_move_binary(NodeKind::BV_ADD, 0);
@@ -8,6 +8,9 @@
  * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
  */
 
+#include <thread>
+#include <unordered_set>
+
 #include "bv/bitvector.h"
 #include "node/node.h"
 #include "node/node_manager.h"
@@ -195,6 +198,143 @@ TEST_F(TestNodeManager, mk_node)
   ASSERT_EQ(or_z, nm.mk_node(Kind::OR, {nm.mk_node(Kind::AND, {x, y}), z}));
 }
 
+TEST_F(TestNodeManager, node_data_allocator)
+{
+  NodeManager nm;
+  auto stats = [&nm]() { return nm.statistics().d_allocator; };
+
+  Type bool_type = nm.mk_bool_type();
+  Node x         = nm.mk_const(bool_type);
+
+  std::vector<Node> children;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    children.push_back(nm.mk_const(bool_type));
+  }
+
+  {
+    Node x_and_y = nm.mk_node(Kind::AND, {x, children[0]});
+    Node nary    = nm.mk_node(Kind::DISTINCT, children);
+    ASSERT_EQ(stats().d_num_nodes[0], 1);
+    ASSERT_GT(stats().d_num_bytes[0], 100 * sizeof(Node));
+    ASSERT_EQ(stats().d_num_reused, 0);
+  }
+  // Heap allocated node data is released immediately.
+  ASSERT_EQ(stats().d_num_nodes[0], 0);
+  ASSERT_EQ(stats().d_num_bytes[0], 0);
+
+  // Slots of garbage collected node data are reused.
+  Node x_and_y = nm.mk_node(Kind::AND, {x, children[0]});
+  ASSERT_EQ(stats().d_num_reused, 1);
+  ASSERT_EQ(x_and_y[0], x);
+  ASSERT_EQ(x_and_y[1], children[0]);
+
+  uint64_t num_nodes = 0;
+  for (uint64_t n : stats().d_num_nodes)
+  {
+    num_nodes += n;
+  }
+  ASSERT_EQ(num_nodes, nm.statistics().d_num_node_data);
+}
+
+TEST_F(TestNodeManager, unique_table)
+{
+  NodeManager nm;
+  const auto& table = nm.d_shards[0]->d_unique_table;
+
+  Type bv_type = nm.mk_bv_type(8);
+  std::vector<Node> consts;
+  for (size_t i = 0; i < 64; ++i)
+  {
+    consts.push_back(nm.mk_const(bv_type));
+  }
+
+  // Grow table over several (incremental) resizes while dropping every other
+  // node, lookups must find all remaining nodes.
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < consts.size(); ++i)
+  {
+    for (size_t j = 0; j < consts.size(); ++j)
+    {
+      Node n = nm.mk_node(Kind::BV_ADD, {consts[i], consts[j]});
+      if ((i + j) % 2 == 0)
+      {
+        nodes.push_back(n);
+      }
+    }
+  }
+  ASSERT_EQ(table.size(), nodes.size());
+  size_t k = 0;
+  for (size_t i = 0; i < consts.size(); ++i)
+  {
+    for (size_t j = 0; j < consts.size(); ++j)
+    {
+      if ((i + j) % 2 == 0)
+      {
+        ASSERT_EQ(nodes[k++], nm.mk_node(Kind::BV_ADD, {consts[i], consts[j]}));
+      }
+    }
+  }
+  ASSERT_EQ(table.size(), nodes.size());
+  nodes.clear();
+  ASSERT_EQ(table.size(), 0);
+}
+
+TEST_F(TestNodeManager, thread_safe)
+{
+  NodeManager nm(true);
+  ASSERT_TRUE(nm.is_thread_safe());
+
+  Type bv_type = nm.mk_bv_type(8);
+  std::vector<Node> consts;
+  for (size_t i = 0; i < 64; ++i)
+  {
+    consts.push_back(nm.mk_const(bv_type));
+  }
+
+  // All threads create the same nodes, hash consing must yield the same node
+  // data regardless of which thread created it first.
+  size_t num_threads = 8;
+  std::vector<std::vector<Node>> nodes(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&nm, &consts, &res = nodes[t], t]() {
+      for (size_t i = 0; i < consts.size(); ++i)
+      {
+        for (size_t j = 0; j < consts.size(); ++j)
+        {
+          size_t k = (i + t) % consts.size();
+          Node n   = nm.mk_node(Kind::BV_ADD, {consts[k], consts[j]});
+          res.push_back(nm.mk_node(
+              Kind::BV_MUL, {n, nm.mk_value(BitVector::from_ui(8, k))}));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::unordered_set<Node> unique(nodes[0].begin(), nodes[0].end());
+  for (size_t t = 1; t < num_threads; ++t)
+  {
+    for (const Node& n : nodes[t])
+    {
+      ASSERT_TRUE(unique.find(n) != unique.end());
+    }
+  }
+
+  uint64_t num_live = nm.statistics().d_num_node_data;
+  nodes.clear();
+  unique.clear();
+  // All BV_ADD, BV_MUL and value nodes are reclaimed.
+  ASSERT_EQ(nm.collect_garbage(), 2 * 64 * 64 + 64);
+  ASSERT_EQ(nm.statistics().d_num_node_data, num_live - (2 * 64 * 64 + 64));
+  ASSERT_EQ(nm.collect_garbage(), 0);
+}
+
 TEST_F(TestNodeManager, mk_apply)
 {
   NodeManager nm;
@@ -230,6 +370,70 @@ TEST_F(TestNodeManager, mk_apply)
   ASSERT_DEATH_DEBUG(nm.mk_node(Kind::APPLY, {fun, bool_const}), "");
 }
 
+TEST_F(TestNodeManager, node_info)
+{
+  NodeManager nm;
+
+  Type bool_type = nm.mk_bool_type();
+  Type bv_type   = nm.mk_bv_type(8);
+  Type u_type    = nm.mk_uninterpreted_type("U");
+  Type arr_type  = nm.mk_array_type(u_type, bv_type);
+
+  Node a    = nm.mk_const(bv_type, "a");
+  Node p    = nm.mk_const(bool_type, "p");
+  Node x    = nm.mk_var(bv_type, "x");
+  Node u    = nm.mk_const(arr_type, "u");
+  Node zero = nm.mk_value(BitVector::mk_zero(8));
+
+  const NodeInfo& ia = a.node_info();
+  ASSERT_EQ(ia.depth, 0);
+  ASSERT_TRUE(ia.bv);
+  ASSERT_FALSE(ia.variable || ia.quantifier || ia.lambda || ia.array
+               || ia.fp || ia.fun || ia.uninterpreted);
+  ASSERT_EQ(zero.node_info().depth, 0);
+  ASSERT_TRUE(zero.node_info().bv);
+  ASSERT_FALSE(p.node_info().bv);
+  ASSERT_TRUE(x.node_info().variable);
+  ASSERT_TRUE(u.node_info().array);
+  ASSERT_TRUE(u.node_info().uninterpreted);
+
+  Node add = nm.mk_node(Kind::BV_ADD, {a, zero});
+  Node mul = nm.mk_node(Kind::BV_MUL, {add, add});
+  Node ult = nm.mk_node(Kind::BV_ULT, {mul, a});
+  ASSERT_EQ(add.node_info().depth, 1);
+  ASSERT_EQ(mul.node_info().depth, 2);
+  ASSERT_EQ(ult.node_info().depth, 3);
+  ASSERT_TRUE(ult.node_info().bv);
+  ASSERT_FALSE(ult.node_info().variable);
+
+  Node body = nm.mk_node(Kind::EQUAL, {nm.mk_node(Kind::BV_ADD, {x, a}), zero});
+  Node lam  = nm.mk_node(Kind::LAMBDA, {x, nm.mk_node(Kind::BV_ADD, {x, a})});
+  Node q    = nm.mk_node(Kind::FORALL, {x, body});
+  ASSERT_TRUE(body.node_info().variable);
+  ASSERT_FALSE(body.node_info().quantifier);
+  ASSERT_TRUE(lam.node_info().lambda);
+  ASSERT_TRUE(lam.node_info().fun);
+  ASSERT_FALSE(lam.node_info().quantifier);
+  ASSERT_TRUE(q.node_info().quantifier);
+  ASSERT_TRUE(q.node_info().variable);
+  ASSERT_FALSE(q.node_info().lambda);
+  ASSERT_EQ(q.node_info().depth, 3);
+
+  Node sel = nm.mk_node(Kind::SELECT, {u, nm.mk_const(u_type)});
+  Node eq  = nm.mk_node(Kind::EQUAL, {sel, a});
+  ASSERT_TRUE(eq.node_info().uninterpreted);
+  ASSERT_TRUE(eq.node_info().array);
+  ASSERT_FALSE(ult.node_info().uninterpreted);
+  ASSERT_FALSE(ult.node_info().array);
+
+  Node n = a;
+  for (size_t i = 0; i < 40; ++i)
+  {
+    n = nm.mk_node(Kind::BV_ADD, {n, n});
+  }
+  ASSERT_EQ(n.node_info().depth, 40);
+}
+
 TEST_F(TestNodeManager, check_type)
 {
   NodeManager nm;
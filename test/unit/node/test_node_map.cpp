@@ -0,0 +1,147 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <gtest/gtest.h>
+
+#include "node/node_manager.h"
+#include "node/node_map.h"
+#include "node/node_set.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeMap : public ::testing::Test
+{
+  void SetUp() override
+  {
+    Type bv_type = d_nm.mk_bv_type(8);
+    // Spread nodes over several pages.
+    for (size_t i = 0; i < 1000; ++i)
+    {
+      d_nodes.push_back(d_nm.mk_const(bv_type));
+    }
+  }
+
+ protected:
+  NodeManager d_nm;
+  std::vector<Node> d_nodes;
+};
+
+TEST_F(TestNodeMap, map)
+{
+  NodeMap<Node> map;
+  ASSERT_TRUE(map.empty());
+  for (size_t i = 0; i < d_nodes.size(); i += 2)
+  {
+    auto [it, inserted] = map.emplace(d_nodes[i], d_nodes[i + 1]);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(it->first, d_nodes[i]);
+    ASSERT_EQ(it->second, d_nodes[i + 1]);
+  }
+  ASSERT_EQ(map.size(), d_nodes.size() / 2);
+  ASSERT_FALSE(map.emplace(d_nodes[0], d_nodes[0]).second);
+  ASSERT_EQ(map.at(d_nodes[0]), d_nodes[1]);
+  ASSERT_THROW(map.at(d_nodes[1]), std::out_of_range);
+
+  for (size_t i = 0; i < d_nodes.size(); ++i)
+  {
+    ASSERT_EQ(map.count(d_nodes[i]), i % 2 == 0 ? 1 : 0);
+  }
+
+  // Iteration follows insertion order.
+  size_t i = 0;
+  for (const auto& [key, value] : map)
+  {
+    ASSERT_EQ(key, d_nodes[i]);
+    ASSERT_EQ(value, d_nodes[i + 1]);
+    i += 2;
+  }
+
+  // References remain valid on insertion.
+  Node& value = map[d_nodes[1]];
+  ASSERT_TRUE(value.is_null());
+  for (size_t j = 3; j < d_nodes.size(); j += 2)
+  {
+    map[d_nodes[j]] = d_nodes[j];
+  }
+  ASSERT_EQ(&value, &map.find(d_nodes[1])->second);
+
+  ASSERT_EQ(map.erase(d_nodes[1]), 1);
+  ASSERT_EQ(map.erase(d_nodes[1]), 0);
+  ASSERT_EQ(map.find(d_nodes[1]), map.end());
+  ASSERT_EQ(map.size(), d_nodes.size() - 1);
+
+  // Erase while iterating.
+  for (auto it = map.begin(); it != map.end();)
+  {
+    if (it->first.id() % 3 == 0)
+    {
+      it = map.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  for (const Node& n : d_nodes)
+  {
+    ASSERT_EQ(map.count(n), n != d_nodes[1] && n.id() % 3 != 0);
+  }
+
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.begin(), map.end());
+  ASSERT_EQ(map.find(d_nodes[0]), map.end());
+  map.emplace(d_nodes[0], d_nodes[0]);
+  ASSERT_EQ(map.size(), 1);
+}
+
+TEST_F(TestNodeMap, map_copy)
+{
+  NodeMap<uint64_t> map;
+  for (const Node& n : d_nodes)
+  {
+    map.emplace(n, n.id());
+  }
+  NodeMap<uint64_t> copy(map);
+  map.clear();
+  ASSERT_EQ(copy.size(), d_nodes.size());
+  for (const auto& [key, value] : copy)
+  {
+    ASSERT_EQ(key.id(), value);
+  }
+}
+
+TEST_F(TestNodeMap, set)
+{
+  NodeSet set;
+  for (const Node& n : d_nodes)
+  {
+    ASSERT_TRUE(set.insert(n).second);
+    ASSERT_FALSE(set.insert(n).second);
+  }
+  ASSERT_EQ(set.size(), d_nodes.size());
+
+  size_t i = 0;
+  for (const Node& n : set)
+  {
+    ASSERT_EQ(n, d_nodes[i++]);
+  }
+
+  ASSERT_EQ(set.erase(d_nodes[0]), 1);
+  ASSERT_EQ(set.count(d_nodes[0]), 0);
+  ASSERT_EQ(set.count(d_nodes[1]), 1);
+  set.clear();
+  ASSERT_TRUE(set.empty());
+  ASSERT_EQ(set.count(d_nodes[1]), 0);
+}
+
+}  // namespace bzla::test
@@ -0,0 +1,288 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sstream>
+#include <unordered_map>
+
+#include "bv/bitvector.h"
+#include "node/node_manager.h"
+#include "node/node_snapshot.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
+#include "solver/fp/symfpu_nm.h"
+#include "util/exceptions.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeSnapshot : public ::testing::Test
+{
+ protected:
+  /** Save `roots` and load them into `nm`. */
+  std::vector<Node> round_trip(NodeManager& nm, const std::vector<Node>& roots)
+  {
+    std::stringstream ss;
+    save_snapshot(ss, roots);
+    std::string data = ss.str();
+    return load_snapshot(nm, data.data(), data.size());
+  }
+
+  /** Check that `a` and `b` are structurally equal. */
+  bool equal(const Node& a, const Node& b)
+  {
+    auto [it, inserted] = d_equal.emplace(a.id(), b.id());
+    if (!inserted)
+    {
+      return it->second == b.id();
+    }
+    if (a.kind() != b.kind() || a.type().str() != b.type().str()
+        || a.num_children() != b.num_children() || a.indices() != b.indices())
+    {
+      return false;
+    }
+    if (a.symbol().has_value() != b.symbol().has_value()
+        || (a.symbol() && a.symbol()->get() != b.symbol()->get()))
+    {
+      return false;
+    }
+    if (a.is_value())
+    {
+      const Type& type = a.type();
+      if (type.is_bool())
+      {
+        return a.value<bool>() == b.value<bool>();
+      }
+      if (type.is_bv())
+      {
+        return a.value<BitVector>() == b.value<BitVector>();
+      }
+      if (type.is_rm())
+      {
+        return a.value<RoundingMode>() == b.value<RoundingMode>();
+      }
+      if (type.is_fp())
+      {
+        return a.value<FloatingPoint>() == b.value<FloatingPoint>();
+      }
+      return a.value<std::string>() == b.value<std::string>();
+    }
+    for (size_t i = 0, n = a.num_children(); i < n; ++i)
+    {
+      if (!equal(a[i], b[i]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  NodeManager d_nm;
+  /** Maps node ids of compared nodes. */
+  std::unordered_map<uint64_t, uint64_t> d_equal;
+};
+
+TEST_F(TestNodeSnapshot, bv)
+{
+  Type bv8   = d_nm.mk_bv_type(8);
+  Type bv100 = d_nm.mk_bv_type(100);
+  Node a     = d_nm.mk_const(bv8, "a");
+  Node b     = d_nm.mk_const(bv8, "b");
+  Node c     = d_nm.mk_const(bv100);
+  Node add   = d_nm.mk_node(Kind::BV_ADD, {a, b});
+  Node mul   = d_nm.mk_node(Kind::BV_MUL, {add, add});
+  Node ext   = d_nm.mk_node(Kind::BV_EXTRACT, {c}, {99, 92});
+  Node v100  = d_nm.mk_value(BitVector(100, "1" + std::string(98, '0') + "1"));
+  Node v128  = d_nm.mk_value(BitVector::mk_ones(128));
+  Node eq0   = d_nm.mk_node(Kind::EQUAL, {mul, ext});
+  Node eq1   = d_nm.mk_node(Kind::EQUAL, {c, v100});
+  Node eq2   = d_nm.mk_node(
+      Kind::EQUAL,
+      {d_nm.mk_node(Kind::BV_ZERO_EXTEND, {a}, {120}), v128});
+  std::vector<Node> roots = {eq0, eq1, eq2, eq0};
+
+  NodeManager nm;
+  auto res = round_trip(nm, roots);
+  ASSERT_EQ(res.size(), roots.size());
+  for (size_t i = 0; i < roots.size(); ++i)
+  {
+    ASSERT_TRUE(equal(roots[i], res[i]));
+  }
+  ASSERT_EQ(res[0], res[3]);
+  // Shared subterms are preserved.
+  ASSERT_EQ(res[0][0][0], res[0][0][1]);
+  ASSERT_EQ(res[0][1][0], res[1][0]);
+
+  // Constants are created fresh, values are hash-consed.
+  d_equal.clear();
+  auto same = round_trip(d_nm, roots);
+  ASSERT_NE(same[0], eq0);
+  ASSERT_TRUE(equal(eq0, same[0]));
+  ASSERT_EQ(same[1][1], v100);
+  ASSERT_EQ(same[2][1], v128);
+}
+
+TEST_F(TestNodeSnapshot, bool_rm_uninterpreted)
+{
+  Type bool_type = d_nm.mk_bool_type();
+  Type rm_type   = d_nm.mk_rm_type();
+  Type u_type    = d_nm.mk_uninterpreted_type("U");
+  Node p         = d_nm.mk_const(bool_type, "p");
+  Node rm        = d_nm.mk_const(rm_type);
+  Node u         = d_nm.mk_const(u_type, "u");
+  std::vector<Node> roots = {
+      d_nm.mk_node(Kind::AND, {p, d_nm.mk_value(true)}),
+      d_nm.mk_node(Kind::EQUAL, {rm, d_nm.mk_value(RoundingMode::RTZ)}),
+      d_nm.mk_node(Kind::DISTINCT, {u, d_nm.mk_value(u_type, "u0")}),
+      d_nm.mk_node(Kind::EQUAL, {u, d_nm.mk_const(u_type)})};
+
+  NodeManager nm;
+  auto res = round_trip(nm, roots);
+  ASSERT_EQ(res.size(), roots.size());
+  for (size_t i = 0; i < roots.size(); ++i)
+  {
+    ASSERT_TRUE(equal(roots[i], res[i]));
+  }
+  // Uninterpreted types are shared within a snapshot.
+  ASSERT_EQ(res[2][0].type(), res[3][1].type());
+  ASSERT_EQ(res[2][0].type().uninterpreted_symbol(), "U");
+}
+
+TEST_F(TestNodeSnapshot, fp)
+{
+  fp::SymFpuNM snm(d_nm);
+  Type fp16 = d_nm.mk_fp_type(5, 11);
+  Node a    = d_nm.mk_const(fp16, "a");
+  Node rm   = d_nm.mk_value(RoundingMode::RNE);
+  Node one  = d_nm.mk_value(
+      FloatingPoint(fp16, BitVector::from_ui(16, 0x3c00)));
+  Node nan  = d_nm.mk_value(FloatingPoint::fpnan(fp16));
+  Node add  = d_nm.mk_node(Kind::FP_ADD, {rm, a, one});
+  std::vector<Node> roots = {d_nm.mk_node(Kind::FP_LT, {add, one}),
+                             d_nm.mk_node(Kind::FP_IS_NAN, {nan})};
+
+  NodeManager nm;
+  auto res = round_trip(nm, roots);
+  ASSERT_EQ(res.size(), roots.size());
+  for (size_t i = 0; i < roots.size(); ++i)
+  {
+    ASSERT_TRUE(equal(roots[i], res[i]));
+  }
+}
+
+TEST_F(TestNodeSnapshot, array_fun_binder)
+{
+  Type bv8  = d_nm.mk_bv_type(8);
+  Type arr  = d_nm.mk_array_type(bv8, bv8);
+  Type fun  = d_nm.mk_fun_type({bv8, bv8, d_nm.mk_bool_type()});
+  Node zero = d_nm.mk_value(BitVector::mk_zero(8));
+  Node a    = d_nm.mk_const(arr, "a");
+  Node f    = d_nm.mk_const(fun, "f");
+  Node i    = d_nm.mk_const(bv8, "i");
+  Node x    = d_nm.mk_var(bv8, "x");
+  Node y    = d_nm.mk_var(bv8, "x");
+  Node carr = d_nm.mk_const_array(arr, zero);
+  Node st   = d_nm.mk_node(Kind::STORE, {carr, i, zero});
+  Node lam  = d_nm.mk_node(
+      Kind::LAMBDA, {x, d_nm.mk_node(Kind::BV_ADD, {x, i})});
+  std::vector<Node> roots = {
+      d_nm.mk_node(Kind::EQUAL, {a, st}),
+      d_nm.mk_node(Kind::APPLY, {f, i, d_nm.mk_node(Kind::APPLY, {lam, i})}),
+      d_nm.mk_node(
+          Kind::FORALL,
+          {y,
+           d_nm.mk_node(Kind::EQUAL,
+                        {d_nm.mk_node(Kind::SELECT, {a, y}), zero})})};
+
+  NodeManager nm;
+  auto res = round_trip(nm, roots);
+  ASSERT_EQ(res.size(), roots.size());
+  for (size_t j = 0; j < roots.size(); ++j)
+  {
+    ASSERT_TRUE(equal(roots[j], res[j]));
+  }
+  // Variables with the same symbol remain distinct.
+  ASSERT_NE(res[1][2][0][0], res[2][0]);
+  ASSERT_EQ(res[1][2][0][0].symbol()->get(), res[2][0].symbol()->get());
+}
+
+TEST_F(TestNodeSnapshot, file)
+{
+  Type bv8                = d_nm.mk_bv_type(8);
+  Node a                  = d_nm.mk_const(bv8, "a");
+  std::vector<Node> roots = {
+      d_nm.mk_node(Kind::BV_ULT, {a, d_nm.mk_value(BitVector::mk_one(8))})};
+  std::string filename = ::testing::TempDir() + "test_node_snapshot.bin";
+  save_snapshot(filename, roots);
+
+  NodeManager nm;
+  auto res = load_snapshot(nm, filename);
+  ASSERT_EQ(res.size(), 1);
+  ASSERT_TRUE(equal(roots[0], res[0]));
+  std::remove(filename.c_str());
+  ASSERT_THROW(load_snapshot(nm, filename), Error);
+}
+
+TEST_F(TestNodeSnapshot, empty)
+{
+  NodeManager nm;
+  ASSERT_TRUE(round_trip(nm, {}).empty());
+}
+
+TEST_F(TestNodeSnapshot, invalid)
+{
+  Type bv8  = d_nm.mk_bv_type(8);
+  Type arr  = d_nm.mk_array_type(bv8, bv8);
+  Node a    = d_nm.mk_const(arr, "a");
+  Node i    = d_nm.mk_const(bv8, "i");
+  Node root = d_nm.mk_node(
+      Kind::BV_ULT,
+      {d_nm.mk_node(Kind::SELECT, {a, i}), d_nm.mk_value(BitVector(8, "101"))});
+  std::stringstream ss;
+  save_snapshot(ss, {root});
+  std::string data = ss.str();
+  ASSERT_TRUE(is_snapshot(data.data(), data.size()));
+
+  NodeManager nm;
+  // Every proper prefix of a snapshot is invalid.
+  for (size_t size = 0; size < data.size(); ++size)
+  {
+    ASSERT_THROW(load_snapshot(nm, data.data(), size), Error);
+  }
+  // Trailing data.
+  std::string trailing = data + '\0';
+  ASSERT_THROW(load_snapshot(nm, trailing.data(), trailing.size()), Error);
+  // Corrupted magic.
+  std::string magic = data;
+  magic[0]          = 'X';
+  ASSERT_FALSE(is_snapshot(magic.data(), magic.size()));
+  ASSERT_THROW(load_snapshot(nm, magic.data(), magic.size()), Error);
+  // Arbitrary corruptions are detected or yield well-typed nodes.
+  for (size_t pos = sizeof("BZLASNAP") - 1; pos < data.size(); ++pos)
+  {
+    for (int bit = 0; bit < 8; ++bit)
+    {
+      std::string corrupted = data;
+      corrupted[pos] ^= static_cast<char>(1 << bit);
+      try
+      {
+        load_snapshot(nm, corrupted.data(), corrupted.size());
+      }
+      catch (const Error&)
+      {
+      }
+    }
+  }
+}
+
+}  // namespace bzla::test
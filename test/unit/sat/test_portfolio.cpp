@@ -0,0 +1,186 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2025 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "rng/rng.h"
+#include "sat/cadical.h"
+#include "sat/portfolio.h"
+#include "test.h"
+
+namespace bzla::test {
+
+class TestPortfolio : public TestCommon
+{
+ protected:
+  using Clauses = std::vector<std::vector<int32_t>>;
+
+  /** Generate random 3-CNF with `num_vars` variables and `num_clauses`. */
+  static Clauses random_cnf(RNG& rng, int32_t num_vars, size_t num_clauses)
+  {
+    Clauses res;
+    for (size_t i = 0; i < num_clauses; ++i)
+    {
+      std::vector<int32_t> clause;
+      for (size_t j = 0; j < 3; ++j)
+      {
+        int32_t var = rng.pick<int32_t>(1, num_vars);
+        clause.push_back(rng.flip_coin() ? var : -var);
+      }
+      res.push_back(clause);
+    }
+    return res;
+  }
+
+  static void add_clauses(sat::SatSolver& solver, const Clauses& clauses)
+  {
+    for (const auto& clause : clauses)
+    {
+      solver.add_clause(clause);
+    }
+  }
+
+  /** @return True if the model of `solver` satisfies all `clauses`. */
+  static bool check_model(sat::SatSolver& solver, const Clauses& clauses)
+  {
+    for (const auto& clause : clauses)
+    {
+      bool sat = false;
+      for (int32_t lit : clause)
+      {
+        if (solver.value(lit) == 1)
+        {
+          sat = true;
+          break;
+        }
+      }
+      if (!sat)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+TEST_F(TestPortfolio, ctor_dtor)
+{
+  for (uint64_t n : {1, 2, 4})
+  {
+    sat::Portfolio portfolio(n);
+    ASSERT_EQ(portfolio.solve(), Result::SAT);
+  }
+}
+
+TEST_F(TestPortfolio, agreement)
+{
+  // Around the phase transition of random 3-SAT, roughly half of the
+  // instances are unsatisfiable.
+  RNG rng(42);
+  for (bool share : {false, true})
+  {
+    size_t num_sat = 0, num_unsat = 0;
+    for (size_t i = 0; i < 20; ++i)
+    {
+      Clauses clauses = random_cnf(rng, 50, 213);
+      sat::Cadical cadical;
+      sat::Portfolio portfolio(4, share);
+      add_clauses(cadical, clauses);
+      add_clauses(portfolio, clauses);
+      Result expected = cadical.solve();
+      ASSERT_EQ(portfolio.solve(), expected);
+      if (expected == Result::SAT)
+      {
+        ASSERT_TRUE(check_model(portfolio, clauses));
+        ++num_sat;
+      }
+      else
+      {
+        ++num_unsat;
+      }
+    }
+    ASSERT_GT(num_sat, 0u);
+    ASSERT_GT(num_unsat, 0u);
+  }
+}
+
+TEST_F(TestPortfolio, assumptions)
+{
+  sat::Portfolio portfolio(4);
+  // (1 v 2) ^ (-1 v 2) ^ (-2 v 3)
+  Clauses clauses = {{1, 2}, {-1, 2}, {-2, 3}};
+  add_clauses(portfolio, clauses);
+
+  portfolio.assume(-3);
+  ASSERT_EQ(portfolio.solve(), Result::UNSAT);
+  // Assumptions only hold for one call.
+  ASSERT_EQ(portfolio.solve(), Result::SAT);
+  ASSERT_TRUE(check_model(portfolio, clauses));
+  ASSERT_EQ(portfolio.value(2), 1);
+  ASSERT_EQ(portfolio.value(3), 1);
+
+  portfolio.assume(1);
+  ASSERT_EQ(portfolio.solve(), Result::SAT);
+  ASSERT_EQ(portfolio.value(1), 1);
+
+  portfolio.assume(-1);
+  ASSERT_EQ(portfolio.solve(), Result::SAT);
+  ASSERT_EQ(portfolio.value(1), -1);
+
+  // Incremental, permanently unsatisfiable.
+  portfolio.add_clause({-3});
+  ASSERT_EQ(portfolio.solve(), Result::UNSAT);
+}
+
+TEST_F(TestPortfolio, failed)
+{
+  sat::Portfolio portfolio(4);
+  // (-1 v -2) ^ (3 v 4)
+  Clauses clauses = {{-1, -2}, {3, 4}};
+  add_clauses(portfolio, clauses);
+
+  portfolio.assume(1);
+  portfolio.assume(2);
+  portfolio.assume(5);
+  ASSERT_EQ(portfolio.solve(), Result::UNSAT);
+  ASSERT_TRUE(portfolio.failed(1));
+  ASSERT_TRUE(portfolio.failed(2));
+  ASSERT_FALSE(portfolio.failed(5));
+
+  portfolio.assume(-3);
+  portfolio.assume(-4);
+  portfolio.assume(1);
+  ASSERT_EQ(portfolio.solve(), Result::UNSAT);
+  ASSERT_TRUE(portfolio.failed(-3));
+  ASSERT_TRUE(portfolio.failed(-4));
+  ASSERT_FALSE(portfolio.failed(1));
+}
+
+TEST_F(TestPortfolio, cubes)
+{
+  RNG rng(7);
+  for (size_t i = 0; i < 10; ++i)
+  {
+    Clauses clauses = random_cnf(rng, 50, 213);
+    sat::Cadical cadical;
+    sat::Portfolio portfolio(4);
+    add_clauses(cadical, clauses);
+    add_clauses(portfolio, clauses);
+    Result expected = cadical.solve();
+    ASSERT_EQ(portfolio.solve_cubes({{1, 2}, {1, -2}, {-1, 2}, {-1, -2}}),
+              expected);
+    if (expected == Result::SAT)
+    {
+      ASSERT_TRUE(check_model(portfolio, clauses));
+    }
+    // Cubes do not persist across calls.
+    ASSERT_EQ(portfolio.solve(), expected);
+  }
+}
+
+}  // namespace bzla::test
@@ -8,6 +8,7 @@
  * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
  */
 
+#include <thread>
 #include <unordered_set>
 
 #include "test/unit/test.h"
@@ -180,4 +181,37 @@ TEST_F(TestTypeManager, hash_type)
   ASSERT_FALSE(set.count(bool_type) > 0);
 }
 
+TEST_F(TestTypeManager, thread_safe)
+{
+  TypeManager tm(true);
+  Type bool_type = tm.mk_bool_type();
+  Type bv8       = tm.mk_bv_type(8);
+
+  // All threads repeatedly create and release the same types, which must be
+  // garbage collected once the last reference is released.
+  size_t num_threads = 8;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&tm, &bool_type, &bv8]() {
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        Type bv        = tm.mk_bv_type(16 + i % 8);
+        Type array     = tm.mk_array_type(bv8, bv);
+        Type fun       = tm.mk_fun_type({bv, array, bool_type});
+        Type fun_array = tm.mk_array_type(bv, fun);
+        ASSERT_EQ(fun_array.array_element(), fun);
+        ASSERT_EQ(fun_array, tm.mk_array_type(bv, fun));
+        ASSERT_EQ(array, tm.mk_array_type(bv8, tm.mk_bv_type(16 + i % 8)));
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  ASSERT_EQ(tm.d_unique_types.size(), 2);
+  ASSERT_EQ(bv8, tm.mk_bv_type(8));
+}
+
 }  // namespace bzla::test